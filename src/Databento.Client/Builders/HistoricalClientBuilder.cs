@@ -17,6 +17,8 @@ public sealed class HistoricalClientBuilder
     private string? _userAgent;
     private TimeSpan _timeout = TimeSpan.FromSeconds(30);
     private ILogger<IHistoricalClient>? _logger;
+    private TimeSpan? _metadataCacheTtl;
+    private string? _metadataCacheSnapshotPath;
 
     /// <summary>
     /// Set the Databento API key
@@ -110,6 +112,25 @@ public sealed class HistoricalClientBuilder
         return this;
     }
 
+    /// <summary>
+    /// Cache metadata/reference responses (datasets, schemas, fields, publishers, dataset range and condition)
+    /// </summary>
+    /// <param name="ttl">How long a cached response stays valid</param>
+    /// <param name="snapshotPath">Optional file used to persist the cache so process restarts start warm</param>
+    /// <remarks>
+    /// The cache lives in the native layer and is shared by all historical clients in the process.
+    /// See <see cref="HistoricalClient.ConfigureMetadataCache"/>.
+    /// </remarks>
+    public HistoricalClientBuilder WithMetadataCache(TimeSpan ttl, string? snapshotPath = null)
+    {
+        if (ttl <= TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(ttl), "TTL must be positive");
+
+        _metadataCacheTtl = ttl;
+        _metadataCacheSnapshotPath = snapshotPath;
+        return this;
+    }
+
     /// <summary>
     /// Build the HistoricalClient instance
     /// </summary>
@@ -121,6 +142,9 @@ public sealed class HistoricalClientBuilder
         if (_gateway == HistoricalGateway.Custom && (string.IsNullOrEmpty(_customHost) || !_customPort.HasValue))
             throw new InvalidOperationException("Custom gateway requires host and port. Call WithAddress() or use a standard gateway.");
 
+        if (_metadataCacheTtl.HasValue)
+            HistoricalClient.ConfigureMetadataCache(_metadataCacheTtl.Value, _metadataCacheSnapshotPath);
+
         return new HistoricalClient(
             _apiKey,
             _gateway,
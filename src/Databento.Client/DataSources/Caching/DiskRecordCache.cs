@@ -3,6 +3,7 @@ using System.Security.Cryptography;
 using Databento.Client.Dbn;
 using Databento.Client.Models;
 using Databento.Client.Models.Dbn;
+using Databento.Interop;
 
 namespace Databento.Client.DataSources.Caching;
 
@@ -111,6 +112,17 @@ public sealed class DiskRecordCache : IRecordCache
         }
         File.Move(tempPath, _cacheFilePath);
         _recordCount = count;
+
+        // Seek index so ReadFromIndexAsync can jump instead of decoding from the start.
+        // Best-effort: without it reads fall back to skipping records.
+        try
+        {
+            DbnFileReader.BuildIndex(_cacheFilePath);
+        }
+        catch (DbentoException)
+        {
+            TryDeleteIndex();
+        }
     }
 
     /// <inheritdoc/>
@@ -137,16 +149,17 @@ public sealed class DiskRecordCache : IRecordCache
         if (!File.Exists(_cacheFilePath))
             yield break;
 
-        using var reader = new DbnFileReader(_cacheFilePath);
-        long index = 0;
+        using var reader = new DbnFileReader(_cacheFilePath, memoryMapped: true);
+        if (startIndex > 0)
+        {
+            reader.SeekToOrdinal(startIndex);
+        }
+        long index = reader.Position;
 
         await foreach (var record in reader.ReadRecordsAsync(cancellationToken))
         {
-            if (index >= startIndex)
-            {
-                yield return record;
-            }
             index++;
+            yield return record;
         }
 
         _recordCount = index;
@@ -159,10 +172,16 @@ public sealed class DiskRecordCache : IRecordCache
         {
             File.Delete(_cacheFilePath);
         }
+        TryDeleteIndex();
         _recordCount = null;
         return Task.CompletedTask;
     }
 
+    private void TryDeleteIndex()
+    {
+        try { File.Delete(_cacheFilePath + ".dbnidx"); } catch { /* ignore */ }
+    }
+
     /// <inheritdoc/>
     public ValueTask DisposeAsync()
     {
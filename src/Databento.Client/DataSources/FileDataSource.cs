@@ -129,10 +129,16 @@ public sealed class FileDataSource : IDataSource
             yield return CreateSymbolMappingMessage(mapping);
         }
 
-        // Stream records from file
-        long index = 0;
+        // Stream records from file, resuming after the last record delivered or at Playback.SeekToIndex.
+        // The reader jumps there via the file's .dbnidx sidecar when one exists.
+        long index = Playback.GetResumeIndex();
         long? previousNanos = null;
 
+        if (index > 0)
+        {
+            _reader.SeekToOrdinal(index);
+        }
+
         await foreach (var record in _reader.ReadRecordsAsync(linkedCts.Token))
         {
             // Check for pause/stop
@@ -12,6 +12,7 @@ public sealed class PlaybackController
     private volatile bool _isPaused;
     private volatile bool _isStopped;
     private long _currentIndex;
+    private volatile bool _delivered; // Record at _currentIndex has been yielded (not a pending seek target)
     private DateTimeOffset? _currentTimestamp;
 
     /// <summary>
@@ -107,14 +108,24 @@ public sealed class PlaybackController
     }
 
     /// <summary>
-    /// Get the index to resume from (for seek operations).
+    /// Get the index to resume from: the record after the last one yielded, or the
+    /// <see cref="SeekToIndex"/> target if nothing has been yielded since the seek.
     /// </summary>
-    public long GetResumeIndex() => CurrentIndex;
+    public long GetResumeIndex()
+    {
+        lock (_lock)
+        {
+            long index = Interlocked.Read(ref _currentIndex);
+            return _delivered ? index + 1 : index;
+        }
+    }
 
     /// <summary>
     /// Set position for next playback (seek).
     /// Note: Seek only affects the position tracking. The data source
     /// must support starting from an arbitrary position for this to be effective.
+    /// <see cref="FileDataSource"/> starts its next stream at this index, jumping there via the
+    /// file's seek index (see <see cref="Dbn.DbnFileReader.BuildIndex"/>) when one exists.
     /// </summary>
     /// <param name="index">The index to seek to</param>
     public void SeekToIndex(long index)
@@ -122,7 +133,11 @@ public sealed class PlaybackController
         if (index < 0)
             throw new ArgumentOutOfRangeException(nameof(index), "Index must be non-negative");
 
-        Interlocked.Exchange(ref _currentIndex, index);
+        lock (_lock)
+        {
+            Interlocked.Exchange(ref _currentIndex, index);
+            _delivered = false;
+        }
     }
 
     /// <summary>
@@ -132,10 +147,11 @@ public sealed class PlaybackController
     {
         _isStopped = false;
         _isPaused = false;
-        Interlocked.Exchange(ref _currentIndex, 0);
 
         lock (_lock)
         {
+            Interlocked.Exchange(ref _currentIndex, 0);
+            _delivered = false;
             _currentTimestamp = null;
         }
 
@@ -180,10 +196,10 @@ public sealed class PlaybackController
     /// <param name="timestamp">Current record timestamp</param>
     internal void UpdatePosition(long index, DateTimeOffset timestamp)
     {
-        Interlocked.Exchange(ref _currentIndex, index);
-
         lock (_lock)
         {
+            Interlocked.Exchange(ref _currentIndex, index);
+            _delivered = true;
             _currentTimestamp = timestamp;
         }
 
@@ -0,0 +1,148 @@
+using Databento.Interop;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Vectorized analytics over projected DBN columns (see <see cref="DbnColumns"/>)
+/// </summary>
+/// <remarks>
+/// The kernels run natively, using AVX2 when the CPU supports it. Prices are the int64
+/// fixed-point values (1e-9 units) stored in trades/MBP records; UNDEF_PRICE rows are
+/// skipped or mapped to NaN.
+/// </remarks>
+public static class DbnAnalytics
+{
+    /// <summary>
+    /// True if the kernels use AVX2 on this machine
+    /// </summary>
+    public static bool IsAvx2Enabled => NativeMethods.dbento_kernel_simd_level() == 1;
+
+    /// <summary>
+    /// Convert fixed-point prices to doubles (UNDEF_PRICE becomes NaN)
+    /// </summary>
+    /// <param name="prices">Fixed-point prices</param>
+    /// <param name="destination">Output, at least as long as <paramref name="prices"/></param>
+    public static void PricesToDouble(ReadOnlySpan<long> prices, Span<double> destination)
+    {
+        if (destination.Length < prices.Length)
+            throw new ArgumentException("Destination is shorter than the input", nameof(destination));
+        if (prices.IsEmpty)
+            return;
+
+        int result = NativeMethods.dbento_kernel_prices_to_double(prices, (nuint)prices.Length, destination);
+        ThrowIfFailed(result, "convert prices");
+    }
+
+    /// <summary>
+    /// Volume-weighted average price, sum(price * size) / sum(size)
+    /// </summary>
+    /// <returns>VWAP, or NaN if there is no volume</returns>
+    public static double Vwap(ReadOnlySpan<long> prices, ReadOnlySpan<uint> sizes)
+    {
+        if (sizes.Length != prices.Length)
+            throw new ArgumentException("Price and size columns differ in length", nameof(sizes));
+
+        return NativeMethods.dbento_kernel_vwap(prices, sizes, (nuint)prices.Length);
+    }
+
+    /// <summary>
+    /// Count, min/max price, volume and notional per instrument, in order of first appearance
+    /// </summary>
+    public static IReadOnlyList<InstrumentPriceStats> StatsByInstrument(
+        ReadOnlySpan<uint> instrumentIds,
+        ReadOnlySpan<long> prices,
+        ReadOnlySpan<uint> sizes)
+    {
+        if (prices.Length != instrumentIds.Length || sizes.Length != instrumentIds.Length)
+            throw new ArgumentException("Columns differ in length");
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int capacity = 64;
+        while (true)
+        {
+            var ids = new uint[capacity];
+            var counts = new ulong[capacity];
+            var minPrices = new long[capacity];
+            var maxPrices = new long[capacity];
+            var volumes = new ulong[capacity];
+            var notionals = new double[capacity];
+
+            int result = NativeMethods.dbento_kernel_instrument_stats(
+                instrumentIds, prices, sizes, (nuint)instrumentIds.Length,
+                ids, counts, minPrices, maxPrices, volumes, notionals,
+                (nuint)capacity, out nuint groupCount,
+                errorBuffer, (nuint)errorBuffer.Length);
+
+            if (result == -3)
+            {
+                // Too many instruments for the first guess: retry with the exact count
+                capacity = (int)groupCount;
+                continue;
+            }
+
+            if (result != 0)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw DbentoException.CreateFromErrorCode($"Failed to compute instrument stats: {error}", result);
+            }
+
+            var stats = new InstrumentPriceStats[(int)groupCount];
+            for (int i = 0; i < stats.Length; i++)
+            {
+                stats[i] = new InstrumentPriceStats(
+                    ids[i], (long)counts[i], minPrices[i], maxPrices[i], volumes[i], notionals[i]);
+            }
+            return stats;
+        }
+    }
+
+    /// <summary>
+    /// Period-over-period returns; destination[0] is NaN
+    /// </summary>
+    /// <param name="prices">Prices (e.g. from <see cref="PricesToDouble"/>)</param>
+    /// <param name="destination">Output, at least as long as <paramref name="prices"/> and not overlapping it</param>
+    /// <param name="logReturns">Log returns instead of simple returns</param>
+    public static void Returns(ReadOnlySpan<double> prices, Span<double> destination, bool logReturns = false)
+    {
+        if (destination.Length < prices.Length)
+            throw new ArgumentException("Destination is shorter than the input", nameof(destination));
+        if (prices.Overlaps(destination))
+            throw new ArgumentException("Destination must not overlap the input", nameof(destination));
+        if (prices.IsEmpty)
+            return;
+
+        int result = NativeMethods.dbento_kernel_returns(prices, (nuint)prices.Length, logReturns ? 1 : 0, destination);
+        ThrowIfFailed(result, "compute returns");
+    }
+
+    /// <summary>
+    /// Rolling mean and sample variance over <paramref name="window"/> rows.
+    /// Outputs are NaN until the window is full and while it contains a NaN.
+    /// </summary>
+    /// <param name="values">Input values</param>
+    /// <param name="window">Window length in rows</param>
+    /// <param name="means">Output means (empty to skip)</param>
+    /// <param name="variances">Output variances (empty to skip)</param>
+    public static void RollingMeanVariance(ReadOnlySpan<double> values, int window, Span<double> means, Span<double> variances)
+    {
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(window);
+        if ((!means.IsEmpty && means.Length < values.Length) || (!variances.IsEmpty && variances.Length < values.Length))
+            throw new ArgumentException("Output is shorter than the input");
+        if (values.IsEmpty || (means.IsEmpty && variances.IsEmpty))
+            return;
+
+        int result = NativeMethods.dbento_kernel_rolling_mean_var(
+            values, (nuint)values.Length, (nuint)window,
+            means.IsEmpty ? default : means,
+            variances.IsEmpty ? default : variances);
+        ThrowIfFailed(result, "compute rolling mean/variance");
+    }
+
+    // The element-wise kernels take no error buffer: a non-zero result means invalid parameters
+    private static void ThrowIfFailed(int result, string operation)
+    {
+        if (result != 0)
+            throw DbentoException.CreateFromErrorCode($"Failed to {operation}: invalid parameters", result);
+    }
+}
@@ -0,0 +1,182 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// A columnar batch of DBN records held in native memory through the Arrow C Data Interface.
+/// The batch is a struct array with one child per projected field: integers keep their DBN
+/// type, prices are 1e-9 fixed-point <see cref="long"/>, ts_* fields are UTC nanosecond
+/// timestamps (<see cref="ulong"/> values) and action/side are one-character strings.
+/// </summary>
+/// <remarks>
+/// Columns are read in place with <see cref="GetColumn{T}(int)"/>. To hand the batch to an Arrow
+/// implementation instead (e.g. Apache.Arrow's <c>CArrowArrayImporter.ImportRecordBatch</c>),
+/// pass <see cref="ArrowArrayPointer"/> and <see cref="ArrowSchemaPointer"/>; the importer
+/// takes ownership of the buffers and <see cref="Dispose"/> then only frees the structs.
+/// </remarks>
+public sealed unsafe class DbnArrowBatch : IDisposable
+{
+    internal delegate int ExportCallback(CArrowSchema* schema, CArrowArray* array);
+
+    private CArrowSchema* _schema;
+    private CArrowArray* _array;
+    private readonly string[] _names;
+    private readonly string[] _formats;
+    private readonly long _length;
+    private int _disposeState = 0;
+
+    private DbnArrowBatch(CArrowSchema* schema, CArrowArray* array)
+    {
+        _schema = schema;
+        _array = array;
+        _length = array->Length;
+        _names = new string[schema->NChildren];
+        _formats = new string[schema->NChildren];
+        for (int i = 0; i < _names.Length; i++)
+        {
+            _names[i] = Marshal.PtrToStringUTF8((IntPtr)schema->Children[i]->Name) ?? string.Empty;
+            _formats[i] = Marshal.PtrToStringUTF8((IntPtr)schema->Children[i]->Format) ?? string.Empty;
+        }
+    }
+
+    ~DbnArrowBatch()
+    {
+        Release();
+    }
+
+    /// <summary>
+    /// Run a native export into freshly allocated Arrow structs
+    /// </summary>
+    /// <returns>The native result code; <paramref name="batch"/> is set only when it is 0</returns>
+    internal static int Export(ExportCallback export, out DbnArrowBatch? batch)
+    {
+        var schema = (CArrowSchema*)NativeMemory.AllocZeroed((nuint)sizeof(CArrowSchema));
+        var array = (CArrowArray*)NativeMemory.AllocZeroed((nuint)sizeof(CArrowArray));
+        int result;
+        try
+        {
+            result = export(schema, array);
+        }
+        catch
+        {
+            NativeMemory.Free(schema);
+            NativeMemory.Free(array);
+            throw;
+        }
+
+        if (result != 0)
+        {
+            NativeMemory.Free(schema);
+            NativeMemory.Free(array);
+            batch = null;
+            return result;
+        }
+        batch = new DbnArrowBatch(schema, array);
+        return 0;
+    }
+
+    /// <summary>
+    /// Number of rows
+    /// </summary>
+    public long RowCount => _length;
+
+    /// <summary>
+    /// Field names, in column order
+    /// </summary>
+    public IReadOnlyList<string> ColumnNames => _names;
+
+    /// <summary>
+    /// Arrow format string of a column (e.g. "l" for int64, "tsn:UTC" for timestamps, "u" for strings)
+    /// </summary>
+    public string GetArrowFormat(int column) => _formats[column];
+
+    /// <summary>
+    /// Pointer to the <c>struct ArrowSchema</c> describing the batch
+    /// </summary>
+    public IntPtr ArrowSchemaPointer
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            return (IntPtr)_schema;
+        }
+    }
+
+    /// <summary>
+    /// Pointer to the <c>struct ArrowArray</c> holding the batch
+    /// </summary>
+    public IntPtr ArrowArrayPointer
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            return (IntPtr)_array;
+        }
+    }
+
+    /// <summary>
+    /// Values of a column, read in place. String columns (action, side) return their
+    /// characters as bytes. The span is valid until the batch is disposed.
+    /// </summary>
+    /// <typeparam name="T">Element type matching the column (e.g. long for prices, ulong for timestamps)</typeparam>
+    /// <param name="column">Column index</param>
+    public ReadOnlySpan<T> GetColumn<T>(int column) where T : unmanaged
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(column);
+        ArgumentOutOfRangeException.ThrowIfGreaterThanOrEqual(column, _names.Length);
+        if (_array->Release == null)
+            throw new InvalidOperationException("The batch was moved to another Arrow implementation");
+
+        var format = _formats[column];
+        int width = format switch
+        {
+            "C" or "u" => 1,
+            "S" => 2,
+            "I" or "i" => 4,
+            _ => 8
+        };
+        if (sizeof(T) != width)
+            throw new ArgumentException($"Column '{_names[column]}' (format '{format}') has {width}-byte values", nameof(T));
+
+        var child = _array->Children[column];
+        var data = child->Buffers[format == "u" ? 2 : 1];
+        return new ReadOnlySpan<T>((T*)data + child->Offset, checked((int)child->Length));
+    }
+
+    /// <summary>
+    /// Values of a column by field name
+    /// </summary>
+    public ReadOnlySpan<T> GetColumn<T>(string name) where T : unmanaged
+    {
+        int column = Array.IndexOf(_names, name);
+        if (column < 0)
+            throw new ArgumentException($"No column named '{name}'", nameof(name));
+        return GetColumn<T>(column);
+    }
+
+    /// <summary>
+    /// Release the native buffers (unless they were imported elsewhere)
+    /// </summary>
+    public void Dispose()
+    {
+        Release();
+        GC.SuppressFinalize(this);
+    }
+
+    private void Release()
+    {
+        if (Interlocked.Exchange(ref _disposeState, 1) != 0)
+            return;
+
+        if (_array->Release != null)
+            _array->Release(_array);
+        if (_schema->Release != null)
+            _schema->Release(_schema);
+        NativeMemory.Free(_array);
+        NativeMemory.Free(_schema);
+        _array = null;
+        _schema = null;
+    }
+}
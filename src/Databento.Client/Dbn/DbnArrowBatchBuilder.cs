@@ -0,0 +1,126 @@
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Collects DBN records of one record type into native Arrow columns, so records from
+/// historical or live sources can be consumed as <see cref="DbnArrowBatch"/>es instead of
+/// one <see cref="Models.Record"/> object per record.
+/// </summary>
+/// <remarks>
+/// Fill it with <see cref="Append"/>, <see cref="Historical.HistoricalClient.GetRangeToArrowAsync"/>
+/// or <see cref="Live.LiveBlockingClient.FillArrowBatchAsync"/>, then take the rows with
+/// <see cref="Finish"/>. Appending and finishing may happen on different threads.
+/// </remarks>
+public sealed class DbnArrowBatchBuilder : IDisposable
+{
+    private readonly ArrowBuilderHandle _handle;
+    private int _disposeState = 0;
+
+    /// <summary>
+    /// Create a builder
+    /// </summary>
+    /// <param name="rtype">Record type to collect (e.g. 0x00 trades, 0x01 MBP-1, 0xA0 MBO); other records are skipped</param>
+    /// <param name="fields">Fields in column order, or null for every field of the record type</param>
+    public DbnArrowBatchBuilder(byte rtype, IReadOnlyList<string>? fields = null)
+    {
+        RType = rtype;
+        var fieldArray = fields is { Count: > 0 } ? fields.ToArray() : null;
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_arrow_builder_create(
+            rtype,
+            fieldArray,
+            (nuint)(fieldArray?.Length ?? 0),
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to create Arrow batch builder: {error}");
+        }
+        _handle = new ArrowBuilderHandle(handlePtr);
+    }
+
+    /// <summary>
+    /// Record type collected by this builder
+    /// </summary>
+    public byte RType { get; }
+
+    /// <summary>
+    /// Rows collected since the last <see cref="Finish"/>
+    /// </summary>
+    public long RowCount
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            return NativeMethods.dbento_arrow_builder_row_count(_handle);
+        }
+    }
+
+    internal ArrowBuilderHandle Handle
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            return _handle;
+        }
+    }
+
+    /// <summary>
+    /// Append whole DBN records laid out back to back
+    /// </summary>
+    /// <param name="records">Raw record bytes</param>
+    public unsafe void Append(ReadOnlySpan<byte> records)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        fixed (byte* ptr = records)
+        {
+            result = NativeMethods.dbento_arrow_builder_append(
+                _handle, ptr, (nuint)records.Length, errorBuffer, (nuint)errorBuffer.Length);
+        }
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to append records: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Take the collected rows as a batch (possibly empty) and start a new one
+    /// </summary>
+    public unsafe DbnArrowBatch Finish()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = DbnArrowBatch.Export(
+            (schema, array) => NativeMethods.dbento_arrow_builder_finish(
+                _handle, schema, array, errorBuffer, (nuint)errorBuffer.Length),
+            out var batch);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to finish Arrow batch: {error}", result);
+        }
+        return batch!;
+    }
+
+    /// <summary>
+    /// Destroy the builder (batches already taken stay valid)
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.Exchange(ref _disposeState, 1) != 0)
+            return;
+        _handle?.Dispose();
+    }
+}
@@ -0,0 +1,20 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Background write settings for <see cref="DbnFileWriter"/>.
+/// Writes only copy records into a native lock-free queue; a dedicated native thread writes
+/// them to the file, so disk latency does not stall the thread handling market data.
+/// </summary>
+public sealed class DbnBackgroundWriteOptions
+{
+    /// <summary>
+    /// Queue size in bytes. Writes block only while the queue is full.
+    /// 0 uses the native default of 16 MiB; the minimum is 64 KiB.
+    /// </summary>
+    public int QueueCapacity { get; set; } = 0;
+
+    /// <summary>
+    /// Default options (16 MiB queue).
+    /// </summary>
+    public static DbnBackgroundWriteOptions Default => new();
+}
@@ -0,0 +1,28 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Checkpoint settings for <see cref="DbnFileWriter"/>.
+/// As records are written, the file is periodically synced to the device and its durable
+/// length recorded in a <c>&lt;file&gt;.ckpt</c> sidecar. Disposing the writer removes the
+/// sidecar; if it is still there at startup, the writer did not shut down cleanly and the
+/// file should be repaired with <see cref="DbnFileWriter.Recover"/>.
+/// </summary>
+public sealed class DbnCheckpointOptions
+{
+    /// <summary>
+    /// Checkpoint at most this often, or null to not checkpoint by time.
+    /// Each checkpoint waits for the device, so very short intervals slow writing.
+    /// </summary>
+    public TimeSpan? Interval { get; set; } = TimeSpan.FromSeconds(1);
+
+    /// <summary>
+    /// Checkpoint after this many bytes of output (compressed bytes for zstd), or 0 to not
+    /// checkpoint by size
+    /// </summary>
+    public long IntervalBytes { get; set; } = 0;
+
+    /// <summary>
+    /// Default options (every second).
+    /// </summary>
+    public static DbnCheckpointOptions Default => new();
+}
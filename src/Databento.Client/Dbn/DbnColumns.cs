@@ -0,0 +1,116 @@
+using Databento.Client.Models;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Struct-of-arrays buffer for record fields projected from a DBN file
+/// </summary>
+/// <remarks>
+/// Holds one array per field, each sized to <see cref="Capacity"/>. Pass it to
+/// <see cref="DbnFileReader.ReadColumns"/> repeatedly to fill it batch by batch without
+/// further allocation. Prices are int64 fixed-point with 1e-9 units and timestamps are
+/// nanoseconds since the UNIX epoch, exactly as stored in the file.
+/// </remarks>
+public sealed class DbnColumns
+{
+    private readonly Dictionary<string, int> _fieldIndexes;
+    private readonly DbnFieldType[] _fieldTypes;
+
+    /// <summary>
+    /// Create column buffers for the given fields of records with the given rtype
+    /// </summary>
+    /// <param name="rtype">Record type to project</param>
+    /// <param name="fieldNames">Field names (DBN schema names; book levels as <c>bid_px_00</c> etc.)</param>
+    /// <param name="capacity">Rows per batch</param>
+    /// <exception cref="ArgumentException">If a field does not exist for the rtype</exception>
+    public DbnColumns(RType rtype, IEnumerable<string> fieldNames, int capacity = 65536)
+    {
+        ArgumentNullException.ThrowIfNull(fieldNames);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(capacity);
+
+        RType = rtype;
+        Capacity = capacity;
+        FieldNames = fieldNames.ToArray();
+
+        if (FieldNames.Count == 0)
+            throw new ArgumentException("At least one field is required", nameof(fieldNames));
+
+        _fieldIndexes = new Dictionary<string, int>(FieldNames.Count, StringComparer.Ordinal);
+        _fieldTypes = new DbnFieldType[FieldNames.Count];
+        Arrays = new Array[FieldNames.Count];
+
+        for (int i = 0; i < FieldNames.Count; i++)
+        {
+            string name = FieldNames[i];
+            int type = NativeMethods.dbento_dbn_field_type((byte)rtype, name);
+            if (type < 0)
+                throw new ArgumentException($"Record type {rtype} has no field '{name}'", nameof(fieldNames));
+            if (!_fieldIndexes.TryAdd(name, i))
+                throw new ArgumentException($"Duplicate field '{name}'", nameof(fieldNames));
+
+            _fieldTypes[i] = (DbnFieldType)type;
+            Arrays[i] = _fieldTypes[i] switch
+            {
+                DbnFieldType.UInt8 or DbnFieldType.Char => new byte[capacity],
+                DbnFieldType.UInt16 => new ushort[capacity],
+                DbnFieldType.UInt32 => new uint[capacity],
+                DbnFieldType.Int32 => new int[capacity],
+                DbnFieldType.UInt64 => new ulong[capacity],
+                _ => new long[capacity]
+            };
+        }
+    }
+
+    /// <summary>
+    /// Record type being projected
+    /// </summary>
+    public RType RType { get; }
+
+    /// <summary>
+    /// Projected field names, in column order
+    /// </summary>
+    public IReadOnlyList<string> FieldNames { get; }
+
+    /// <summary>
+    /// Maximum rows per batch
+    /// </summary>
+    public int Capacity { get; }
+
+    /// <summary>
+    /// Rows filled by the last <see cref="DbnFileReader.ReadColumns"/> call
+    /// </summary>
+    public int RowCount { get; internal set; }
+
+    internal Array[] Arrays { get; }
+
+    /// <summary>
+    /// Element type of a projected field
+    /// </summary>
+    public DbnFieldType GetFieldType(string fieldName) => _fieldTypes[IndexOf(fieldName)];
+
+    /// <summary>
+    /// Backing array of a column (length <see cref="Capacity"/>; only the first <see cref="RowCount"/> entries are valid)
+    /// </summary>
+    /// <typeparam name="T">Element type matching <see cref="GetFieldType"/></typeparam>
+    public T[] GetArray<T>(string fieldName) where T : unmanaged
+    {
+        var array = Arrays[IndexOf(fieldName)];
+        return array as T[]
+            ?? throw new InvalidCastException($"Field '{fieldName}' is {GetFieldType(fieldName)}, not {typeof(T).Name}");
+    }
+
+    /// <summary>
+    /// Valid rows of a column from the last batch
+    /// </summary>
+    /// <typeparam name="T">Element type matching <see cref="GetFieldType"/></typeparam>
+    public ReadOnlySpan<T> Get<T>(string fieldName) where T : unmanaged
+        => GetArray<T>(fieldName).AsSpan(0, RowCount);
+
+    private int IndexOf(string fieldName)
+    {
+        return _fieldIndexes.TryGetValue(fieldName, out int index)
+            ? index
+            : throw new KeyNotFoundException($"Field '{fieldName}' is not projected");
+    }
+}
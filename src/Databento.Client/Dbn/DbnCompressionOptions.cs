@@ -0,0 +1,34 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// zstd compression settings for <see cref="DbnFileWriter"/>.
+/// Output uses the zstd seekable format: independently decodable frames plus a seek table,
+/// readable by any zstd decoder and decoded frame-parallel by <see cref="DbnFileReader"/>.
+/// </summary>
+public sealed class DbnCompressionOptions
+{
+    /// <summary>
+    /// zstd compression level. Higher levels compress better but slower; negative levels
+    /// trade ratio for speed. Default is 3.
+    /// </summary>
+    public int Level { get; set; } = 3;
+
+    /// <summary>
+    /// Target uncompressed bytes per frame (frames are cut on record boundaries).
+    /// Smaller frames make seeks cheaper; larger frames compress slightly better.
+    /// 0 uses the native default of 1 MiB.
+    /// </summary>
+    public int FrameSize { get; set; } = 0;
+
+    /// <summary>
+    /// Threads compressing full frames in the background while records keep being written;
+    /// frames are written in order as they complete. 0 compresses on the writing thread.
+    /// Default is 1, which takes compression off the thread recording a live feed.
+    /// </summary>
+    public int WorkerThreads { get; set; } = 1;
+
+    /// <summary>
+    /// Default options (level 3, 1 MiB frames, one background compression thread).
+    /// </summary>
+    public static DbnCompressionOptions Default => new();
+}
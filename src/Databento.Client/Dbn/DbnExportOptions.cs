@@ -0,0 +1,46 @@
+using Databento.Client.Models;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Settings for converting DBN records to Arrow IPC or Parquet with <see cref="DbnFileReader.Export"/>.
+/// </summary>
+public sealed class DbnExportOptions
+{
+    /// <summary>
+    /// Output file format.
+    /// </summary>
+    public DbnExportFormat Format { get; set; } = DbnExportFormat.Parquet;
+
+    /// <summary>
+    /// Record type to export (e.g. 0x00 trades, 0x01 MBP-1, 0xA0 MBO). Records of other
+    /// types are skipped. Null uses the type of the first data record.
+    /// </summary>
+    public byte? RType { get; set; }
+
+    /// <summary>
+    /// Fields to export, in column order. Null or empty exports every field of the record type.
+    /// </summary>
+    public IReadOnlyList<string>? Fields { get; set; }
+
+    /// <summary>
+    /// Rows per row group (Parquet) or record batch (Arrow). 0 sizes row groups to about
+    /// 64 MiB of values.
+    /// </summary>
+    public int RowGroupSize { get; set; } = 0;
+
+    /// <summary>
+    /// Column compression.
+    /// </summary>
+    public DbnExportCompression Compression { get; set; } = DbnExportCompression.Zstd;
+
+    /// <summary>
+    /// Threads encoding and compressing row groups in parallel. 0 uses the native default.
+    /// </summary>
+    public int ThreadCount { get; set; } = 0;
+
+    /// <summary>
+    /// Default options (zstd-compressed Parquet, every field, automatic row groups).
+    /// </summary>
+    public static DbnExportOptions Default => new();
+}
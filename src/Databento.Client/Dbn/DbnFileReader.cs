@@ -1,3 +1,4 @@
+using System.Buffers;
 using System.Runtime.CompilerServices;
 using System.Runtime.InteropServices;
 using System.Text.Json;
@@ -15,6 +16,9 @@ namespace Databento.Client.Dbn;
 public sealed class DbnFileReader : IDbnFileReader
 {
     private readonly DbnFileReaderHandle _handle;
+    // Kept alive for readers over caller memory or descriptors (see FromMemory/FromHandle)
+    private MemoryHandle _pin;
+    private SafeHandle? _descriptorOwner;
     private DbnMetadata? _cachedMetadata;
     // MEDIUM FIX: Use atomic int for disposal state (0=active, 1=disposing, 2=disposed)
     private int _disposeState = 0;
@@ -26,6 +30,49 @@ public sealed class DbnFileReader : IDbnFileReader
     /// <exception cref="FileNotFoundException">If the file does not exist</exception>
     /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
     public DbnFileReader(string filePath)
+        : this(filePath, memoryMapped: false)
+    {
+    }
+
+    /// <summary>
+    /// Open a DBN file for reading, optionally memory-mapped
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="memoryMapped">
+    /// Read uncompressed DBN files in place through a memory mapping instead of buffered reads.
+    /// zstd-compressed files and files needing a DBN version upgrade fall back to buffered reading.
+    /// </param>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
+    public DbnFileReader(string filePath, bool memoryMapped)
+        : this(filePath, errorBuffer => memoryMapped
+            ? NativeMethods.dbento_dbn_file_open_mapped(filePath, errorBuffer, (nuint)errorBuffer.Length)
+            : NativeMethods.dbento_dbn_file_open(filePath, errorBuffer, (nuint)errorBuffer.Length))
+    {
+    }
+
+    /// <summary>
+    /// Open a DBN file for reading with background read-ahead
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="prefetch">
+    /// Read-ahead settings. A background thread reads (and for zstd files, decompresses) the next
+    /// blocks while records are processed, which keeps cold-cache and network-storage reads off
+    /// the consumer's path.
+    /// </param>
+    /// <exception cref="FileNotFoundException">If the file does not exist</exception>
+    /// <exception cref="DbentoException">If the file cannot be opened or is invalid</exception>
+    public DbnFileReader(string filePath, DbnPrefetchOptions prefetch)
+        : this(filePath, errorBuffer => NativeMethods.dbento_dbn_file_open_prefetch(
+            filePath,
+            (nuint)ValidatePrefetch(prefetch).BlockSize,
+            (nuint)prefetch.BlockCount,
+            errorBuffer,
+            (nuint)errorBuffer.Length))
+    {
+    }
+
+    private DbnFileReader(string filePath, Func<byte[], IntPtr> open)
     {
         if (string.IsNullOrWhiteSpace(filePath))
             throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
@@ -33,12 +80,27 @@ public sealed class DbnFileReader : IDbnFileReader
         if (!File.Exists(filePath))
             throw new FileNotFoundException($"DBN file not found: {filePath}", filePath);
 
+        _handle = OpenHandle(open);
+    }
+
+    private DbnFileReader(DbnFileReaderHandle handle)
+    {
+        _handle = handle;
+    }
+
+    private static DbnPrefetchOptions ValidatePrefetch(DbnPrefetchOptions prefetch)
+    {
+        ArgumentNullException.ThrowIfNull(prefetch);
+        ArgumentOutOfRangeException.ThrowIfNegative(prefetch.BlockSize, nameof(prefetch.BlockSize));
+        ArgumentOutOfRangeException.ThrowIfNegative(prefetch.BlockCount, nameof(prefetch.BlockCount));
+        return prefetch;
+    }
+
+    private static DbnFileReaderHandle OpenHandle(Func<byte[], IntPtr> open)
+    {
         // MEDIUM FIX: Increased from 512 to 2048 for full error context
         byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
-        var handlePtr = NativeMethods.dbento_dbn_file_open(
-            filePath,
-            errorBuffer,
-            (nuint)errorBuffer.Length);
+        var handlePtr = open(errorBuffer);
 
         if (handlePtr == IntPtr.Zero)
         {
@@ -47,7 +109,422 @@ public sealed class DbnFileReader : IDbnFileReader
             throw new DbentoException($"Failed to open DBN file: {error}");
         }
 
-        _handle = new DbnFileReaderHandle(handlePtr);
+        return new DbnFileReaderHandle(handlePtr);
+    }
+
+    /// <summary>
+    /// Read DBN data already in memory (uncompressed or zstd, including the metadata header),
+    /// without writing it to a file first. The bytes are copied.
+    /// </summary>
+    /// <param name="data">DBN bytes</param>
+    /// <exception cref="DbentoException">If the data is not valid DBN</exception>
+    public static DbnFileReader FromMemory(ReadOnlySpan<byte> data)
+    {
+        unsafe
+        {
+            fixed (byte* ptr = data)
+            {
+                nint address = (nint)ptr;
+                int length = data.Length;
+                return new DbnFileReader(OpenHandle(errorBuffer => NativeMethods.dbento_dbn_file_open_memory(
+                    (byte*)address, (nuint)length, 1, errorBuffer, (nuint)errorBuffer.Length)));
+            }
+        }
+    }
+
+    /// <summary>
+    /// Read DBN data already in memory, optionally in place
+    /// </summary>
+    /// <param name="data">DBN bytes</param>
+    /// <param name="copy">
+    /// False to read the buffer in place: it stays pinned until the reader is disposed and must
+    /// not be modified meanwhile. Uncompressed data is then decoded with no copy at all.
+    /// </param>
+    /// <exception cref="DbentoException">If the data is not valid DBN</exception>
+    public static DbnFileReader FromMemory(ReadOnlyMemory<byte> data, bool copy)
+    {
+        if (copy)
+            return FromMemory(data.Span);
+
+        var pin = data.Pin();
+        try
+        {
+            DbnFileReaderHandle handle;
+            unsafe
+            {
+                nint address = (nint)pin.Pointer;
+                int length = data.Length;
+                handle = OpenHandle(errorBuffer => NativeMethods.dbento_dbn_file_open_memory(
+                    (byte*)address, (nuint)length, 0, errorBuffer, (nuint)errorBuffer.Length));
+            }
+            return new DbnFileReader(handle) { _pin = pin };
+        }
+        catch
+        {
+            pin.Dispose();
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Read DBN data from an open file or pipe handle, e.g. the read end of a pipe another
+    /// process writes DBN to. Regular files are memory-mapped and read from the start; pipes
+    /// are decoded as data arrives and can only be read forward.
+    /// </summary>
+    /// <param name="handle">
+    /// A <see cref="Microsoft.Win32.SafeHandles.SafeFileHandle"/> or
+    /// <see cref="Microsoft.Win32.SafeHandles.SafePipeHandle"/>. The reader keeps it alive until
+    /// disposed but does not close it; do not read from it while the reader is in use.
+    /// </param>
+    /// <exception cref="DbentoException">If the handle cannot be read or the data is not valid DBN</exception>
+    public static DbnFileReader FromHandle(SafeHandle handle)
+    {
+        ArgumentNullException.ThrowIfNull(handle);
+        if (handle.IsInvalid || handle.IsClosed)
+            throw new ArgumentException("Handle is invalid or closed", nameof(handle));
+
+        bool addedRef = false;
+        try
+        {
+            handle.DangerousAddRef(ref addedRef);
+            var descriptor = handle.DangerousGetHandle();
+            var readerHandle = OpenHandle(errorBuffer => NativeMethods.dbento_dbn_file_open_descriptor(
+                descriptor, errorBuffer, (nuint)errorBuffer.Length));
+            return new DbnFileReader(readerHandle) { _descriptorOwner = handle };
+        }
+        catch
+        {
+            if (addedRef)
+                handle.DangerousRelease();
+            throw;
+        }
+    }
+
+    /// <summary>
+    /// Read DBN data from a stream without a temporary file: file and pipe streams are read
+    /// natively through their handle (see <see cref="FromHandle"/>), and the remaining bytes
+    /// of a <see cref="MemoryStream"/> are copied. Do not read from a file or pipe stream
+    /// while the reader is in use: the reader bypasses the stream and its buffer.
+    /// </summary>
+    /// <param name="stream">
+    /// Stream positioned at the DBN metadata header. A <see cref="FileStream"/> must be at
+    /// position 0, since the whole file is mapped.
+    /// </param>
+    /// <exception cref="ArgumentException">If a file stream is not at position 0</exception>
+    /// <exception cref="NotSupportedException">For other stream types</exception>
+    public static DbnFileReader FromStream(Stream stream)
+    {
+        ArgumentNullException.ThrowIfNull(stream);
+        if (stream is FileStream { CanSeek: true, Position: not 0 })
+            throw new ArgumentException(
+                "File stream must be at position 0: the whole file is read from its handle", nameof(stream));
+        return stream switch
+        {
+            FileStream file => FromHandle(file.SafeFileHandle),
+            System.IO.Pipes.PipeStream pipe => FromHandle(pipe.SafePipeHandle),
+            MemoryStream memory when memory.TryGetBuffer(out var buffer) =>
+                FromMemory(buffer.AsSpan((int)memory.Position)),
+            _ => throw new NotSupportedException(
+                $"Cannot read DBN natively from {stream.GetType().Name}; use FromMemory with its contents")
+        };
+    }
+
+    /// <summary>
+    /// True if records are read in place from a memory mapping (see <see cref="DbnFileReader(string, bool)"/>)
+    /// </summary>
+    public bool IsMemoryMapped
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            return NativeMethods.dbento_dbn_file_is_mapped(_handle) == 1;
+        }
+    }
+
+    /// <summary>
+    /// Zero-based ordinal of the next record <see cref="ReadRecordsAsync"/> will return
+    /// </summary>
+    public long Position
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+            return NativeMethods.dbento_dbn_file_position(_handle);
+        }
+    }
+
+    /// <summary>
+    /// Build a sparse seek index (<c>&lt;filePath&gt;.dbnidx</c>) for a DBN file.
+    /// Readers use it automatically for <see cref="SeekToOrdinal"/> and <see cref="SeekToTime"/>
+    /// until the DBN file changes.
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="interval">Records between checkpoints (0 = default of 4096)</param>
+    /// <param name="timestamp">Timestamp to index for time seeks</param>
+    /// <exception cref="DbentoException">If the file cannot be read or the index cannot be written</exception>
+    public static void BuildIndex(string filePath, int interval = 0, DbnIndexTimestamp timestamp = DbnIndexTimestamp.TsEvent)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+        ArgumentOutOfRangeException.ThrowIfNegative(interval);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_build_index(
+            filePath, (uint)interval, (int)timestamp, errorBuffer, (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to build DBN index: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Load the statistics and zone maps a <see cref="DbnFileWriter"/> saved alongside a DBN
+    /// file (see <see cref="DbnFileWriter.EnableIndex"/>)
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <returns>The statistics, or null if there are none or the file has changed since</returns>
+    public static DbnFileSummary? LoadStats(string filePath)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+
+        var statsPath = filePath + ".stats.json";
+        if (!File.Exists(statsPath) || !File.Exists(filePath))
+            return null;
+
+        var summary = JsonSerializer.Deserialize<DbnFileSummary>(File.ReadAllText(statsPath));
+        return summary?.SourceSize == new FileInfo(filePath).Length ? summary : null;
+    }
+
+    /// <summary>
+    /// Summarize a DBN file in one native pass: record counts per rtype, publisher and
+    /// instrument, timestamp ranges, out-of-order records and record sizes.
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <param name="threadCount">Worker threads (0 = hardware threads, capped at 8)</param>
+    public static DbnFileSummary Summarize(string filePath, int threadCount = 0)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+        return Summarize(new[] { filePath }, threadCount);
+    }
+
+    /// <summary>
+    /// Summarize several DBN files in one native pass. Each file is split into chunks that
+    /// are scanned on worker threads; the counts are combined across files, and
+    /// out-of-order records are counted within each file.
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="threadCount">Worker threads (0 = hardware threads, capped at 8)</param>
+    /// <exception cref="DbentoException">If a file cannot be read</exception>
+    public static DbnFileSummary Summarize(IReadOnlyList<string> filePaths, int threadCount = 0)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        if (filePaths.Count == 0)
+            throw new ArgumentException("At least one file path is required", nameof(filePaths));
+        if (filePaths.Any(string.IsNullOrWhiteSpace))
+            throw new ArgumentException("File paths cannot be null or empty", nameof(filePaths));
+        ArgumentOutOfRangeException.ThrowIfNegative(threadCount);
+
+        var paths = filePaths.ToArray();
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var jsonPtr = NativeMethods.dbento_dbn_file_summarize(
+            paths, (nuint)paths.Length, threadCount, errorBuffer, (nuint)errorBuffer.Length);
+
+        if (jsonPtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to summarize DBN files: {error}");
+        }
+
+        try
+        {
+            var json = Marshal.PtrToStringUTF8(jsonPtr) ?? "{}";
+            return JsonSerializer.Deserialize<DbnFileSummary>(json)
+                ?? throw new DbentoException("Failed to deserialize DBN file summary");
+        }
+        finally
+        {
+            NativeMethods.dbento_free_string(jsonPtr);
+        }
+    }
+
+    /// <summary>
+    /// Position the reader so the next record read is record number <paramref name="ordinal"/>.
+    /// Seeking past the last record positions the reader at end of file.
+    /// </summary>
+    /// <param name="ordinal">Zero-based record number</param>
+    public void SeekToOrdinal(long ordinal)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(ordinal);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_seek_ordinal(
+            _handle, (ulong)ordinal, errorBuffer, (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to seek DBN file: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Position the reader at the first record whose timestamp is at or after <paramref name="time"/>
+    /// </summary>
+    /// <param name="time">Target time</param>
+    /// <param name="timestamp">Record timestamp to compare against</param>
+    public void SeekToTime(DateTimeOffset time, DbnIndexTimestamp timestamp = DbnIndexTimestamp.TsEvent)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        long nanos = Utilities.DateTimeHelpers.ToUnixNanos(time);
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_seek_time(
+            _handle, (ulong)Math.Max(nanos, 0), (int)timestamp, errorBuffer, (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to seek DBN file: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Decode the next batch of records of <see cref="DbnColumns.RType"/> straight into column arrays.
+    /// Records of other types are skipped. Reads from the current position, so a time or ordinal
+    /// range can be projected by seeking first.
+    /// </summary>
+    /// <param name="columns">Column buffers to fill (reusable across calls)</param>
+    /// <returns>Number of rows read (also stored in <see cref="DbnColumns.RowCount"/>); 0 at end of file</returns>
+    public int ReadColumns(DbnColumns columns)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentNullException.ThrowIfNull(columns);
+
+        var arrays = columns.Arrays;
+        var pins = new GCHandle[arrays.Length];
+        var pointers = new IntPtr[arrays.Length];
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        try
+        {
+            for (int i = 0; i < arrays.Length; i++)
+            {
+                pins[i] = GCHandle.Alloc(arrays[i], GCHandleType.Pinned);
+                pointers[i] = pins[i].AddrOfPinnedObject();
+            }
+
+            int result = NativeMethods.dbento_dbn_file_project(
+                _handle,
+                (byte)columns.RType,
+                columns.FieldNames.ToArray(),
+                (nuint)arrays.Length,
+                pointers,
+                (nuint)columns.Capacity,
+                out nuint rowCount,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+            if (result < 0)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw DbentoException.CreateFromErrorCode($"Failed to project DBN file: {error}", result);
+            }
+
+            columns.RowCount = result == 1 ? 0 : (int)rowCount;
+            return columns.RowCount;
+        }
+        finally
+        {
+            foreach (var pin in pins)
+            {
+                if (pin.IsAllocated)
+                    pin.Free();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Read up to <paramref name="maxRows"/> records of one record type into an Arrow batch in
+    /// native memory, without creating a managed object per record. Records of other types
+    /// are skipped.
+    /// </summary>
+    /// <param name="rtype">Record type to read (e.g. 0x00 trades, 0x01 MBP-1, 0xA0 MBO)</param>
+    /// <param name="maxRows">Maximum rows in the batch</param>
+    /// <param name="fields">Fields in column order, or null for every field of the record type</param>
+    /// <returns>The batch, or null at end of file</returns>
+    public unsafe DbnArrowBatch? ReadArrowBatch(byte rtype, int maxRows, IReadOnlyList<string>? fields = null)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxRows);
+
+        var fieldArray = fields is { Count: > 0 } ? fields.ToArray() : null;
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = DbnArrowBatch.Export(
+            (schema, array) => NativeMethods.dbento_dbn_file_read_arrow(
+                _handle,
+                rtype,
+                fieldArray,
+                (nuint)(fieldArray?.Length ?? 0),
+                (nuint)maxRows,
+                schema,
+                array,
+                errorBuffer,
+                (nuint)errorBuffer.Length),
+            out var batch);
+
+        if (result == 1)
+            return null;  // EOF
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to read Arrow batch: {error}", result);
+        }
+        return batch;
+    }
+
+    /// <summary>
+    /// Convert the remaining records to an Arrow IPC or Parquet file. Row groups are encoded
+    /// and compressed on native worker threads; prices stay 1e-9 fixed-point integers and
+    /// ts_* fields become UTC nanosecond timestamps. Reads from the current position, so a
+    /// time range can be exported by seeking first.
+    /// </summary>
+    /// <param name="outputPath">File to create (overwritten if it exists)</param>
+    /// <param name="options">Export settings, or null for <see cref="DbnExportOptions.Default"/></param>
+    /// <returns>Number of rows written</returns>
+    public long Export(string outputPath, DbnExportOptions? options = null)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentException.ThrowIfNullOrEmpty(outputPath);
+        options ??= DbnExportOptions.Default;
+        if (options.RowGroupSize < 0)
+            throw new ArgumentOutOfRangeException(nameof(options), "RowGroupSize cannot be negative");
+
+        var fields = options.Fields is { Count: > 0 } ? options.Fields.ToArray() : null;
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_export(
+            _handle,
+            outputPath,
+            (int)options.Format,
+            options.RType ?? -1,
+            fields,
+            (nuint)(fields?.Length ?? 0),
+            (nuint)options.RowGroupSize,
+            (int)options.Compression,
+            options.ThreadCount,
+            out ulong rowsWritten,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to export DBN file: {error}", result);
+        }
+        return (long)rowsWritten;
     }
 
     /// <summary>
@@ -99,10 +576,11 @@ public sealed class DbnFileReader : IDbnFileReader
     {
         ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
 
-        // Use a reasonably large buffer for records
-        byte[] recordBuffer = new byte[Utilities.Constants.RecordBufferSize];
         // Error buffer for native calls
         byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        // Records are fetched in batches: one native call fills the buffer with many records
+        byte[] batchBuffer = new byte[Utilities.Constants.RecordBatchBufferSize];
+        nuint[] recordOffsets = new nuint[Utilities.Constants.RecordBatchMaxRecords];
 
         await Task.Yield(); // Make it properly async
 
@@ -111,12 +589,13 @@ public sealed class DbnFileReader : IDbnFileReader
 
         while (!cancellationToken.IsCancellationRequested)
         {
-            int result = NativeMethods.dbento_dbn_file_next_record(
+            int result = NativeMethods.dbento_dbn_file_next_records(
                 _handle,
-                recordBuffer,
-                (nuint)recordBuffer.Length,
-                out nuint recordLength,
-                out byte recordType,
+                batchBuffer,
+                (nuint)batchBuffer.Length,
+                recordOffsets,
+                (nuint)recordOffsets.Length,
+                out nuint recordCount,
                 errorBuffer,
                 (nuint)errorBuffer.Length);
 
@@ -135,11 +614,13 @@ public sealed class DbnFileReader : IDbnFileReader
                 throw new DbentoException($"Error reading DBN file record #{recordNumber}: {error}");
             }
 
-            // Success - parse the record
-            if (recordLength > 0)
+            for (int i = 0; i < (int)recordCount; i++)
             {
-                byte[] recordBytes = new byte[recordLength];
-                Array.Copy(recordBuffer, recordBytes, (int)recordLength);
+                // DBN record header: length in 32-bit words, then rtype
+                int offset = (int)recordOffsets[i];
+                int recordLength = batchBuffer[offset] * 4;
+                byte recordType = batchBuffer[offset + 1];
+                byte[] recordBytes = batchBuffer.AsSpan(offset, recordLength).ToArray();
 
                 // MEDIUM FIX: Wrap deserialization to provide better error context
                 Record record;
@@ -155,10 +636,10 @@ public sealed class DbnFileReader : IDbnFileReader
 
                 recordNumber++;
                 yield return record;
-            }
 
-            // Allow cancellation between records
-            cancellationToken.ThrowIfCancellationRequested();
+                // Allow cancellation between records
+                cancellationToken.ThrowIfCancellationRequested();
+            }
         }
     }
 
@@ -173,6 +654,8 @@ public sealed class DbnFileReader : IDbnFileReader
             return;
 
         _handle?.Dispose();
+        _pin.Dispose();
+        _descriptorOwner?.DangerousRelease();
 
         // Mark as fully disposed
         Interlocked.Exchange(ref _disposeState, 2);
@@ -0,0 +1,223 @@
+using System.Text.Json.Serialization;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Record statistics of one or more DBN files (see <see cref="DbnFileReader.Summarize(IReadOnlyList{string}, int)"/>)
+/// </summary>
+public sealed class DbnFileSummary
+{
+    /// <summary>
+    /// Number of files scanned
+    /// </summary>
+    [JsonPropertyName("files")]
+    public required long Files { get; init; }
+
+    /// <summary>
+    /// Total number of records
+    /// </summary>
+    [JsonPropertyName("record_count")]
+    public required long RecordCount { get; init; }
+
+    /// <summary>
+    /// Total size of the records in bytes (uncompressed, metadata excluded)
+    /// </summary>
+    [JsonPropertyName("total_bytes")]
+    public required long TotalBytes { get; init; }
+
+    /// <summary>
+    /// Earliest and latest ts_event, or null without records
+    /// </summary>
+    [JsonPropertyName("ts_event")]
+    public DbnTimestampRange? TsEvent { get; init; }
+
+    /// <summary>
+    /// Earliest and latest ts_recv, or null if no record carries one (e.g. OHLCV only)
+    /// </summary>
+    [JsonPropertyName("ts_recv")]
+    public DbnTimestampRange? TsRecv { get; init; }
+
+    /// <summary>
+    /// Records whose ts_recv (ts_event if absent) is earlier than that of the previous
+    /// record in the same file
+    /// </summary>
+    [JsonPropertyName("out_of_order")]
+    public required long OutOfOrder { get; init; }
+
+    /// <summary>
+    /// Record and byte counts per record type
+    /// </summary>
+    [JsonPropertyName("rtypes")]
+    public required IReadOnlyList<DbnRTypeCount> RTypes { get; init; }
+
+    /// <summary>
+    /// Record counts per record length in bytes
+    /// </summary>
+    [JsonPropertyName("record_sizes")]
+    public required IReadOnlyList<DbnRecordSizeCount> RecordSizes { get; init; }
+
+    /// <summary>
+    /// Record counts per publisher ID
+    /// </summary>
+    [JsonPropertyName("publishers")]
+    public required IReadOnlyList<DbnPublisherCount> Publishers { get; init; }
+
+    /// <summary>
+    /// Record counts per instrument ID
+    /// </summary>
+    [JsonPropertyName("instruments")]
+    public required IReadOnlyList<DbnInstrumentCount> Instruments { get; init; }
+
+    /// <summary>
+    /// Size of the DBN file the statistics were written with; only set for statistics
+    /// saved by <see cref="DbnFileWriter.EnableIndex"/>
+    /// </summary>
+    [JsonPropertyName("source_size")]
+    public long? SourceSize { get; init; }
+
+    /// <summary>
+    /// Timestamp the zone time ranges use ("ts_event" or "ts_recv"); only set for saved statistics
+    /// </summary>
+    [JsonPropertyName("zone_timestamp")]
+    public string? ZoneTimestamp { get; init; }
+
+    /// <summary>
+    /// Where each instrument's records lie in the file, sorted by instrument ID; only set for
+    /// saved statistics
+    /// </summary>
+    [JsonPropertyName("zones")]
+    public IReadOnlyList<DbnInstrumentZone>? Zones { get; init; }
+}
+
+/// <summary>
+/// Zone map entry: the records of one instrument in one file
+/// </summary>
+public sealed class DbnInstrumentZone
+{
+    /// <summary>
+    /// Instrument ID
+    /// </summary>
+    [JsonPropertyName("instrument_id")]
+    public required uint InstrumentId { get; init; }
+
+    /// <summary>
+    /// Number of records
+    /// </summary>
+    [JsonPropertyName("count")]
+    public required long Count { get; init; }
+
+    /// <summary>
+    /// Zero-based record number of the instrument's first record
+    /// (see <see cref="DbnFileReader.SeekToOrdinal"/>)
+    /// </summary>
+    [JsonPropertyName("first_ordinal")]
+    public required long FirstOrdinal { get; init; }
+
+    /// <summary>
+    /// Zero-based record number of the instrument's last record
+    /// </summary>
+    [JsonPropertyName("last_ordinal")]
+    public required long LastOrdinal { get; init; }
+
+    /// <summary>
+    /// Earliest and latest timestamp of the instrument's records
+    /// </summary>
+    [JsonPropertyName("ts")]
+    public required DbnTimestampRange Ts { get; init; }
+}
+
+/// <summary>
+/// Minimum and maximum of a timestamp field (UNIX nanoseconds)
+/// </summary>
+public sealed class DbnTimestampRange
+{
+    /// <summary>
+    /// Earliest timestamp
+    /// </summary>
+    [JsonPropertyName("min")]
+    public required ulong Min { get; init; }
+
+    /// <summary>
+    /// Latest timestamp
+    /// </summary>
+    [JsonPropertyName("max")]
+    public required ulong Max { get; init; }
+}
+
+/// <summary>
+/// Records of one record type
+/// </summary>
+public sealed class DbnRTypeCount
+{
+    /// <summary>
+    /// Record type (e.g. 0x00 trades, 0xA0 MBO)
+    /// </summary>
+    [JsonPropertyName("rtype")]
+    public required byte RType { get; init; }
+
+    /// <summary>
+    /// Number of records
+    /// </summary>
+    [JsonPropertyName("count")]
+    public required long Count { get; init; }
+
+    /// <summary>
+    /// Size of those records in bytes
+    /// </summary>
+    [JsonPropertyName("bytes")]
+    public required long Bytes { get; init; }
+}
+
+/// <summary>
+/// Records of one length
+/// </summary>
+public sealed class DbnRecordSizeCount
+{
+    /// <summary>
+    /// Record length in bytes
+    /// </summary>
+    [JsonPropertyName("length")]
+    public required int Length { get; init; }
+
+    /// <summary>
+    /// Number of records
+    /// </summary>
+    [JsonPropertyName("count")]
+    public required long Count { get; init; }
+}
+
+/// <summary>
+/// Records of one publisher
+/// </summary>
+public sealed class DbnPublisherCount
+{
+    /// <summary>
+    /// Publisher ID
+    /// </summary>
+    [JsonPropertyName("publisher_id")]
+    public required ushort PublisherId { get; init; }
+
+    /// <summary>
+    /// Number of records
+    /// </summary>
+    [JsonPropertyName("count")]
+    public required long Count { get; init; }
+}
+
+/// <summary>
+/// Records of one instrument
+/// </summary>
+public sealed class DbnInstrumentCount
+{
+    /// <summary>
+    /// Instrument ID
+    /// </summary>
+    [JsonPropertyName("instrument_id")]
+    public required uint InstrumentId { get; init; }
+
+    /// <summary>
+    /// Number of records
+    /// </summary>
+    [JsonPropertyName("count")]
+    public required long Count { get; init; }
+}
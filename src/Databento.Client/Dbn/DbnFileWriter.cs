@@ -1,3 +1,4 @@
+using System.Buffers;
 using System.Runtime.InteropServices;
 using System.Text.Json;
 using Databento.Client.Models;
@@ -26,11 +27,77 @@ public sealed class DbnFileWriter : IDbnFileWriter
     /// <exception cref="ArgumentException">If file path or metadata is invalid</exception>
     /// <exception cref="DbentoException">If the file cannot be created</exception>
     public DbnFileWriter(string filePath, DbnMetadata metadata)
+        : this(filePath, metadata, compression: null)
+    {
+    }
+
+    /// <summary>
+    /// Create a new DBN file writer, optionally zstd-compressed in the seekable format
+    /// </summary>
+    /// <param name="filePath">Path where the DBN file will be created (conventionally <c>.dbn.zst</c> when compressed)</param>
+    /// <param name="metadata">Metadata for the DBN file</param>
+    /// <param name="compression">Compression settings, or null to write uncompressed DBN</param>
+    /// <exception cref="ArgumentException">If file path or metadata is invalid</exception>
+    /// <exception cref="DbentoException">If the file cannot be created</exception>
+    public DbnFileWriter(string filePath, DbnMetadata metadata, DbnCompressionOptions? compression)
+        : this(filePath, metadata, compression, background: null)
+    {
+    }
+
+    /// <summary>
+    /// Create a new DBN file writer, optionally compressed and optionally writing on a
+    /// background thread
+    /// </summary>
+    /// <param name="filePath">Path where the DBN file will be created (conventionally <c>.dbn.zst</c> when compressed)</param>
+    /// <param name="metadata">Metadata for the DBN file</param>
+    /// <param name="compression">Compression settings, or null to write uncompressed DBN</param>
+    /// <param name="background">
+    /// Background write settings, or null to write on the calling thread. In background mode
+    /// write errors surface on a later write or <see cref="Flush(bool)"/>; flush with
+    /// <c>durable: true</c> before disposing to observe them.
+    /// </param>
+    /// <exception cref="ArgumentException">If file path or metadata is invalid</exception>
+    /// <exception cref="DbentoException">If the file cannot be created</exception>
+    public DbnFileWriter(string filePath, DbnMetadata metadata, DbnCompressionOptions? compression,
+        DbnBackgroundWriteOptions? background)
+        : this(filePath, metadata, compression, background, checkpoints: null)
+    {
+    }
+
+    /// <summary>
+    /// Create a new DBN file writer that checkpoints for crash recovery, optionally compressed
+    /// and optionally writing on a background thread
+    /// </summary>
+    /// <param name="filePath">Path where the DBN file will be created (conventionally <c>.dbn.zst</c> when compressed)</param>
+    /// <param name="metadata">Metadata for the DBN file</param>
+    /// <param name="compression">Compression settings, or null to write uncompressed DBN</param>
+    /// <param name="background">Background write settings, or null to write on the calling thread</param>
+    /// <param name="checkpoints">
+    /// Checkpoint settings, or null for no checkpoints. After an unclean shutdown, repair the
+    /// file with <see cref="Recover"/>.
+    /// </param>
+    /// <exception cref="ArgumentException">If file path or metadata is invalid</exception>
+    /// <exception cref="DbentoException">If the file cannot be created</exception>
+    public DbnFileWriter(string filePath, DbnMetadata metadata, DbnCompressionOptions? compression,
+        DbnBackgroundWriteOptions? background, DbnCheckpointOptions? checkpoints)
     {
         if (string.IsNullOrWhiteSpace(filePath))
             throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
 
         ArgumentNullException.ThrowIfNull(metadata);
+        if (background != null)
+            ArgumentOutOfRangeException.ThrowIfNegative(background.QueueCapacity, nameof(background.QueueCapacity));
+        if (compression != null)
+        {
+            ArgumentOutOfRangeException.ThrowIfNegative(compression.FrameSize, nameof(compression.FrameSize));
+            ArgumentOutOfRangeException.ThrowIfNegative(compression.WorkerThreads, nameof(compression.WorkerThreads));
+        }
+        if (checkpoints != null)
+        {
+            ArgumentOutOfRangeException.ThrowIfNegative(checkpoints.IntervalBytes, nameof(checkpoints.IntervalBytes));
+            if (checkpoints.Interval is { } interval && interval <= TimeSpan.Zero)
+                throw new ArgumentOutOfRangeException(nameof(checkpoints), "Checkpoint interval must be positive");
+        }
 
         _filePath = filePath;
 
@@ -39,11 +106,20 @@ public sealed class DbnFileWriter : IDbnFileWriter
 
         // MEDIUM FIX: Increased from 512 to 2048 for full error context
         byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
-        var handlePtr = NativeMethods.dbento_dbn_file_create(
-            filePath,
-            metadataJson,
-            errorBuffer,
-            (nuint)errorBuffer.Length);
+        var handlePtr = compression == null
+            ? NativeMethods.dbento_dbn_file_create(
+                filePath,
+                metadataJson,
+                errorBuffer,
+                (nuint)errorBuffer.Length)
+            : NativeMethods.dbento_dbn_file_create_seekable(
+                filePath,
+                metadataJson,
+                compression.Level,
+                (nuint)compression.FrameSize,
+                compression.WorkerThreads,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
 
         if (handlePtr == IntPtr.Zero)
         {
@@ -53,6 +129,173 @@ public sealed class DbnFileWriter : IDbnFileWriter
         }
 
         _handle = new DbnFileWriterHandle(handlePtr);
+
+        if (checkpoints != null)
+        {
+            ulong intervalMs = checkpoints.Interval is { } span ? (ulong)Math.Max(1, (long)span.TotalMilliseconds) : 0;
+            int result = NativeMethods.dbento_dbn_file_enable_checkpoints(
+                _handle, intervalMs, (ulong)checkpoints.IntervalBytes, errorBuffer, (nuint)errorBuffer.Length);
+            if (result != 0)
+            {
+                _handle.Dispose();
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw new DbentoException($"Failed to enable DBN checkpoints: {error}");
+            }
+        }
+
+        if (background != null)
+        {
+            int result = NativeMethods.dbento_dbn_file_start_background(
+                _handle, (nuint)background.QueueCapacity, errorBuffer, (nuint)errorBuffer.Length);
+            if (result != 0)
+            {
+                _handle.Dispose();
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw new DbentoException($"Failed to start background DBN writer: {error}");
+            }
+        }
+    }
+
+    /// <summary>
+    /// Upgrade DBN v1/v2 files to the current DBN version, optionally recompressing them.
+    /// Files are processed in parallel natively; each output is written to a temporary file
+    /// and renamed into place, so a failed file leaves its original unchanged and does not
+    /// stop the others.
+    /// </summary>
+    /// <param name="inputPath">A DBN file, or a directory searched recursively for <c>.dbn</c> and <c>.dbn.zst</c> files</param>
+    /// <param name="options">Upgrade settings, or null for <see cref="DbnUpgradeOptions.Default"/></param>
+    /// <returns>File counts and the first failure, if any</returns>
+    /// <exception cref="ArgumentException">If the input path is invalid</exception>
+    /// <exception cref="DbentoException">If the input cannot be enumerated</exception>
+    public static DbnUpgradeResult UpgradeFiles(string inputPath, DbnUpgradeOptions? options = null)
+    {
+        if (string.IsNullOrWhiteSpace(inputPath))
+            throw new ArgumentException("Input path cannot be null or empty", nameof(inputPath));
+
+        options ??= DbnUpgradeOptions.Default;
+        ArgumentOutOfRangeException.ThrowIfNegative(options.ThreadCount, nameof(options.ThreadCount));
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_upgrade_files(
+            inputPath,
+            options.OutputDirectory,
+            (int)options.Compression,
+            options.CompressionLevel,
+            options.SkipCurrent ? 1 : 0,
+            options.ThreadCount,
+            out ulong upgraded,
+            out ulong skipped,
+            out ulong failed,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result < 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to upgrade DBN files: {error}", result);
+        }
+
+        return new DbnUpgradeResult
+        {
+            FilesUpgraded = (long)upgraded,
+            FilesSkipped = (long)skipped,
+            FilesFailed = (long)failed,
+            FirstError = result == 1 ? Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer) : null
+        };
+    }
+
+    /// <summary>
+    /// Split a DBN file into one file per instrument, publisher or hour, reading it once.
+    /// Outputs are written in parallel natively, each keeping the input's record order and
+    /// carrying its metadata narrowed to the partition: per-instrument files keep only the
+    /// symbol mappings of that instrument, per-hour files cover only their hour. On failure
+    /// the outputs written so far are removed.
+    /// </summary>
+    /// <param name="inputPath">DBN file to split (any DBN version or compression)</param>
+    /// <param name="key">Partitioning</param>
+    /// <param name="outputPattern">
+    /// Output path containing <c>{key}</c>, replaced by the instrument or publisher ID or by
+    /// the hour as <c>YYYYMMDDTHH</c>; a <c>.zst</c> suffix writes seekable zstd
+    /// (e.g. <c>out/{key}.dbn.zst</c>). Existing files are overwritten.
+    /// </param>
+    /// <param name="options">Split settings, or null for <see cref="DbnSplitOptions.Default"/></param>
+    /// <returns>Record and file counts</returns>
+    /// <exception cref="ArgumentException">If an argument is invalid</exception>
+    /// <exception cref="DbentoException">If the file cannot be split</exception>
+    public static DbnSplitResult Split(string inputPath, DbnSplitKey key, string outputPattern,
+        DbnSplitOptions? options = null)
+    {
+        if (string.IsNullOrWhiteSpace(inputPath))
+            throw new ArgumentException("Input path cannot be null or empty", nameof(inputPath));
+        if (string.IsNullOrWhiteSpace(outputPattern) || !outputPattern.Contains("{key}", StringComparison.Ordinal))
+            throw new ArgumentException("Output pattern must contain {key}", nameof(outputPattern));
+
+        options ??= DbnSplitOptions.Default;
+        ArgumentOutOfRangeException.ThrowIfNegative(options.ThreadCount, nameof(options.ThreadCount));
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_split(
+            inputPath,
+            (int)key,
+            outputPattern,
+            options.CompressionLevel,
+            options.ThreadCount,
+            out ulong records,
+            out ulong files,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to split DBN file: {error}", result);
+        }
+
+        return new DbnSplitResult
+        {
+            RecordCount = (long)records,
+            FileCount = (long)files
+        };
+    }
+
+    /// <summary>
+    /// Repair a DBN file (plain or seekable zstd) left by an unclean shutdown: truncate a torn
+    /// trailing record or frame, restore the zstd seek table and set the metadata end time
+    /// from the last record if it is unset. A cleanly closed file is left unchanged.
+    /// </summary>
+    /// <param name="filePath">Path to the DBN file</param>
+    /// <returns>What was kept and repaired</returns>
+    /// <exception cref="ArgumentException">If the file path is invalid</exception>
+    /// <exception cref="DbentoException">
+    /// If the file cannot be repaired, including when fewer records are intact than its last
+    /// checkpoint recorded (the file is then left unchanged)
+    /// </exception>
+    public static DbnRecoveryResult Recover(string filePath)
+    {
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_recover(
+            filePath,
+            out ulong records,
+            out ulong bytesTruncated,
+            out int endPatched,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to recover DBN file: {error}", result);
+        }
+
+        return new DbnRecoveryResult
+        {
+            RecordCount = (long)records,
+            BytesTruncated = (long)bytesTruncated,
+            EndTimePatched = endPatched != 0
+        };
     }
 
     /// <summary>
@@ -86,7 +329,8 @@ public sealed class DbnFileWriter : IDbnFileWriter
     }
 
     /// <summary>
-    /// Write multiple records to the DBN file
+    /// Write multiple records to the DBN file. Records are packed into a pooled buffer and
+    /// written in batches of about 64 KiB.
     /// </summary>
     /// <param name="records">Records to write</param>
     public void WriteRecords(IEnumerable<Record> records)
@@ -94,24 +338,162 @@ public sealed class DbnFileWriter : IDbnFileWriter
         ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
         ArgumentNullException.ThrowIfNull(records);
 
-        foreach (var record in records)
+        const int batchBytes = 64 * 1024;
+        byte[] buffer = ArrayPool<byte>.Shared.Rent(batchBytes);
+        try
+        {
+            int used = 0;
+            foreach (var record in records)
+            {
+                ArgumentNullException.ThrowIfNull(record, nameof(records));
+                var bytes = record.RawBytes;
+                if (bytes == null || bytes.Length == 0)
+                    throw new InvalidOperationException("Record does not have raw bytes available for writing. " +
+                        "Only records read from DBN files can be written.");
+
+                if (bytes.Length > buffer.Length - used)
+                {
+                    WriteRecords(buffer.AsSpan(0, used));
+                    used = 0;
+                    if (bytes.Length > buffer.Length)
+                    {
+                        WriteRecords(bytes);
+                        continue;
+                    }
+                }
+                bytes.CopyTo(buffer, used);
+                used += bytes.Length;
+            }
+            if (used > 0)
+                WriteRecords(buffer.AsSpan(0, used));
+        }
+        finally
+        {
+            ArrayPool<byte>.Shared.Return(buffer);
+        }
+    }
+
+    /// <summary>
+    /// Write whole DBN records laid out back to back in one native call, e.g. a batch
+    /// received from a live feed. Record lengths are checked first, so a truncated or
+    /// corrupt run writes nothing.
+    /// </summary>
+    /// <param name="records">Raw record bytes</param>
+    /// <returns>Number of records written</returns>
+    public unsafe int WriteRecords(ReadOnlySpan<byte> records)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        if (records.IsEmpty)
+            return 0;
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        nuint written;
+        fixed (byte* ptr = records)
+        {
+            result = NativeMethods.dbento_dbn_file_write_records(
+                _handle, ptr, (nuint)records.Length, out written, errorBuffer, (nuint)errorBuffer.Length);
+        }
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to write records to DBN file: {error}");
+        }
+        return (int)written;
+    }
+
+    /// <summary>
+    /// Flush buffered records to the operating system. Records are buffered natively
+    /// (about 1 MiB, or one zstd frame) and are otherwise written when the buffer fills
+    /// or the writer is disposed.
+    /// </summary>
+    public void Flush() => Flush(durable: false);
+
+    /// <summary>
+    /// Flush buffered records, in background mode after waiting for every queued record
+    /// to be written
+    /// </summary>
+    /// <param name="durable">Also wait until the data is on the device (fsync)</param>
+    /// <exception cref="DbentoException">If writing, including on the background thread, failed</exception>
+    public void Flush(bool durable)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_flush(
+            _handle, durable ? 1 : 0, errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to flush DBN file: {error}");
+        }
+    }
+
+    /// <summary>
+    /// Build the seek index (<c>&lt;filePath&gt;.dbnidx</c>) and record statistics with
+    /// per-instrument zone maps (<c>&lt;filePath&gt;.stats.json</c>) while writing, saved when
+    /// the writer is disposed, so freshly recorded files need no separate indexing pass.
+    /// Read the statistics with <see cref="DbnFileReader.LoadStats"/>.
+    /// </summary>
+    /// <param name="interval">Records between index checkpoints (0 = default of 4096)</param>
+    /// <param name="timestamp">Timestamp to index and to compute zone time ranges with</param>
+    /// <exception cref="DbentoException">If records have already been written</exception>
+    public void EnableIndex(int interval = 0, DbnIndexTimestamp timestamp = DbnIndexTimestamp.TsEvent)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentOutOfRangeException.ThrowIfNegative(interval);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_enable_index(
+            _handle, (uint)interval, (int)timestamp, errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
         {
-            WriteRecord(record);
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to enable DBN index: {error}", result);
         }
     }
 
     /// <summary>
-    /// Flush any buffered data to disk
+    /// Sync everything written so far to the device and record it in the checkpoint sidecar,
+    /// in background mode after waiting for every queued record to be written
     /// </summary>
-    public void Flush()
+    /// <exception cref="DbentoException">If syncing or writing the sidecar failed</exception>
+    public void Checkpoint()
     {
         ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
-        // The native layer automatically flushes on write
-        // This method is provided for API consistency
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_checkpoint(_handle, errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to checkpoint DBN file: {error}");
+        }
+    }
+
+    /// <summary>
+    /// Complete the file, reporting any error: write the buffered records (for zstd output,
+    /// the last frame and the seek table, which <see cref="Flush(bool)"/> does not write) and
+    /// save the enabled sidecars. Disposing also completes the file but cannot report errors.
+    /// Later writes fail.
+    /// </summary>
+    /// <exception cref="DbentoException">If completing the file failed (e.g. disk full); the file may be unreadable</exception>
+    public void Complete()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_file_finish(_handle, errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to complete DBN file: {error}");
+        }
     }
 
     /// <summary>
-    /// Dispose the file writer and finalize the file
+    /// Dispose the file writer and finalize the file (call <see cref="Complete"/> first to observe errors)
     /// </summary>
     public void Dispose()
     {
@@ -0,0 +1,63 @@
+using System.Text.Json.Serialization;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// One completed file in a <see cref="DbnRollingWriter"/> manifest
+/// </summary>
+public sealed class DbnManifestEntry
+{
+    /// <summary>
+    /// File name, relative to the output directory
+    /// </summary>
+    [JsonPropertyName("path")]
+    public required string Path { get; init; }
+
+    /// <summary>
+    /// Metadata start of the file (UNIX nanoseconds, inclusive)
+    /// </summary>
+    [JsonPropertyName("start")]
+    public required ulong Start { get; init; }
+
+    /// <summary>
+    /// Metadata end of the file (UNIX nanoseconds, exclusive)
+    /// </summary>
+    [JsonPropertyName("end")]
+    public required ulong End { get; init; }
+
+    /// <summary>
+    /// Earliest record timestamp, or null if no record carried one
+    /// </summary>
+    [JsonPropertyName("first_ts")]
+    public ulong? FirstTimestamp { get; init; }
+
+    /// <summary>
+    /// Latest record timestamp, or null if no record carried one
+    /// </summary>
+    [JsonPropertyName("last_ts")]
+    public ulong? LastTimestamp { get; init; }
+
+    /// <summary>
+    /// Number of records
+    /// </summary>
+    [JsonPropertyName("record_count")]
+    public required long RecordCount { get; init; }
+
+    /// <summary>
+    /// Uncompressed size of the records
+    /// </summary>
+    [JsonPropertyName("record_bytes")]
+    public required long RecordBytes { get; init; }
+
+    /// <summary>
+    /// Size of the file on disk
+    /// </summary>
+    [JsonPropertyName("file_size")]
+    public required long FileSize { get; init; }
+
+    /// <summary>
+    /// True if the file is seekable zstd
+    /// </summary>
+    [JsonPropertyName("compressed")]
+    public required bool Compressed { get; init; }
+}
@@ -0,0 +1,199 @@
+using System.Runtime.CompilerServices;
+using Databento.Client.Models;
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Reads several DBN files as one stream merged by timestamp
+/// </summary>
+/// <remarks>
+/// The merge runs natively over memory-mapped (or frame-parallel seekable zstd) readers and
+/// records are returned in batches, so merging N files costs one native call per batch rather
+/// than several per record. Each file must already be sorted by the merge timestamp; records
+/// with equal timestamps are returned in the order the files were given.
+/// </remarks>
+public sealed class DbnMergeReader : IDisposable, IAsyncDisposable
+{
+    private readonly DbnMergeReaderHandle _handle;
+    private readonly string[] _filePaths;
+    // Atomic disposal state (0=active, 1=disposing, 2=disposed)
+    private int _disposeState = 0;
+
+    /// <summary>
+    /// Open DBN files for a merged read
+    /// </summary>
+    /// <param name="filePaths">Paths to the DBN files</param>
+    /// <param name="mergeOn">Record timestamp to merge on (records without ts_recv use ts_event)</param>
+    /// <exception cref="FileNotFoundException">If a file does not exist</exception>
+    /// <exception cref="DbentoException">If a file cannot be opened or is invalid</exception>
+    public DbnMergeReader(IEnumerable<string> filePaths, DbnIndexTimestamp mergeOn = DbnIndexTimestamp.TsRecv)
+    {
+        ArgumentNullException.ThrowIfNull(filePaths);
+        _filePaths = filePaths.ToArray();
+
+        if (_filePaths.Length == 0)
+            throw new ArgumentException("At least one file path is required", nameof(filePaths));
+
+        foreach (var filePath in _filePaths)
+        {
+            if (string.IsNullOrWhiteSpace(filePath))
+                throw new ArgumentException("File path cannot be null or empty", nameof(filePaths));
+            if (!File.Exists(filePath))
+                throw new FileNotFoundException($"DBN file not found: {filePath}", filePath);
+        }
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_merge_open(
+            _filePaths, (nuint)_filePaths.Length, (int)mergeOn, errorBuffer, (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to open DBN files for merge: {error}");
+        }
+
+        _handle = new DbnMergeReaderHandle(handlePtr);
+    }
+
+    /// <summary>
+    /// Paths of the merged files, in the order given (indexes match <see cref="ReadRecordsWithSourceAsync"/>)
+    /// </summary>
+    public IReadOnlyList<string> FilePaths => _filePaths;
+
+    /// <summary>
+    /// Position every file at its first record whose merge timestamp is at or after <paramref name="time"/>
+    /// </summary>
+    /// <param name="time">Target time</param>
+    public void SeekToTime(DateTimeOffset time)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        long nanos = Utilities.DateTimeHelpers.ToUnixNanos(time);
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_merge_seek_time(
+            _handle, (ulong)Math.Max(nanos, 0), errorBuffer, (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to seek DBN merge: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Read the merged records as an async stream
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of records in timestamp order</returns>
+    public async IAsyncEnumerable<Record> ReadRecordsAsync(
+        [EnumeratorCancellation] CancellationToken cancellationToken = default)
+    {
+        await foreach (var (_, record) in ReadAsync(withSource: false, cancellationToken).ConfigureAwait(false))
+        {
+            yield return record;
+        }
+    }
+
+    /// <summary>
+    /// Read the merged records together with the index (into <see cref="FilePaths"/>) of the file each came from
+    /// </summary>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Async enumerable of (file index, record) pairs in timestamp order</returns>
+    public IAsyncEnumerable<(int FileIndex, Record Record)> ReadRecordsWithSourceAsync(
+        CancellationToken cancellationToken = default)
+    {
+        return ReadAsync(withSource: true, cancellationToken);
+    }
+
+    private async IAsyncEnumerable<(int FileIndex, Record Record)> ReadAsync(
+        bool withSource,
+        [EnumeratorCancellation] CancellationToken cancellationToken)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        byte[] batchBuffer = new byte[Utilities.Constants.RecordBatchBufferSize];
+        nuint[] recordOffsets = new nuint[Utilities.Constants.RecordBatchMaxRecords];
+        uint[]? sourceIndices = withSource ? new uint[Utilities.Constants.RecordBatchMaxRecords] : null;
+
+        await Task.Yield(); // Make it properly async
+
+        ulong recordNumber = 0;
+
+        while (!cancellationToken.IsCancellationRequested)
+        {
+            int result = NativeMethods.dbento_dbn_merge_next_records(
+                _handle,
+                batchBuffer,
+                (nuint)batchBuffer.Length,
+                recordOffsets,
+                sourceIndices,
+                (nuint)recordOffsets.Length,
+                out nuint recordCount,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+            if (result == 1)
+            {
+                // EOF reached on every file
+                yield break;
+            }
+
+            if (result < 0)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw new DbentoException($"Error reading merged DBN record #{recordNumber}: {error}");
+            }
+
+            for (int i = 0; i < (int)recordCount; i++)
+            {
+                // DBN record header: length in 32-bit words, then rtype
+                int offset = (int)recordOffsets[i];
+                int recordLength = batchBuffer[offset] * 4;
+                byte recordType = batchBuffer[offset + 1];
+                byte[] recordBytes = batchBuffer.AsSpan(offset, recordLength).ToArray();
+
+                Record record;
+                try
+                {
+                    record = Record.FromBytes(recordBytes, recordType);
+                }
+                catch (Exception ex)
+                {
+                    throw new DbentoException($"Error deserializing merged DBN record #{recordNumber}: {ex.Message}", ex);
+                }
+
+                recordNumber++;
+                yield return (sourceIndices != null ? (int)sourceIndices[i] : -1, record);
+
+                // Allow cancellation between records
+                cancellationToken.ThrowIfCancellationRequested();
+            }
+        }
+    }
+
+    /// <summary>
+    /// Dispose the merge reader and close all of its files
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 1, 0) != 0)
+            return;
+
+        _handle?.Dispose();
+
+        Interlocked.Exchange(ref _disposeState, 2);
+    }
+
+    /// <summary>
+    /// Asynchronously dispose the merge reader
+    /// </summary>
+    public ValueTask DisposeAsync()
+    {
+        Dispose();
+        return ValueTask.CompletedTask;
+    }
+}
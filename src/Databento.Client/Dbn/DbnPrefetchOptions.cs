@@ -0,0 +1,25 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Background read-ahead settings for <see cref="DbnFileReader"/>.
+/// Blocks are read (and for zstd files, decompressed) on a native thread ahead of the consumer.
+/// </summary>
+public sealed class DbnPrefetchOptions
+{
+    /// <summary>
+    /// Bytes per read-ahead block. Larger blocks mean fewer, bigger reads, which suits
+    /// high-latency storage such as NFS or EBS. 0 uses the native default of 1 MiB.
+    /// </summary>
+    public int BlockSize { get; set; } = 0;
+
+    /// <summary>
+    /// Blocks in flight, including the one being consumed (2 = double buffering,
+    /// 3 = triple buffering). 0 uses the native default of 3.
+    /// </summary>
+    public int BlockCount { get; set; } = 0;
+
+    /// <summary>
+    /// Default options (1 MiB blocks, triple buffering).
+    /// </summary>
+    public static DbnPrefetchOptions Default => new();
+}
@@ -0,0 +1,22 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Outcome of <see cref="DbnFileWriter.Recover"/>
+/// </summary>
+public sealed class DbnRecoveryResult
+{
+    /// <summary>
+    /// Whole records in the repaired file
+    /// </summary>
+    public required long RecordCount { get; init; }
+
+    /// <summary>
+    /// Bytes of torn trailing data removed (0 if the tail was intact)
+    /// </summary>
+    public required long BytesTruncated { get; init; }
+
+    /// <summary>
+    /// Whether the metadata end time was set from the last record
+    /// </summary>
+    public required bool EndTimePatched { get; init; }
+}
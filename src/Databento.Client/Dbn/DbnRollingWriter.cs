@@ -0,0 +1,305 @@
+using System.Buffers;
+using System.Text.Json;
+using Databento.Client.Models;
+using Databento.Client.Models.Dbn;
+using Databento.Interop;
+using Databento.Interop.Handles;
+using Databento.Interop.Native;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// DBN writer for long-running recorders that rolls over to a new file on time boundaries
+/// and at a size limit
+/// </summary>
+/// <remarks>
+/// Files are named <c>&lt;prefix&gt;-YYYYMMDDTHHMMSSZ-NNN.dbn[.zst]</c> and opened on their first
+/// record, so no record is dropped or reordered at a boundary. Each file's metadata start/end
+/// cover its range, and completed files are listed in a JSON-lines manifest
+/// (see <see cref="ReadManifest"/>). Not thread-safe: write from one thread at a time.
+/// </remarks>
+public sealed class DbnRollingWriter : IDisposable, IAsyncDisposable
+{
+    private readonly DbnRollingWriterHandle _handle;
+    private int _disposeState = 0;
+
+    /// <summary>
+    /// Create a rolling writer
+    /// </summary>
+    /// <param name="outputDirectory">Directory for the files (created if missing)</param>
+    /// <param name="filePrefix">File name prefix</param>
+    /// <param name="metadata">Metadata written to every file (start/end are set per file)</param>
+    /// <param name="options">Rotation settings, or null for <see cref="DbnRollingWriterOptions.Default"/></param>
+    /// <exception cref="ArgumentException">If an argument is invalid</exception>
+    /// <exception cref="DbentoException">If the writer cannot be created</exception>
+    public DbnRollingWriter(string outputDirectory, string filePrefix, DbnMetadata metadata,
+        DbnRollingWriterOptions? options = null)
+    {
+        if (string.IsNullOrWhiteSpace(outputDirectory))
+            throw new ArgumentException("Output directory cannot be null or empty", nameof(outputDirectory));
+        if (string.IsNullOrWhiteSpace(filePrefix))
+            throw new ArgumentException("File prefix cannot be null or empty", nameof(filePrefix));
+        ArgumentNullException.ThrowIfNull(metadata);
+
+        options ??= DbnRollingWriterOptions.Default;
+        ArgumentOutOfRangeException.ThrowIfNegative(options.MaxFileBytes, nameof(options.MaxFileBytes));
+        if (options.RotationInterval is { } interval && interval <= TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(options), "Rotation interval must be positive");
+        var compression = options.Compression;
+        if (compression != null)
+        {
+            ArgumentOutOfRangeException.ThrowIfNegative(compression.FrameSize, nameof(compression.FrameSize));
+            ArgumentOutOfRangeException.ThrowIfNegative(compression.WorkerThreads, nameof(compression.WorkerThreads));
+        }
+
+        ulong intervalNs = options.RotationInterval is { } span ? (ulong)span.Ticks * 100 : 0;
+        ulong offsetNs = 0;
+        if (intervalNs > 0)
+        {
+            long intervalTicks = options.RotationInterval!.Value.Ticks;
+            offsetNs = (ulong)(((options.RotationOffset.Ticks % intervalTicks) + intervalTicks) % intervalTicks) * 100;
+        }
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var handlePtr = NativeMethods.dbento_dbn_rolling_writer_create(
+            outputDirectory,
+            filePrefix,
+            JsonSerializer.Serialize(metadata),
+            intervalNs,
+            offsetNs,
+            (ulong)options.MaxFileBytes,
+            compression != null ? 1 : 0,
+            compression?.Level ?? 0,
+            (nuint)(compression?.FrameSize ?? 0),
+            compression?.WorkerThreads ?? 0,
+            options.ManifestPath,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (handlePtr == IntPtr.Zero)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to create rolling DBN writer: {error}");
+        }
+
+        _handle = new DbnRollingWriterHandle(handlePtr);
+    }
+
+    /// <summary>
+    /// Path of the file being written, or null between files
+    /// </summary>
+    public string? CurrentPath
+    {
+        get
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+            byte[] pathBuffer = new byte[4096];
+            byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+            int result = NativeMethods.dbento_dbn_rolling_writer_current_path(
+                _handle, pathBuffer, (nuint)pathBuffer.Length, errorBuffer, (nuint)errorBuffer.Length);
+            if (result != 0)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw DbentoException.CreateFromErrorCode($"Failed to get current file path: {error}", result);
+            }
+            var path = Utilities.ErrorBufferHelpers.SafeGetString(pathBuffer);
+            return path.Length == 0 ? null : path;
+        }
+    }
+
+    /// <summary>
+    /// Write a single record
+    /// </summary>
+    /// <param name="record">Record read from DBN data</param>
+    public void WriteRecord(Record record)
+    {
+        ArgumentNullException.ThrowIfNull(record);
+        if (record.RawBytes == null || record.RawBytes.Length == 0)
+            throw new InvalidOperationException("Record does not have raw bytes available for writing. " +
+                "Only records read from DBN files can be written.");
+        WriteRecords(record.RawBytes);
+    }
+
+    /// <summary>
+    /// Write multiple records, packed into a pooled buffer and written in batches
+    /// </summary>
+    /// <param name="records">Records to write</param>
+    public void WriteRecords(IEnumerable<Record> records)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentNullException.ThrowIfNull(records);
+
+        const int batchBytes = 64 * 1024;
+        byte[] buffer = ArrayPool<byte>.Shared.Rent(batchBytes);
+        try
+        {
+            int used = 0;
+            foreach (var record in records)
+            {
+                ArgumentNullException.ThrowIfNull(record, nameof(records));
+                var bytes = record.RawBytes;
+                if (bytes == null || bytes.Length == 0)
+                    throw new InvalidOperationException("Record does not have raw bytes available for writing. " +
+                        "Only records read from DBN files can be written.");
+
+                if (bytes.Length > buffer.Length - used)
+                {
+                    WriteRecords(buffer.AsSpan(0, used));
+                    used = 0;
+                    if (bytes.Length > buffer.Length)
+                    {
+                        WriteRecords(bytes);
+                        continue;
+                    }
+                }
+                bytes.CopyTo(buffer, used);
+                used += bytes.Length;
+            }
+            if (used > 0)
+                WriteRecords(buffer.AsSpan(0, used));
+        }
+        finally
+        {
+            ArrayPool<byte>.Shared.Return(buffer);
+        }
+    }
+
+    /// <summary>
+    /// Write whole DBN records laid out back to back, rolling over files as needed
+    /// </summary>
+    /// <param name="records">Raw record bytes</param>
+    /// <returns>Number of records written</returns>
+    public unsafe int WriteRecords(ReadOnlySpan<byte> records)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        if (records.IsEmpty)
+            return 0;
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result;
+        nuint written;
+        fixed (byte* ptr = records)
+        {
+            result = NativeMethods.dbento_dbn_rolling_writer_write_records(
+                _handle, ptr, (nuint)records.Length, out written, errorBuffer, (nuint)errorBuffer.Length);
+        }
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to write records: {error}");
+        }
+        return (int)written;
+    }
+
+    /// <summary>
+    /// Complete the current file now (e.g. at session end); the next record starts a new one
+    /// </summary>
+    public void Rotate()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_rolling_writer_rotate(_handle, errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to rotate DBN file: {error}");
+        }
+    }
+
+    /// <summary>
+    /// Replace the metadata (e.g. symbols after a subscription change) for files opened from now on
+    /// </summary>
+    /// <param name="metadata">New metadata</param>
+    public void SetMetadata(DbnMetadata metadata)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentNullException.ThrowIfNull(metadata);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_rolling_writer_set_metadata(
+            _handle, JsonSerializer.Serialize(metadata), errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to set metadata: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Flush the current file's buffered records to the operating system
+    /// </summary>
+    public void Flush()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_rolling_writer_flush(_handle, errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to flush DBN file: {error}");
+        }
+    }
+
+    /// <summary>
+    /// Complete the current file and add it to the manifest, reporting any error.
+    /// Disposing also completes it but cannot report errors.
+    /// </summary>
+    public void Complete()
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        int result = NativeMethods.dbento_dbn_rolling_writer_finish(_handle, errorBuffer, (nuint)errorBuffer.Length);
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw new DbentoException($"Failed to complete DBN file: {error}");
+        }
+    }
+
+    /// <summary>
+    /// Read the entries of a rolling writer manifest
+    /// </summary>
+    /// <param name="manifestPath">Path to the manifest</param>
+    public static IReadOnlyList<DbnManifestEntry> ReadManifest(string manifestPath)
+    {
+        if (string.IsNullOrWhiteSpace(manifestPath))
+            throw new ArgumentException("Manifest path cannot be null or empty", nameof(manifestPath));
+
+        var entries = new List<DbnManifestEntry>();
+        foreach (var line in File.ReadLines(manifestPath))
+        {
+            if (string.IsNullOrWhiteSpace(line))
+                continue;
+            entries.Add(JsonSerializer.Deserialize<DbnManifestEntry>(line)
+                ?? throw new DbentoException("Failed to deserialize manifest entry"));
+        }
+        return entries;
+    }
+
+    /// <summary>
+    /// Complete the current file and release the writer
+    /// </summary>
+    public void Dispose()
+    {
+        if (Interlocked.CompareExchange(ref _disposeState, 1, 0) != 0)
+            return;
+
+        _handle?.Dispose();
+
+        Interlocked.Exchange(ref _disposeState, 2);
+    }
+
+    /// <summary>
+    /// Complete the current file and release the writer
+    /// </summary>
+    public ValueTask DisposeAsync()
+    {
+        Dispose();
+        return ValueTask.CompletedTask;
+    }
+}
@@ -0,0 +1,41 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Rotation settings for <see cref="DbnRollingWriter"/>.
+/// </summary>
+public sealed class DbnRollingWriterOptions
+{
+    /// <summary>
+    /// Time between file boundaries (e.g. one hour), measured on the records' receive
+    /// timestamps. Null disables time-based rotation.
+    /// </summary>
+    public TimeSpan? RotationInterval { get; set; } = TimeSpan.FromHours(1);
+
+    /// <summary>
+    /// Shift of the boundaries from midnight UTC, e.g. a daily interval offset to the
+    /// session end.
+    /// </summary>
+    public TimeSpan RotationOffset { get; set; } = TimeSpan.Zero;
+
+    /// <summary>
+    /// Start a new file before one would exceed this many uncompressed record bytes.
+    /// 0 disables size-based rotation.
+    /// </summary>
+    public long MaxFileBytes { get; set; } = 0;
+
+    /// <summary>
+    /// Compression settings, or null to write uncompressed DBN.
+    /// </summary>
+    public DbnCompressionOptions? Compression { get; set; }
+
+    /// <summary>
+    /// Manifest file receiving one JSON line per completed file. Null uses
+    /// <c>&lt;outputDirectory&gt;/&lt;filePrefix&gt;.manifest.jsonl</c>.
+    /// </summary>
+    public string? ManifestPath { get; set; }
+
+    /// <summary>
+    /// Default options (hourly files, uncompressed, no size limit).
+    /// </summary>
+    public static DbnRollingWriterOptions Default => new();
+}
@@ -0,0 +1,22 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Settings for <see cref="DbnFileWriter.Split"/>.
+/// </summary>
+public sealed class DbnSplitOptions
+{
+    /// <summary>
+    /// zstd compression level for <c>.zst</c> outputs. 0 uses the default of 3.
+    /// </summary>
+    public int CompressionLevel { get; set; } = 0;
+
+    /// <summary>
+    /// Writer threads. 0 uses the hardware threads, capped at 8.
+    /// </summary>
+    public int ThreadCount { get; set; } = 0;
+
+    /// <summary>
+    /// Default options (default compression level and thread count).
+    /// </summary>
+    public static DbnSplitOptions Default => new();
+}
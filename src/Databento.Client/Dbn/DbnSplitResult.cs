@@ -0,0 +1,17 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Outcome of <see cref="DbnFileWriter.Split"/>
+/// </summary>
+public sealed class DbnSplitResult
+{
+    /// <summary>
+    /// Records written across all outputs
+    /// </summary>
+    public required long RecordCount { get; init; }
+
+    /// <summary>
+    /// Output files written, one per partition present in the input
+    /// </summary>
+    public required long FileCount { get; init; }
+}
@@ -0,0 +1,41 @@
+using Databento.Client.Models;
+
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Settings for <see cref="DbnFileWriter.UpgradeFiles"/>.
+/// </summary>
+public sealed class DbnUpgradeOptions
+{
+    /// <summary>
+    /// Directory receiving the upgraded files, mirroring the input tree. Null upgrades the
+    /// files in place; an original whose extension changes with the compression is removed.
+    /// </summary>
+    public string? OutputDirectory { get; set; }
+
+    /// <summary>
+    /// Output compression.
+    /// </summary>
+    public DbnUpgradeCompression Compression { get; set; } = DbnUpgradeCompression.Keep;
+
+    /// <summary>
+    /// zstd compression level. 0 uses the default of 3.
+    /// </summary>
+    public int CompressionLevel { get; set; } = 0;
+
+    /// <summary>
+    /// Leave files already at the current DBN version untouched when their compression
+    /// would not change.
+    /// </summary>
+    public bool SkipCurrent { get; set; } = true;
+
+    /// <summary>
+    /// Files processed concurrently. 0 uses the hardware threads, capped at 8.
+    /// </summary>
+    public int ThreadCount { get; set; } = 0;
+
+    /// <summary>
+    /// Default options (in place, compression kept, current files skipped).
+    /// </summary>
+    public static DbnUpgradeOptions Default => new();
+}
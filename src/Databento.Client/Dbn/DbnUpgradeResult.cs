@@ -0,0 +1,27 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Outcome of <see cref="DbnFileWriter.UpgradeFiles"/>
+/// </summary>
+public sealed class DbnUpgradeResult
+{
+    /// <summary>
+    /// Files rewritten at the current DBN version
+    /// </summary>
+    public required long FilesUpgraded { get; init; }
+
+    /// <summary>
+    /// Files left untouched because they were already current
+    /// </summary>
+    public required long FilesSkipped { get; init; }
+
+    /// <summary>
+    /// Files that could not be upgraded; their originals are unchanged
+    /// </summary>
+    public required long FilesFailed { get; init; }
+
+    /// <summary>
+    /// Path and message of the first failure, or null if every file succeeded
+    /// </summary>
+    public string? FirstError { get; init; }
+}
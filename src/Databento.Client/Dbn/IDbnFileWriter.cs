@@ -24,7 +24,30 @@ public interface IDbnFileWriter : IDisposable, IAsyncDisposable
     void WriteRecords(IEnumerable<Record> records);
 
     /// <summary>
-    /// Flush any buffered data to disk
+    /// Write whole DBN records laid out back to back in one call
+    /// </summary>
+    /// <param name="records">Raw record bytes</param>
+    /// <returns>Number of records written</returns>
+    int WriteRecords(ReadOnlySpan<byte> records);
+
+    /// <summary>
+    /// Flush buffered records to the operating system
     /// </summary>
     void Flush();
+
+    /// <summary>
+    /// Flush buffered records, optionally waiting until they are on the device
+    /// </summary>
+    /// <param name="durable">Also wait until the data is on the device (fsync)</param>
+    void Flush(bool durable);
+
+    /// <summary>
+    /// Sync everything written so far to the device and record it in the checkpoint sidecar
+    /// </summary>
+    void Checkpoint();
+
+    /// <summary>
+    /// Complete the file, reporting any error. Disposing also completes it but cannot report errors.
+    /// </summary>
+    void Complete();
 }
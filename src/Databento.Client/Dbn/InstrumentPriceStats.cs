@@ -0,0 +1,24 @@
+namespace Databento.Client.Dbn;
+
+/// <summary>
+/// Price and volume totals of one instrument (see <see cref="DbnAnalytics.StatsByInstrument"/>)
+/// </summary>
+/// <param name="InstrumentId">Instrument ID</param>
+/// <param name="Count">Rows with a defined price</param>
+/// <param name="MinPrice">Minimum price (fixed-point, 1e-9 units)</param>
+/// <param name="MaxPrice">Maximum price (fixed-point, 1e-9 units)</param>
+/// <param name="Volume">Sum of sizes</param>
+/// <param name="Notional">Sum of price * size, in price units</param>
+public readonly record struct InstrumentPriceStats(
+    uint InstrumentId,
+    long Count,
+    long MinPrice,
+    long MaxPrice,
+    ulong Volume,
+    double Notional)
+{
+    /// <summary>
+    /// Volume-weighted average price (NaN without volume)
+    /// </summary>
+    public double Vwap => Volume == 0 ? double.NaN : Notional / Volume;
+}
@@ -3,6 +3,7 @@ using System.Runtime.InteropServices;
 using System.Text.Json;
 using System.Text.Json.Serialization;
 using System.Threading.Channels;
+using Databento.Client.Dbn;
 using Databento.Client.Metadata;
 using Databento.Client.Models;
 using Databento.Client.Models.Batch;
@@ -501,6 +502,78 @@ public sealed class HistoricalClient : IHistoricalClient
         }, cancellationToken).ConfigureAwait(false);
     }
 
+    /// <summary>
+    /// Query historical data straight into a native Arrow batch builder. Records are projected
+    /// into columns inside the native callback, so no managed object is created per record;
+    /// take the rows afterwards with <see cref="DbnArrowBatchBuilder.Finish"/>.
+    /// </summary>
+    /// <param name="builder">Builder to fill; records of other types than its record type are skipped</param>
+    /// <param name="dataset">Dataset name</param>
+    /// <param name="schema">Data schema</param>
+    /// <param name="symbols">Symbols to query</param>
+    /// <param name="startTime">Start of the time range</param>
+    /// <param name="endTime">End of the time range</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Rows in the builder after the query</returns>
+    public async Task<long> GetRangeToArrowAsync(
+        DbnArrowBatchBuilder builder,
+        string dataset,
+        Schema schema,
+        IEnumerable<string> symbols,
+        DateTimeOffset startTime,
+        DateTimeOffset endTime,
+        CancellationToken cancellationToken = default)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+        ArgumentNullException.ThrowIfNull(builder, nameof(builder));
+        ArgumentException.ThrowIfNullOrWhiteSpace(dataset, nameof(dataset));
+        ArgumentNullException.ThrowIfNull(symbols, nameof(symbols));
+
+        var symbolArray = symbols.ToArray();
+        Utilities.ErrorBufferHelpers.ValidateSymbolArray(symbolArray);
+
+        long startTimeNs = Utilities.DateTimeHelpers.ToUnixNanos(startTime);
+        long endTimeNs = Utilities.DateTimeHelpers.ToUnixNanos(endTime);
+
+        return await Task.Run(() =>
+        {
+            byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+            var builderHandle = builder.Handle;
+            bool addedRef = false;
+            try
+            {
+                // Keep the builder alive while the native callback appends to it
+                builderHandle.DangerousAddRef(ref addedRef);
+
+                var result = NativeMethods.dbento_historical_get_range_native(
+                    _handle,
+                    dataset,
+                    schema.ToSchemaString(),
+                    symbolArray,
+                    (nuint)symbolArray.Length,
+                    startTimeNs,
+                    endTimeNs,
+                    NativeMethods.dbento_arrow_builder_record_callback(),
+                    builderHandle.DangerousGetHandle(),
+                    errorBuffer,
+                    (nuint)errorBuffer.Length);
+
+                if (result != 0)
+                {
+                    var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                    throw DbentoException.CreateFromErrorCode($"Failed to query historical data: {error}", result);
+                }
+            }
+            finally
+            {
+                if (addedRef)
+                    builderHandle.DangerousRelease();
+            }
+
+            return builder.RowCount;
+        }, cancellationToken).ConfigureAwait(false);
+    }
+
     /// <summary>
     /// Query historical data with symbology type filtering and save directly to a DBN file
     /// </summary>
@@ -566,6 +639,78 @@ public sealed class HistoricalClient : IHistoricalClient
         }, cancellationToken).ConfigureAwait(false);
     }
 
+    /// <summary>
+    /// Query historical data and save it as resumable chunk files downloaded in parallel
+    /// </summary>
+    /// <remarks>
+    /// Chunks are written to <c>{filePath}.chunks/</c> and tracked in <c>{filePath}.chunks/manifest.json</c>.
+    /// If the download fails part way, calling this method again with the same arguments only fetches
+    /// the chunks that are missing. When <paramref name="concatenate"/> is true, the chunks are merged
+    /// into <paramref name="filePath"/> once all of them are present and the chunk directory is removed.
+    /// </remarks>
+    public async Task<string> GetRangeToFileChunkedAsync(
+        string filePath,
+        string dataset,
+        Schema schema,
+        IEnumerable<string> symbols,
+        DateTimeOffset startTime,
+        DateTimeOffset endTime,
+        TimeSpan? chunkDuration = null,
+        int maxParallelism = 4,
+        bool concatenate = true,
+        SType? stypeIn = null,
+        SType? stypeOut = null,
+        CancellationToken cancellationToken = default)
+    {
+        ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
+
+        if (string.IsNullOrWhiteSpace(filePath))
+            throw new ArgumentException("File path cannot be null or empty", nameof(filePath));
+
+        ArgumentException.ThrowIfNullOrWhiteSpace(dataset, nameof(dataset));
+        ArgumentNullException.ThrowIfNull(symbols, nameof(symbols));
+
+        if (chunkDuration.HasValue && chunkDuration.Value < TimeSpan.FromMinutes(1))
+            throw new ArgumentOutOfRangeException(nameof(chunkDuration), "Chunk duration must be at least 1 minute");
+
+        var symbolArray = symbols.ToArray();
+        Utilities.ErrorBufferHelpers.ValidateSymbolArray(symbolArray);
+
+        long startTimeNs = Utilities.DateTimeHelpers.ToUnixNanos(startTime);
+        long endTimeNs = Utilities.DateTimeHelpers.ToUnixNanos(endTime);
+        long chunkDurationNs = chunkDuration.HasValue ? checked(chunkDuration.Value.Ticks * 100) : 0;
+
+        return await Task.Run(() =>
+        {
+            byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+
+            var result = NativeMethods.dbento_historical_get_range_to_file_chunked(
+                _handle,
+                filePath,
+                dataset,
+                schema.ToSchemaString(),
+                symbolArray,
+                (nuint)symbolArray.Length,
+                startTimeNs,
+                endTimeNs,
+                stypeIn.HasValue ? ConvertStypeToString(stypeIn.Value) : null,
+                stypeOut.HasValue ? ConvertStypeToString(stypeOut.Value) : null,
+                chunkDurationNs,
+                maxParallelism,
+                concatenate ? 1 : 0,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+            if (result != 0)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw DbentoException.CreateFromErrorCode($"Failed to save historical data to chunked files: {error}", result);
+            }
+
+            return filePath;
+        }, cancellationToken).ConfigureAwait(false);
+    }
+
     /// <summary>
     /// Get metadata for a historical query
     /// Note: This feature is currently not fully implemented in the native layer
@@ -609,6 +754,44 @@ public sealed class HistoricalClient : IHistoricalClient
     // Metadata API Methods
     // ========================================================================
 
+    /// <summary>
+    /// Configure the process-wide native cache for metadata/reference responses
+    /// </summary>
+    /// <param name="ttl">How long a cached response stays valid (<see cref="TimeSpan.Zero"/> disables caching)</param>
+    /// <param name="snapshotPath">Optional file used to persist the cache so later processes start warm</param>
+    /// <remarks>
+    /// Covers <see cref="ListDatasetsAsync"/>, <see cref="ListPublishersAsync"/>, <see cref="ListSchemasAsync"/>,
+    /// <see cref="ListFieldsAsync"/>, <see cref="GetDatasetConditionAsync(string, CancellationToken)"/>
+    /// (both overloads) and <see cref="GetDatasetRangeAsync"/>. Entries are keyed per API key, and
+    /// the setting applies to every historical client in the process.
+    /// </remarks>
+    public static void ConfigureMetadataCache(TimeSpan ttl, string? snapshotPath = null)
+    {
+        if (ttl < TimeSpan.Zero)
+            throw new ArgumentOutOfRangeException(nameof(ttl), "TTL cannot be negative");
+
+        byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
+        var result = NativeMethods.dbento_metadata_cache_configure(
+            (long)Math.Ceiling(ttl.TotalSeconds),
+            snapshotPath,
+            errorBuffer,
+            (nuint)errorBuffer.Length);
+
+        if (result != 0)
+        {
+            var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+            throw DbentoException.CreateFromErrorCode($"Failed to configure metadata cache: {error}", result);
+        }
+    }
+
+    /// <summary>
+    /// Drop all cached metadata responses, including the on-disk snapshot
+    /// </summary>
+    public static void ClearMetadataCache()
+    {
+        NativeMethods.dbento_metadata_cache_clear();
+    }
+
     /// <summary>
     /// List all publishers
     /// </summary>
@@ -1600,102 +1783,174 @@ public sealed class HistoricalClient : IHistoricalClient
             }
 
             using var resHandle = new SymbologyResolutionHandle(handlePtr);
+            return ReadSymbologyResolution(handlePtr, stypeIn, stypeOut);
+        }, cancellationToken);
+    }
+
+    /// <summary>
+    /// Resolve symbols like <see cref="SymbologyResolveAsync(string, IEnumerable{string}, SType, SType, DateOnly, DateOnly, CancellationToken)"/>,
+    /// backed by a persistent on-disk cache
+    /// </summary>
+    /// <param name="dataset">Dataset name (e.g., "GLBX.MDP3")</param>
+    /// <param name="symbols">Symbols to resolve</param>
+    /// <param name="stypeIn">Input symbology type</param>
+    /// <param name="stypeOut">Output symbology type</param>
+    /// <param name="startDate">Start date (inclusive)</param>
+    /// <param name="endDate">End date (exclusive)</param>
+    /// <param name="cacheDirectory">Directory holding the cache files (created if missing)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Symbology resolution result</returns>
+    /// <remarks>
+    /// Only symbols and dates not already cached for (API key, dataset, stypeIn, stypeOut) are requested
+    /// from the API, so re-resolving yesterday's universe with a later end date fetches only the new days.
+    /// Dates from the current UTC day on are fetched every time, since their answer can still change.
+    /// </remarks>
+    public Task<SymbologyResolution> SymbologyResolveAsync(
+        string dataset,
+        IEnumerable<string> symbols,
+        SType stypeIn,
+        SType stypeOut,
+        DateOnly startDate,
+        DateOnly endDate,
+        string cacheDirectory,
+        CancellationToken cancellationToken = default)
+    {
+        ArgumentException.ThrowIfNullOrWhiteSpace(dataset);
+        ArgumentNullException.ThrowIfNull(symbols);
+        ArgumentException.ThrowIfNullOrWhiteSpace(cacheDirectory);
 
-            // Extract data from the native handle
-            var mappings = new Dictionary<string, IReadOnlyList<MappingInterval>>();
-            nuint mappingsCount = NativeMethods.dbento_symbology_resolution_mappings_count(handlePtr);
+        return Task.Run(() =>
+        {
+            ObjectDisposedException.ThrowIf(Interlocked.CompareExchange(ref _disposeState, 0, 0) != 0, this);
 
-            for (nuint i = 0; i < mappingsCount; i++)
+            var symbolArray = symbols.ToArray();
+            Utilities.ErrorBufferHelpers.ValidateSymbolArray(symbolArray);
+            if (symbolArray.Length == 0)
             {
-                byte[] keyBuffer = new byte[256];
-                int result = NativeMethods.dbento_symbology_resolution_get_mapping_key(
-                    handlePtr, i, keyBuffer, (nuint)keyBuffer.Length);
+                throw new ArgumentException("Symbols collection cannot be empty", nameof(symbols));
+            }
 
-                if (result != 0) continue;
+            byte[] errorBuffer = new byte[Utilities.Constants.ErrorBufferSize];
 
-                string key = System.Text.Encoding.UTF8.GetString(keyBuffer).TrimEnd('\0');
+            var handlePtr = NativeMethods.dbento_historical_symbology_resolve_cached(
+                _handle,
+                dataset,
+                symbolArray,
+                (nuint)symbolArray.Length,
+                ConvertStypeToString(stypeIn),
+                ConvertStypeToString(stypeOut),
+                startDate.ToString("yyyy-MM-dd"),
+                endDate.ToString("yyyy-MM-dd"),
+                cacheDirectory,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
 
-                // Get intervals for this key
-                nuint intervalCount = NativeMethods.dbento_symbology_resolution_get_intervals_count(
-                    handlePtr, key);
+            if (handlePtr == IntPtr.Zero)
+            {
+                var error = Utilities.ErrorBufferHelpers.SafeGetString(errorBuffer);
+                throw new DbentoException($"Failed to resolve symbology: {error}");
+            }
 
-                var intervals = new List<MappingInterval>();
-                for (nuint j = 0; j < intervalCount; j++)
-                {
-                    byte[] startDateBuffer = new byte[32];
-                    byte[] endDateBuffer = new byte[32];
-                    byte[] symbolBuffer = new byte[256];
+            using var resHandle = new SymbologyResolutionHandle(handlePtr);
+            return ReadSymbologyResolution(handlePtr, stypeIn, stypeOut);
+        }, cancellationToken);
+    }
 
-                    result = NativeMethods.dbento_symbology_resolution_get_interval(
-                        handlePtr, key, j,
-                        startDateBuffer, (nuint)startDateBuffer.Length,
-                        endDateBuffer, (nuint)endDateBuffer.Length,
-                        symbolBuffer, (nuint)symbolBuffer.Length);
+    /// <summary>
+    /// Copy a native symbology resolution result into its managed model
+    /// </summary>
+    /// <remarks>
+    /// Uses a single bulk export (see DbentoSymbologyExportHeader in databento_native.h) instead of
+    /// per-mapping/per-interval getter calls, so large resolutions cost two P/Invokes in total.
+    /// </remarks>
+    private SymbologyResolution ReadSymbologyResolution(IntPtr handlePtr, SType stypeIn, SType stypeOut)
+    {
+        int result = NativeMethods.dbento_symbology_resolution_export(handlePtr, null, 0, out var requiredSize);
+        if (result != 0)
+            throw new DbentoException($"Failed to export symbology resolution (error code {result})");
+
+        byte[] buffer = new byte[checked((int)requiredSize)];
+        result = NativeMethods.dbento_symbology_resolution_export(
+            handlePtr, buffer, (nuint)buffer.Length, out requiredSize);
+        if (result != 0)
+            throw new DbentoException($"Failed to export symbology resolution (error code {result})");
+
+        // DbentoSymbologyExportHeader: 13 x 32-bit fields
+        uint U32(int offset) => BitConverter.ToUInt32(buffer, offset);
+        uint mappingCount = U32(12);
+        int mappingsOffset = (int)U32(16);
+        int intervalsOffset = (int)U32(24);
+        uint partialCount = U32(28);
+        int partialOffset = (int)U32(32);
+        uint notFoundCount = U32(36);
+        int notFoundOffset = (int)U32(40);
+        int stringsOffset = (int)U32(48);
+
+        // DbentoStringRef: { uint32 offset, uint32 length } into the string table
+        string ReadString(int refOffset) =>
+            System.Text.Encoding.UTF8.GetString(buffer, stringsOffset + (int)U32(refOffset), (int)U32(refOffset + 4));
+
+        static DateOnly FromYyyymmdd(int value) =>
+            new DateOnly(value / 10000, value / 100 % 100, value % 100);
+
+        var mappings = new Dictionary<string, IReadOnlyList<MappingInterval>>((int)mappingCount);
+        for (int i = 0; i < mappingCount; i++)
+        {
+            // DbentoSymbologyMappingEntry: { DbentoStringRef key, uint32 first_interval, uint32 interval_count }
+            int entryOffset = mappingsOffset + i * 16;
+            string key = ReadString(entryOffset);
+            int firstInterval = (int)U32(entryOffset + 8);
+            int intervalCount = (int)U32(entryOffset + 12);
+
+            var intervals = new List<MappingInterval>(intervalCount);
+            for (int j = 0; j < intervalCount; j++)
+            {
+                // DbentoSymbologyIntervalEntry: { int32 start_date, int32 end_date, DbentoStringRef symbol }
+                int intervalOffset = intervalsOffset + (firstInterval + j) * 16;
+                int startDate = BitConverter.ToInt32(buffer, intervalOffset);
+                int endDate = BitConverter.ToInt32(buffer, intervalOffset + 4);
+                string symbol = ReadString(intervalOffset + 8);
 
-                    if (result == 0)
+                try
+                {
+                    intervals.Add(new MappingInterval
                     {
-                        string startDateStrInterval = System.Text.Encoding.UTF8.GetString(startDateBuffer).TrimEnd('\0');
-                        string endDateStrInterval = System.Text.Encoding.UTF8.GetString(endDateBuffer).TrimEnd('\0');
-                        string symbol = System.Text.Encoding.UTF8.GetString(symbolBuffer).TrimEnd('\0');
-
-                        // HIGH FIX: Use TryParseExact to prevent FormatException on malformed native data
-                        if (DateOnly.TryParseExact(startDateStrInterval, "yyyy-MM-dd", out var startDate) &&
-                            DateOnly.TryParseExact(endDateStrInterval, "yyyy-MM-dd", out var endDate))
-                        {
-                            intervals.Add(new MappingInterval
-                            {
-                                StartDate = startDate,
-                                EndDate = endDate,
-                                Symbol = symbol
-                            });
-                        }
-                        else
-                        {
-                            _logger.LogWarning(
-                                "Skipping invalid mapping interval: StartDate={StartDate}, EndDate={EndDate}, Symbol={Symbol}",
-                                startDateStrInterval, endDateStrInterval, symbol);
-                        }
-                    }
+                        StartDate = FromYyyymmdd(startDate),
+                        EndDate = FromYyyymmdd(endDate),
+                        Symbol = symbol
+                    });
                 }
-
-                mappings[key] = intervals;
-            }
-
-            // Get partial symbols
-            var partial = new List<string>();
-            nuint partialCount = NativeMethods.dbento_symbology_resolution_partial_count(handlePtr);
-            for (nuint i = 0; i < partialCount; i++)
-            {
-                byte[] symbolBuffer = new byte[256];
-                if (NativeMethods.dbento_symbology_resolution_get_partial(
-                    handlePtr, i, symbolBuffer, (nuint)symbolBuffer.Length) == 0)
+                catch (ArgumentOutOfRangeException)
                 {
-                    partial.Add(System.Text.Encoding.UTF8.GetString(symbolBuffer).TrimEnd('\0'));
+                    _logger.LogWarning(
+                        "Skipping invalid mapping interval: StartDate={StartDate}, EndDate={EndDate}, Symbol={Symbol}",
+                        startDate, endDate, symbol);
                 }
             }
 
-            // Get not found symbols
-            var notFound = new List<string>();
-            nuint notFoundCount = NativeMethods.dbento_symbology_resolution_not_found_count(handlePtr);
-            for (nuint i = 0; i < notFoundCount; i++)
-            {
-                byte[] symbolBuffer = new byte[256];
-                if (NativeMethods.dbento_symbology_resolution_get_not_found(
-                    handlePtr, i, symbolBuffer, (nuint)symbolBuffer.Length) == 0)
-                {
-                    notFound.Add(System.Text.Encoding.UTF8.GetString(symbolBuffer).TrimEnd('\0'));
-                }
-            }
+            mappings[key] = intervals;
+        }
 
-            return new SymbologyResolution
-            {
-                Mappings = mappings,
-                Partial = partial,
-                NotFound = notFound,
-                StypeIn = stypeIn,
-                StypeOut = stypeOut
-            };
-        }, cancellationToken);
+        var partial = new List<string>((int)partialCount);
+        for (int i = 0; i < partialCount; i++)
+        {
+            partial.Add(ReadString(partialOffset + i * 8));
+        }
+
+        var notFound = new List<string>((int)notFoundCount);
+        for (int i = 0; i < notFoundCount; i++)
+        {
+            notFound.Add(ReadString(notFoundOffset + i * 8));
+        }
+
+        return new SymbologyResolution
+        {
+            Mappings = mappings,
+            Partial = partial,
+            NotFound = notFound,
+            StypeIn = stypeIn,
+            StypeOut = stypeOut
+        };
     }
 
     private static string ConvertStypeToString(SType stype)
@@ -1,3 +1,4 @@
+using Databento.Client.Dbn;
 using Databento.Client.Metadata;
 using Databento.Client.Models;
 using Databento.Client.Models.Batch;
@@ -99,6 +100,58 @@ public interface IHistoricalClient : IAsyncDisposable
         ulong limit = 0,
         CancellationToken cancellationToken = default);
 
+    /// <summary>
+    /// Query historical data straight into a native Arrow batch builder, with no managed
+    /// object per record; take the rows afterwards with <see cref="DbnArrowBatchBuilder.Finish"/>.
+    /// </summary>
+    /// <param name="builder">Builder to fill; records of other types than its record type are skipped</param>
+    /// <param name="dataset">Dataset name (e.g., "GLBX.MDP3")</param>
+    /// <param name="schema">Schema type</param>
+    /// <param name="symbols">List of symbols</param>
+    /// <param name="startTime">Start time</param>
+    /// <param name="endTime">End time</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Rows in the builder after the query</returns>
+    Task<long> GetRangeToArrowAsync(
+        DbnArrowBatchBuilder builder,
+        string dataset,
+        Schema schema,
+        IEnumerable<string> symbols,
+        DateTimeOffset startTime,
+        DateTimeOffset endTime,
+        CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Query historical data and save it as resumable chunk files downloaded in parallel.
+    /// Re-running the same request after a failure only downloads the missing chunks.
+    /// </summary>
+    /// <param name="filePath">Output file path; chunks are kept in "{filePath}.chunks/"</param>
+    /// <param name="dataset">Dataset name (e.g., "GLBX.MDP3")</param>
+    /// <param name="schema">Schema type</param>
+    /// <param name="symbols">List of symbols</param>
+    /// <param name="startTime">Start time</param>
+    /// <param name="endTime">End time</param>
+    /// <param name="chunkDuration">Length of each chunk (default 1 day, aligned to UTC)</param>
+    /// <param name="maxParallelism">Maximum concurrent chunk downloads</param>
+    /// <param name="concatenate">Merge completed chunks into <paramref name="filePath"/></param>
+    /// <param name="stypeIn">Input symbology type (default raw_symbol)</param>
+    /// <param name="stypeOut">Output symbology type (default instrument_id)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Path to the created DBN file (or chunk base path when not concatenating)</returns>
+    Task<string> GetRangeToFileChunkedAsync(
+        string filePath,
+        string dataset,
+        Schema schema,
+        IEnumerable<string> symbols,
+        DateTimeOffset startTime,
+        DateTimeOffset endTime,
+        TimeSpan? chunkDuration = null,
+        int maxParallelism = 4,
+        bool concatenate = true,
+        SType? stypeIn = null,
+        SType? stypeOut = null,
+        CancellationToken cancellationToken = default);
+
     /// <summary>
     /// Get metadata for a historical query
     /// Note: This feature is currently not fully implemented in the native layer
@@ -419,4 +472,29 @@ public interface IHistoricalClient : IAsyncDisposable
         DateOnly startDate,
         DateOnly endDate,
         CancellationToken cancellationToken = default);
+
+    /// <summary>
+    /// Resolve symbols from one symbology type to another, backed by a persistent on-disk cache
+    /// </summary>
+    /// <param name="dataset">Dataset name</param>
+    /// <param name="symbols">List of symbols to resolve</param>
+    /// <param name="stypeIn">Input symbology type</param>
+    /// <param name="stypeOut">Output symbology type</param>
+    /// <param name="startDate">Start date (inclusive)</param>
+    /// <param name="endDate">End date (exclusive)</param>
+    /// <param name="cacheDirectory">Directory holding the cache files (created if missing)</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Symbology resolution with mappings, partial matches, and not found symbols</returns>
+    /// <remarks>
+    /// Only symbols and dates not already present in the cache are requested from the API.
+    /// </remarks>
+    Task<SymbologyResolution> SymbologyResolveAsync(
+        string dataset,
+        IEnumerable<string> symbols,
+        SType stypeIn,
+        SType stypeOut,
+        DateOnly startDate,
+        DateOnly endDate,
+        string cacheDirectory,
+        CancellationToken cancellationToken = default);
 }
@@ -1,4 +1,5 @@
 using System.Text.Json;
+using Databento.Client.Dbn;
 using Databento.Client.Models;
 using Encoding = System.Text.Encoding;
 using Databento.Client.Models.Dbn;
@@ -313,6 +314,55 @@ public sealed class LiveBlockingClient : ILiveBlockingClient
         }, cancellationToken).ConfigureAwait(false);
     }
 
+    /// <summary>
+    /// Pull records straight into a native Arrow batch builder, skipping per-record managed
+    /// objects. Records of other types than the builder's are consumed and dropped.
+    /// Take the rows afterwards with <see cref="DbnArrowBatchBuilder.Finish"/>.
+    /// </summary>
+    /// <param name="builder">Builder to fill</param>
+    /// <param name="maxRows">Stop once this many rows were added</param>
+    /// <param name="timeout">Maximum time to wait for each record, or null to wait indefinitely</param>
+    /// <param name="cancellationToken">Cancellation token</param>
+    /// <returns>Rows added; fewer than <paramref name="maxRows"/> when the timeout elapsed</returns>
+    public async Task<int> FillArrowBatchAsync(
+        DbnArrowBatchBuilder builder,
+        int maxRows,
+        TimeSpan? timeout = null,
+        CancellationToken cancellationToken = default)
+    {
+        ObjectDisposedException.ThrowIf(_isDisposed, this);
+        ArgumentNullException.ThrowIfNull(builder);
+        ArgumentOutOfRangeException.ThrowIfNegativeOrZero(maxRows);
+
+        if (!_isStarted)
+            throw new InvalidOperationException("Client not started. Call StartAsync() first.");
+
+        var timeoutMs = timeout.HasValue
+            ? (int)timeout.Value.TotalMilliseconds
+            : -1; // -1 means infinite
+
+        return await Task.Run(() =>
+        {
+            var errorBuffer = new byte[4096];
+            var result = NativeMethods.dbento_live_blocking_next_arrow(
+                _handle,
+                builder.Handle,
+                (nuint)maxRows,
+                timeoutMs,
+                out var rowsAdded,
+                errorBuffer,
+                (nuint)errorBuffer.Length);
+
+            if (result < 0)
+            {
+                var error = Encoding.UTF8.GetString(errorBuffer).TrimEnd('\0');
+                throw new DbentoException($"FillArrowBatch failed: {error}");
+            }
+
+            return (int)rowsAdded;
+        }, cancellationToken).ConfigureAwait(false);
+    }
+
     /// <inheritdoc/>
     public async Task ReconnectAsync(CancellationToken cancellationToken = default)
     {
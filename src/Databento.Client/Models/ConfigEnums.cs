@@ -325,3 +325,96 @@ public static class ConfigEnumExtensions
         };
     }
 }
+
+/// <summary>
+/// Timestamp used to index and seek DBN files
+/// </summary>
+public enum DbnIndexTimestamp
+{
+    /// <summary>Matching-engine event timestamp (ts_event, present on every record)</summary>
+    TsEvent = 0,
+
+    /// <summary>Capture-server receive timestamp (ts_recv; ts_event for records without one)</summary>
+    TsRecv = 1
+}
+
+/// <summary>
+/// Element type of a projected DBN record field (see <see cref="Dbn.DbnColumns"/>)
+/// </summary>
+public enum DbnFieldType
+{
+    /// <summary>Unsigned 8-bit integer (<see cref="byte"/>)</summary>
+    UInt8 = 1,
+
+    /// <summary>Single ASCII character such as action or side, stored as <see cref="byte"/></summary>
+    Char = 2,
+
+    /// <summary>Unsigned 16-bit integer (<see cref="ushort"/>)</summary>
+    UInt16 = 3,
+
+    /// <summary>Unsigned 32-bit integer (<see cref="uint"/>)</summary>
+    UInt32 = 4,
+
+    /// <summary>Signed 32-bit integer (<see cref="int"/>)</summary>
+    Int32 = 5,
+
+    /// <summary>Unsigned 64-bit integer (<see cref="ulong"/>), e.g. nanosecond timestamps</summary>
+    UInt64 = 6,
+
+    /// <summary>Signed 64-bit integer (<see cref="long"/>), e.g. 1e-9 fixed-point prices</summary>
+    Int64 = 7
+}
+
+/// <summary>
+/// Output format of <see cref="Dbn.DbnFileReader.Export"/>
+/// </summary>
+public enum DbnExportFormat
+{
+    /// <summary>Arrow IPC file (Feather v2), one record batch per row group</summary>
+    ArrowIpc = 0,
+
+    /// <summary>Parquet file with PLAIN-encoded columns</summary>
+    Parquet = 1
+}
+
+/// <summary>
+/// Compression of exported columnar files
+/// </summary>
+public enum DbnExportCompression
+{
+    /// <summary>No compression</summary>
+    None = 0,
+
+    /// <summary>zstd (Arrow IPC body compression / Parquet ZSTD codec)</summary>
+    Zstd = 1
+}
+
+/// <summary>
+/// Compression of files rewritten by <see cref="Dbn.DbnFileWriter.UpgradeFiles"/>
+/// </summary>
+public enum DbnUpgradeCompression
+{
+    /// <summary>Same as the input (zstd inputs are rewritten in the seekable format)</summary>
+    Keep = -1,
+
+    /// <summary>Uncompressed <c>.dbn</c></summary>
+    None = 0,
+
+    /// <summary>Seekable zstd <c>.dbn.zst</c></summary>
+    Zstd = 1
+}
+
+/// <summary>
+/// Partitioning used by <see cref="Dbn.DbnFileWriter.Split"/>
+/// </summary>
+public enum DbnSplitKey
+{
+    /// <summary>One file per instrument_id</summary>
+    InstrumentId = 0,
+
+    /// <summary>One file per publisher_id</summary>
+    PublisherId = 1,
+
+    /// <summary>One file per UTC hour of ts_recv (ts_event for records without one)</summary>
+    Hour = 2
+}
@@ -21,4 +21,14 @@ internal static class Constants
     /// Default buffer size for reading records from DBN files (8 KB).
     /// </summary>
     public const int RecordBufferSize = 8192;
+
+    /// <summary>
+    /// Buffer size for batched record reads from DBN files (1 MB).
+    /// </summary>
+    public const int RecordBatchBufferSize = 1024 * 1024;
+
+    /// <summary>
+    /// Maximum number of records returned by one batched DBN file read.
+    /// </summary>
+    public const int RecordBatchMaxRecords = 16384;
 }
@@ -0,0 +1,30 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Interop.Handles;
+
+/// <summary>
+/// SafeHandle wrapper for native Arrow record batch builder
+/// </summary>
+public sealed class ArrowBuilderHandle : SafeHandle
+{
+    public ArrowBuilderHandle() : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    public ArrowBuilderHandle(IntPtr handle) : base(IntPtr.Zero, ownsHandle: true)
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NativeMethods.dbento_arrow_builder_destroy(handle);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,30 @@
+using System.Runtime.InteropServices;
+using Databento.Interop.Native;
+
+namespace Databento.Interop.Handles;
+
+/// <summary>
+/// SafeHandle wrapper for native rolling DBN file writer
+/// </summary>
+public sealed class DbnRollingWriterHandle : SafeHandle
+{
+    public DbnRollingWriterHandle() : base(IntPtr.Zero, ownsHandle: true)
+    {
+    }
+
+    public DbnRollingWriterHandle(IntPtr handle) : base(IntPtr.Zero, ownsHandle: true)
+    {
+        SetHandle(handle);
+    }
+
+    public override bool IsInvalid => handle == IntPtr.Zero;
+
+    protected override bool ReleaseHandle()
+    {
+        if (!IsInvalid)
+        {
+            NativeMethods.dbento_dbn_rolling_writer_destroy(handle);
+        }
+        return true;
+    }
+}
@@ -0,0 +1,38 @@
+using System.Runtime.InteropServices;
+
+namespace Databento.Interop.Native;
+
+/// <summary>
+/// Arrow C Data Interface schema (layout of <c>struct ArrowSchema</c>)
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct CArrowSchema
+{
+    public byte* Format;
+    public byte* Name;
+    public byte* Metadata;
+    public long Flags;
+    public long NChildren;
+    public CArrowSchema** Children;
+    public CArrowSchema* Dictionary;
+    public delegate* unmanaged<CArrowSchema*, void> Release;
+    public void* PrivateData;
+}
+
+/// <summary>
+/// Arrow C Data Interface array (layout of <c>struct ArrowArray</c>)
+/// </summary>
+[StructLayout(LayoutKind.Sequential)]
+public unsafe struct CArrowArray
+{
+    public long Length;
+    public long NullCount;
+    public long Offset;
+    public long NBuffers;
+    public long NChildren;
+    public void** Buffers;
+    public CArrowArray** Children;
+    public CArrowArray* Dictionary;
+    public delegate* unmanaged<CArrowArray*, void> Release;
+    public void* PrivateData;
+}
@@ -275,6 +275,25 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_historical_get_range_to_file_chunked(
+        HistoricalClientHandle handle,
+        string filePath,
+        string dataset,
+        string schema,
+        [MarshalAs(UnmanagedType.LPArray, ArraySubType = UnmanagedType.LPUTF8Str)]
+        string[] symbols,
+        nuint symbolCount,
+        long startTimeNs,
+        long endTimeNs,
+        string? stypeIn,
+        string? stypeOut,
+        long chunkDurationNs,
+        int maxParallel,
+        int concatenate,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
     public static partial IntPtr dbento_historical_get_metadata(
         HistoricalClientHandle handle,
@@ -409,6 +428,16 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_metadata_cache_configure(
+        long ttlSeconds,
+        string? snapshotPath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_metadata_cache_clear();
+
     [LibraryImport(LibName)]
     public static partial void dbento_free_string(IntPtr strPtr);
 
@@ -529,6 +558,37 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_open_mapped(
+        string filePath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_open_prefetch(
+        string filePath,
+        nuint blockSize,
+        nuint blockCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial IntPtr dbento_dbn_file_open_memory(
+        byte* data,
+        nuint size,
+        int copy,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial IntPtr dbento_dbn_file_open_descriptor(
+        nint descriptor,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_is_mapped(DbnFileReaderHandle handle);
+
     [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
     public static partial IntPtr dbento_dbn_file_get_metadata(
         DbnFileReaderHandle handle,
@@ -545,9 +605,301 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_next_records(
+        DbnFileReaderHandle handle,
+        byte[] buffer,
+        nuint bufferCapacity,
+        [Out] nuint[] recordOffsets,
+        nuint maxRecords,
+        out nuint recordCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_next_record_view(
+        DbnFileReaderHandle handle,
+        out IntPtr recordPtr,
+        out nuint recordLength,
+        out byte recordType,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_file_build_index(
+        string filePath,
+        uint interval,
+        int tsField,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_seek_ordinal(
+        DbnFileReaderHandle handle,
+        ulong ordinal,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_seek_time(
+        DbnFileReaderHandle handle,
+        ulong timestampNs,
+        int tsField,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial long dbento_dbn_file_position(DbnFileReaderHandle handle);
+
     [LibraryImport(LibName)]
     public static partial void dbento_dbn_file_close(IntPtr handle);
 
+    // ========================================================================
+    // DBN Columnar Projection API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_field_type(byte rtype, string fieldName);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_file_project(
+        DbnFileReaderHandle handle,
+        byte rtype,
+        string[] fieldNames,
+        nuint fieldCount,
+        IntPtr[] outColumns,
+        nuint maxRows,
+        out nuint rowCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // DBN Columnar Export API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_file_export(
+        DbnFileReaderHandle handle,
+        string outputPath,
+        int format,
+        int rtype,
+        string[]? fieldNames,
+        nuint fieldCount,
+        nuint rowGroupSize,
+        int compression,
+        int threadCount,
+        out ulong rowsWritten,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // Arrow C Data Interface API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static unsafe partial int dbento_dbn_file_read_arrow(
+        DbnFileReaderHandle handle,
+        byte rtype,
+        string[]? fieldNames,
+        nuint fieldCount,
+        nuint maxRows,
+        CArrowSchema* outSchema,
+        CArrowArray* outArray,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_arrow_builder_create(
+        byte rtype,
+        string[]? fieldNames,
+        nuint fieldCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_arrow_builder_append(
+        ArrowBuilderHandle handle,
+        byte* records,
+        nuint length,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial IntPtr dbento_arrow_builder_record_callback();
+
+    [LibraryImport(LibName)]
+    public static partial long dbento_arrow_builder_row_count(ArrowBuilderHandle handle);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_arrow_builder_finish(
+        ArrowBuilderHandle handle,
+        CArrowSchema* outSchema,
+        CArrowArray* outArray,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_arrow_builder_destroy(IntPtr handle);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_live_blocking_next_arrow(
+        LiveClientHandle handle,
+        ArrowBuilderHandle builder,
+        nuint maxRows,
+        int timeoutMs,
+        out nuint rowsAdded,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    /// <summary>
+    /// dbento_historical_get_range with a native record callback
+    /// (e.g. dbento_arrow_builder_record_callback with a builder handle as user data)
+    /// </summary>
+    [LibraryImport(LibName, EntryPoint = "dbento_historical_get_range", StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_historical_get_range_native(
+        HistoricalClientHandle handle,
+        string dataset,
+        string schema,
+        string[] symbols,
+        nuint symbolCount,
+        long startTimeNs,
+        long endTimeNs,
+        IntPtr onRecord,
+        IntPtr userData,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // Analytics Kernels API
+    // ========================================================================
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_kernel_simd_level();
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_kernel_prices_to_double(
+        ReadOnlySpan<long> prices,
+        nuint count,
+        Span<double> outValues);
+
+    [LibraryImport(LibName)]
+    public static partial double dbento_kernel_vwap(
+        ReadOnlySpan<long> prices,
+        ReadOnlySpan<uint> sizes,
+        nuint count);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_kernel_instrument_stats(
+        ReadOnlySpan<uint> instrumentIds,
+        ReadOnlySpan<long> prices,
+        ReadOnlySpan<uint> sizes,
+        nuint count,
+        [Out] uint[] outInstrumentIds,
+        [Out] ulong[] outCounts,
+        [Out] long[] outMinPrices,
+        [Out] long[] outMaxPrices,
+        [Out] ulong[] outVolumes,
+        [Out] double[] outNotionals,
+        nuint capacity,
+        out nuint groupCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_kernel_returns(
+        ReadOnlySpan<double> values,
+        nuint count,
+        int logReturns,
+        Span<double> outReturns);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_kernel_rolling_mean_var(
+        ReadOnlySpan<double> values,
+        nuint count,
+        nuint window,
+        Span<double> outMeans,
+        Span<double> outVariances);
+
+    // ========================================================================
+    // DBN File Summary API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_summarize(
+        string[] filePaths,
+        nuint fileCount,
+        int threadCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // DBN Bulk Upgrade API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_upgrade_files(
+        string inputPath,
+        string? outputDir,
+        int compression,
+        int compressionLevel,
+        int skipCurrent,
+        int threadCount,
+        out ulong filesUpgraded,
+        out ulong filesSkipped,
+        out ulong filesFailed,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // DBN Split API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_split(
+        string inputPath,
+        int key,
+        string outputPattern,
+        int compressionLevel,
+        int threadCount,
+        out ulong records,
+        out ulong files,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    // ========================================================================
+    // DBN Merge Reader API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_merge_open(
+        string[] filePaths,
+        nuint fileCount,
+        int tsField,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_merge_next_records(
+        DbnMergeReaderHandle handle,
+        byte[] buffer,
+        nuint bufferCapacity,
+        [Out] nuint[] recordOffsets,
+        [Out] uint[]? sourceIndices,
+        nuint maxRecords,
+        out nuint recordCount,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_merge_seek_time(
+        DbnMergeReaderHandle handle,
+        ulong timestampNs,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_dbn_merge_close(IntPtr handle);
+
     // ========================================================================
     // DBN File Writer API
     // ========================================================================
@@ -559,6 +911,16 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_file_create_seekable(
+        string filePath,
+        string metadataJson,
+        int compressionLevel,
+        nuint frameSize,
+        int workerThreads,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName)]
     public static partial int dbento_dbn_file_write_record(
         DbnFileWriterHandle handle,
@@ -567,9 +929,134 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_file_write_records(
+        DbnFileWriterHandle handle,
+        byte* records,
+        nuint length,
+        out nuint recordsWritten,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_start_background(
+        DbnFileWriterHandle handle,
+        nuint queueCapacity,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_flush(
+        DbnFileWriterHandle handle,
+        int sync,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_enable_checkpoints(
+        DbnFileWriterHandle handle,
+        ulong intervalMs,
+        ulong intervalBytes,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_enable_index(
+        DbnFileWriterHandle handle,
+        uint interval,
+        int tsField,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_checkpoint(
+        DbnFileWriterHandle handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_file_recover(
+        string filePath,
+        out ulong records,
+        out ulong bytesTruncated,
+        out int endPatched,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_file_finish(
+        DbnFileWriterHandle handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName)]
     public static partial void dbento_dbn_file_close_writer(IntPtr handle);
 
+    // ========================================================================
+    // DBN Rolling Writer API
+    // ========================================================================
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_dbn_rolling_writer_create(
+        string outputDir,
+        string filePrefix,
+        string metadataJson,
+        ulong rotateIntervalNs,
+        ulong rotateOffsetNs,
+        ulong maxFileBytes,
+        int compress,
+        int compressionLevel,
+        nuint frameSize,
+        int workerThreads,
+        string? manifestPath,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static unsafe partial int dbento_dbn_rolling_writer_write_records(
+        DbnRollingWriterHandle handle,
+        byte* records,
+        nuint length,
+        out nuint recordsWritten,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_rolling_writer_rotate(
+        DbnRollingWriterHandle handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial int dbento_dbn_rolling_writer_set_metadata(
+        DbnRollingWriterHandle handle,
+        string metadataJson,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_rolling_writer_flush(
+        DbnRollingWriterHandle handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_rolling_writer_current_path(
+        DbnRollingWriterHandle handle,
+        byte[] pathBuffer,
+        nuint pathBufferSize,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial int dbento_dbn_rolling_writer_finish(
+        DbnRollingWriterHandle handle,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
+    [LibraryImport(LibName)]
+    public static partial void dbento_dbn_rolling_writer_destroy(IntPtr handle);
+
     // ========================================================================
     // Symbology Resolution API
     // ========================================================================
@@ -587,6 +1074,20 @@ public static partial class NativeMethods
         byte[]? errorBuffer,
         nuint errorBufferSize);
 
+    [LibraryImport(LibName, StringMarshalling = StringMarshalling.Utf8)]
+    public static partial IntPtr dbento_historical_symbology_resolve_cached(
+        HistoricalClientHandle handle,
+        string dataset,
+        string[] symbols,
+        nuint symbolCount,
+        string stypeIn,
+        string stypeOut,
+        string startDate,
+        string endDate,
+        string cacheDir,
+        byte[]? errorBuffer,
+        nuint errorBufferSize);
+
     [LibraryImport(LibName)]
     public static partial nuint dbento_symbology_resolution_mappings_count(
         IntPtr handle);
@@ -645,6 +1146,13 @@ public static partial class NativeMethods
     public static partial int dbento_symbology_resolution_get_stype_out(
         IntPtr handle);
 
+    [LibraryImport(LibName)]
+    public static partial int dbento_symbology_resolution_export(
+        IntPtr handle,
+        byte[]? buffer,
+        nuint bufferSize,
+        out nuint requiredSize);
+
     [LibraryImport(LibName)]
     public static partial void dbento_symbology_resolution_destroy(IntPtr handle);
 
@@ -28,8 +28,11 @@ typedef void* DbentoTsSymbolMapHandle;
 typedef void* DbentoPitSymbolMapHandle;
 typedef void* DbnFileReaderHandle;
 typedef void* DbnFileWriterHandle;
+typedef void* DbnMergeReaderHandle;
 typedef void* DbentoSymbologyResolutionHandle;
 typedef void* DbentoUnitPricesHandle;
+typedef void* DbentoArrowBuilderHandle;
+typedef void* DbnRollingWriterHandle;
 
 // ============================================================================
 // Callback Types
@@ -603,6 +606,50 @@ DATABENTO_API int dbento_historical_get_range_to_file_with_symbology(
     size_t error_buffer_size
 );
 
+/**
+ * Query historical time series data and save to a DBN file as resumable, parallel chunks
+ *
+ * The range is split into chunks aligned to multiples of chunk_duration_ns since the
+ * Unix epoch (so daily chunks start at UTC midnight). Chunks are downloaded in parallel
+ * into "<file_path>.chunks/" and recorded in "<file_path>.chunks/manifest.json" as they
+ * complete. Re-running the same request after a failure only fetches missing chunks.
+ *
+ * @param handle Historical client handle
+ * @param file_path Output file path (chunk directory and manifest are derived from it)
+ * @param dataset Dataset name (e.g., "GLBX.MDP3")
+ * @param schema Schema name (e.g., "trades", "mbp-1")
+ * @param symbols Array of symbol strings
+ * @param symbol_count Number of symbols
+ * @param start_time_ns Start time (nanoseconds since Unix epoch)
+ * @param end_time_ns End time (nanoseconds since Unix epoch)
+ * @param stype_in Input symbology type (NULL for "raw_symbol")
+ * @param stype_out Output symbology type (NULL for "instrument_id")
+ * @param chunk_duration_ns Chunk length in nanoseconds (0 or negative = 1 day, min 1 minute)
+ * @param max_parallel Maximum concurrent chunk downloads (0 or negative = 4, max 32)
+ * @param concatenate Non-zero to merge all chunks into file_path (zstd-compressed DBN)
+ *                    and remove the chunk directory once every chunk has completed
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative error code on failure (completed chunks are kept)
+ */
+DATABENTO_API int dbento_historical_get_range_to_file_chunked(
+    DbentoHistoricalClientHandle handle,
+    const char* file_path,
+    const char* dataset,
+    const char* schema,
+    const char** symbols,
+    size_t symbol_count,
+    int64_t start_time_ns,
+    int64_t end_time_ns,
+    const char* stype_in,
+    const char* stype_out,
+    int64_t chunk_duration_ns,
+    int max_parallel,
+    int concatenate,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Get metadata for a historical query
  * @param handle Historical client handle
@@ -861,6 +908,33 @@ DATABENTO_API const char* dbento_metadata_get_billing_info(
     char* error_buffer,
     size_t error_buffer_size);
 
+/**
+ * Configure the process-wide metadata response cache
+ *
+ * Applies to dbento_metadata_list_datasets, list_publishers, list_schemas, list_fields,
+ * get_dataset_condition (both variants) and get_dataset_range. Cached JSON responses are
+ * returned without a network round trip until they are older than ttl_seconds. When
+ * snapshot_path is set, the cache is warmed from that file immediately and rewritten
+ * after each new entry, so later processes start warm. Entries are keyed per API key.
+ * Reconfiguring drops the in-memory entries and reloads from the snapshot.
+ *
+ * @param ttl_seconds Time-to-live in seconds (0 disables caching, the default)
+ * @param snapshot_path Optional on-disk snapshot file (can be NULL for memory only)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 on failure, -2 on invalid parameters
+ */
+DATABENTO_API int dbento_metadata_cache_configure(
+    int64_t ttl_seconds,
+    const char* snapshot_path,
+    char* error_buffer,
+    size_t error_buffer_size);
+
+/**
+ * Drop all cached metadata responses, including the on-disk snapshot
+ */
+DATABENTO_API void dbento_metadata_cache_clear(void);
+
 // ============================================================================
 // Symbol Map API
 // ============================================================================
@@ -1086,6 +1160,10 @@ DATABENTO_API const char* dbento_batch_download_file(
 
 /**
  * Open a DBN file for reading
+ *
+ * Files in the zstd seekable format (see dbento_dbn_file_create_seekable) are decompressed
+ * frame-parallel on a worker pool, with records still delivered in file order.
+ *
  * @param file_path Path to the DBN file
  * @param error_buffer Buffer for error messages
  * @param error_buffer_size Size of error buffer
@@ -1097,6 +1175,97 @@ DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open(
     size_t error_buffer_size
 );
 
+/**
+ * Open a DBN file for zero-copy reading via a read-only memory mapping
+ *
+ * Uncompressed DBN files at the current DBN version are mapped and iterated in place,
+ * with sequential read-ahead hints (madvise on POSIX). zstd-compressed files and files that
+ * need a version upgrade transparently fall back to the buffered reader used by
+ * dbento_dbn_file_open. The returned handle works with every dbento_dbn_file_* reader call.
+ *
+ * @param file_path Path to the DBN file
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file reader, or NULL on failure
+ */
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_mapped(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open DBN data held in memory
+ *
+ * Accepts the same content as a file: uncompressed, zstd or seekable zstd, any DBN version.
+ * Uncompressed current-version data is read in place like dbento_dbn_file_open_mapped, and
+ * seekable zstd data is decompressed frame-parallel. Seek indexes (.dbnidx) do not apply.
+ *
+ * @param data DBN bytes, including the metadata header
+ * @param size Number of bytes
+ * @param copy Non-zero to copy the bytes; 0 to read them in place, in which case they must
+ *             stay valid and unchanged until the reader is destroyed
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file reader, or NULL on failure
+ */
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_memory(
+    const uint8_t* data,
+    size_t size,
+    int copy,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open DBN data from a file descriptor (POSIX) or file/pipe HANDLE (Windows)
+ *
+ * Regular files are memory-mapped and read from the start. Pipes, sockets and other streams
+ * are decoded as they arrive from the current position (zstd included); they can be read
+ * and seeked forward by ordinal or time, but seeking back to a record already delivered
+ * fails. The descriptor stays owned
+ * by the caller, must remain open until the reader is destroyed, and is not closed.
+ *
+ * @param descriptor File descriptor, or HANDLE cast to intptr_t on Windows
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file reader, or NULL on failure
+ */
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_descriptor(
+    intptr_t descriptor,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Open a DBN file for reading with background read-ahead
+ *
+ * A background thread reads (and for zstd files, decompresses) the next blocks while the
+ * caller processes the current one, hiding storage latency on cold caches and network
+ * filesystems. Seekable zstd files are still decoded frame-parallel instead.
+ *
+ * @param file_path Path to DBN file
+ * @param block_size Bytes per read-ahead block (0 = default of 1 MiB)
+ * @param block_count Blocks in flight, including the one being consumed (0 = default of 3)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file reader, or NULL on failure
+ */
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_prefetch(
+    const char* file_path,
+    size_t block_size,
+    size_t block_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Check whether a reader is using the zero-copy memory-mapped mode
+ * @param handle DBN file reader handle
+ * @return 1 if memory-mapped, 0 if buffered, -1 on invalid handle
+ */
+DATABENTO_API int dbento_dbn_file_is_mapped(DbnFileReaderHandle handle);
+
 /**
  * Get metadata from a DBN file
  * @param handle DBN file reader handle
@@ -1131,12 +1300,730 @@ DATABENTO_API int dbento_dbn_file_next_record(
     size_t error_buffer_size
 );
 
+/**
+ * Read as many whole records as fit into a caller buffer in one call
+ *
+ * Records are copied back-to-back into buffer; record_offsets[i] receives the byte offset of
+ * record i. Each record's length and type can be read from its own header (length byte * 4,
+ * rtype byte). A record that does not fit is kept and returned first by the next call.
+ *
+ * @param handle DBN file reader handle
+ * @param buffer Destination buffer
+ * @param buffer_capacity Size of destination buffer in bytes
+ * @param record_offsets Output: byte offset of each record in buffer (max_records entries)
+ * @param max_records Maximum number of records to read
+ * @param record_count Output: number of records read
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 if at least one record was read, 1 on EOF, -3 if the next record alone exceeds
+ *         buffer_capacity, other negative values on error
+ */
+DATABENTO_API int dbento_dbn_file_next_records(
+    DbnFileReaderHandle handle,
+    uint8_t* buffer,
+    size_t buffer_capacity,
+    size_t* record_offsets,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Advance to the next record without copying it into a caller buffer
+ *
+ * For memory-mapped readers the pointer refers directly into the file mapping and stays
+ * valid until the reader is closed. For buffered readers it refers to the decoder's
+ * internal buffer and is only valid until the next read call on the same handle.
+ *
+ * @param handle DBN file reader handle
+ * @param record_ptr Output: pointer to the record bytes (NULL at EOF)
+ * @param record_length Output: length of the record
+ * @param record_type Output: record type identifier
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 on EOF, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_next_record_view(
+    DbnFileReaderHandle handle,
+    const uint8_t** record_ptr,
+    size_t* record_length,
+    uint8_t* record_type,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Build a sparse timestamp index (`<file_path>.dbnidx`) for a DBN file
+ *
+ * Every `interval` records the index stores a checkpoint of (timestamp bound, byte offset,
+ * record ordinal), letting dbento_dbn_file_seek_ordinal and dbento_dbn_file_seek_time jump
+ * close to their target instead of decoding from the start of the file. Readers pick the
+ * sidecar up automatically and ignore it once the DBN file's size or modification time
+ * changes. Seekable zstd files jump to the frame holding the checkpoint; plain zstd streams
+ * cannot be entered mid-stream, so seeks in them decode forward from the start of the file.
+ *
+ * @param file_path Path to the DBN file
+ * @param interval Records between checkpoints (0 = default of 4096)
+ * @param ts_field Timestamp to index: 0 = ts_event, 1 = ts_recv (ts_event for records without one)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_build_index(
+    const char* file_path,
+    uint32_t interval,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Position a reader so the next record read is record number `ordinal` (zero-based)
+ *
+ * Uses the `.dbnidx` sidecar when present; seeking past the last record positions the
+ * reader at EOF.
+ *
+ * @param handle DBN file reader handle
+ * @param ordinal Zero-based record number
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_seek_ordinal(
+    DbnFileReaderHandle handle,
+    uint64_t ordinal,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Position a reader at the first record whose timestamp is >= timestamp_ns
+ *
+ * Uses the `.dbnidx` sidecar when it was built for the same ts_field. Records need not be
+ * strictly sorted: the result is always the first qualifying record in file order.
+ *
+ * @param handle DBN file reader handle
+ * @param timestamp_ns Target timestamp in nanoseconds since the UNIX epoch
+ * @param ts_field Timestamp to compare: 0 = ts_event, 1 = ts_recv
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_seek_time(
+    DbnFileReaderHandle handle,
+    uint64_t timestamp_ns,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Get the zero-based ordinal of the next record a reader will return
+ * @param handle DBN file reader handle
+ * @return Record ordinal, or -1 on invalid handle
+ */
+DATABENTO_API int64_t dbento_dbn_file_position(DbnFileReaderHandle handle);
+
 /**
  * Close a DBN file and free resources
  * @param handle DBN file reader handle
  */
 DATABENTO_API void dbento_dbn_file_close(DbnFileReaderHandle handle);
 
+// ============================================================================
+// DBN Columnar Projection API
+// ============================================================================
+
+/**
+ * Get the element type of a projectable record field
+ *
+ * Type codes: 1 = uint8, 2 = char (one ASCII byte), 3 = uint16, 4 = uint32, 5 = int32,
+ * 6 = uint64, 7 = int64. Timestamps are uint64 nanoseconds since the UNIX epoch, prices are
+ * int64 fixed-point with 1e-9 units, ts_in_delta is int32 nanoseconds.
+ *
+ * Every rtype has the header fields rtype, publisher_id, instrument_id and ts_event; book
+ * levels are flattened as bid_px_00, ask_sz_09, etc. Field names follow the DBN schema.
+ *
+ * @param rtype Record type (e.g. 0x00 trades, 0x01 MBP-1, 0xA0 MBO)
+ * @param field_name Field name
+ * @return Type code, or -1 if the rtype has no such field
+ */
+DATABENTO_API int dbento_dbn_field_type(uint8_t rtype, const char* field_name);
+
+/**
+ * Decode records of one rtype straight into struct-of-arrays columns
+ *
+ * Reads forward from the reader's current position (combine with the seek functions to
+ * project a range) and copies the selected fields of each record with the given rtype into
+ * out_columns[i][row]; records of other rtypes are skipped. Each output column must hold
+ * max_rows elements of the field's type (see dbento_dbn_field_type). Memory-mapped readers
+ * project in place without materializing records.
+ *
+ * @param handle DBN file reader handle
+ * @param rtype Record type to project
+ * @param field_names Array of field names
+ * @param field_count Number of fields
+ * @param out_columns Array of field_count column buffers
+ * @param max_rows Maximum number of rows to project
+ * @param row_count Output: number of rows written
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 if at least one row was written, 1 on EOF, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_project(
+    DbnFileReaderHandle handle,
+    uint8_t rtype,
+    const char** field_names,
+    size_t field_count,
+    void** out_columns,
+    size_t max_rows,
+    size_t* row_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// DBN Columnar Export API
+// ============================================================================
+//
+// Output formats: 0 = Arrow IPC file (Feather v2), 1 = Parquet
+// Compression: 0 = none, 1 = zstd (Arrow IPC body compression / Parquet ZSTD codec)
+
+/**
+ * Convert the remaining records of a DBN reader into an Arrow IPC or Parquet file
+ *
+ * Records of one rtype are projected into columns (see dbento_dbn_file_project) one row
+ * group at a time, and row groups are encoded and compressed on a worker pool while the
+ * next one is read. Columns keep their DBN types: prices are int64 fixed-point (1e-9),
+ * ts_* fields are UTC nanosecond timestamps and action/side are one-character strings.
+ * On error the partially written output file is removed.
+ *
+ * @param handle DBN file reader handle (exported from its current position)
+ * @param output_path Path of the file to create (overwritten if it exists)
+ * @param format Output format code
+ * @param rtype Record type to export, or -1 for the rtype of the first data record
+ * @param field_names Fields to export in order, or NULL for every field of the rtype
+ * @param field_count Number of field names (0 with NULL field_names)
+ * @param row_group_size Rows per row group / record batch (0 = sized to ~64 MiB of values)
+ * @param compression Compression code
+ * @param thread_count Encoding threads (0 = default)
+ * @param rows_written Output: number of rows written (may be NULL)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_export(
+    DbnFileReaderHandle handle,
+    const char* output_path,
+    int format,
+    int rtype,
+    const char** field_names,
+    size_t field_count,
+    size_t row_group_size,
+    int compression,
+    int thread_count,
+    uint64_t* rows_written,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// Arrow C Data Interface API
+// ============================================================================
+//
+// Record batches are handed out as a struct array (format "+s") whose children are the
+// projected fields, using the column types of dbento_dbn_file_export. The caller owns
+// the exported ArrowSchema/ArrowArray and must call their release callbacks (or move
+// them into an Arrow implementation, which then does). Buffers are never copied again.
+
+#ifndef ARROW_C_DATA_INTERFACE
+#define ARROW_C_DATA_INTERFACE
+
+#define ARROW_FLAG_DICTIONARY_ORDERED 1
+#define ARROW_FLAG_NULLABLE 2
+#define ARROW_FLAG_MAP_KEYS_SORTED 4
+
+struct ArrowSchema {
+    const char* format;
+    const char* name;
+    const char* metadata;
+    int64_t flags;
+    int64_t n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema* dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray {
+    int64_t length;
+    int64_t null_count;
+    int64_t offset;
+    int64_t n_buffers;
+    int64_t n_children;
+    const void** buffers;
+    struct ArrowArray** children;
+    struct ArrowArray* dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+
+#endif  // ARROW_C_DATA_INTERFACE
+
+/**
+ * Read the next batch of records of one rtype from a DBN reader as an Arrow record batch
+ *
+ * Fields are projected straight into the batch's buffers (see dbento_dbn_file_project).
+ *
+ * @param handle DBN file reader handle
+ * @param rtype Record type to read
+ * @param field_names Fields in column order, or NULL for every field of the rtype
+ * @param field_count Number of field names (0 with NULL field_names)
+ * @param max_rows Maximum number of rows in the batch
+ * @param out_schema Output: batch schema (caller releases)
+ * @param out_array Output: batch data (caller releases); untouched on EOF
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 if a batch was exported, 1 on EOF, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_read_arrow(
+    DbnFileReaderHandle handle,
+    uint8_t rtype,
+    const char** field_names,
+    size_t field_count,
+    size_t max_rows,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Create a builder accumulating records of one rtype into Arrow columns
+ *
+ * Feed it raw records from any source: dbento_arrow_builder_append, the native record
+ * callback (historical and live clients) or dbento_live_blocking_next_arrow. It is safe to
+ * append from one thread while another finishes batches.
+ *
+ * @param rtype Record type to collect (records of other types are skipped)
+ * @param field_names Fields in column order, or NULL for every field of the rtype
+ * @param field_count Number of field names (0 with NULL field_names)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to builder, or NULL on error
+ */
+DATABENTO_API DbentoArrowBuilderHandle dbento_arrow_builder_create(
+    uint8_t rtype,
+    const char** field_names,
+    size_t field_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Append whole DBN records laid out back to back
+ * @param handle Builder handle
+ * @param records Record bytes
+ * @param length Total length in bytes
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_arrow_builder_append(
+    DbentoArrowBuilderHandle handle,
+    const uint8_t* records,
+    size_t length,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * RecordCallback that appends each record to the builder passed as user_data
+ *
+ * Pass it with a builder handle to dbento_historical_get_range (or a live client) so
+ * records are collected without a managed callback per record.
+ */
+DATABENTO_API RecordCallback dbento_arrow_builder_record_callback(void);
+
+/**
+ * Number of rows accumulated since the last finished batch
+ */
+DATABENTO_API int64_t dbento_arrow_builder_row_count(DbentoArrowBuilderHandle handle);
+
+/**
+ * Hand the accumulated rows out as an Arrow record batch and start a new one
+ * @param handle Builder handle
+ * @param out_schema Output: batch schema (caller releases)
+ * @param out_array Output: batch data, possibly with 0 rows (caller releases)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_arrow_builder_finish(
+    DbentoArrowBuilderHandle handle,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Destroy a builder (batches already handed out stay valid)
+ * @param handle Builder handle
+ */
+DATABENTO_API void dbento_arrow_builder_destroy(DbentoArrowBuilderHandle handle);
+
+/**
+ * Pull records from a LiveBlocking client into a builder
+ *
+ * Blocks until max_rows rows of the builder's rtype were added or timeout_ms elapsed
+ * without a record; other records (system, symbol mapping, other rtypes) are consumed and
+ * skipped.
+ *
+ * @param handle LiveBlocking client handle
+ * @param builder Builder handle
+ * @param max_rows Maximum number of rows to add
+ * @param timeout_ms Timeout in milliseconds for each record (-1 for no timeout)
+ * @param rows_added Output: number of rows added
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 if any rows were added (fewer than max_rows if the timeout elapsed), 1 on
+ *         timeout with no rows added, negative on error
+ */
+DATABENTO_API int dbento_live_blocking_next_arrow(
+    DbentoLiveClientHandle handle,
+    DbentoArrowBuilderHandle builder,
+    size_t max_rows,
+    int timeout_ms,
+    size_t* rows_added,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// Analytics Kernels API
+// ============================================================================
+//
+// Vectorized kernels over projected columns (see dbento_dbn_file_project). Prices are DBN
+// int64 fixed-point values in 1e-9 units; UNDEF_PRICE (INT64_MAX) rows are skipped or
+// mapped to NaN. On x86-64 CPUs with AVX2 an AVX2 implementation is selected at runtime,
+// otherwise a portable scalar one. Sums may differ from a sequential sum in the last bits.
+
+/**
+ * Get the instruction set the kernels dispatch to
+ * @return 0 = scalar, 1 = AVX2
+ */
+DATABENTO_API int dbento_kernel_simd_level(void);
+
+/**
+ * Convert fixed-point prices to doubles (UNDEF_PRICE becomes NaN)
+ * @param prices Input prices
+ * @param count Number of prices
+ * @param out_values Output array of count doubles
+ * @return 0 on success, -2 on invalid parameters
+ */
+DATABENTO_API int dbento_kernel_prices_to_double(
+    const int64_t* prices,
+    size_t count,
+    double* out_values
+);
+
+/**
+ * Volume-weighted average price, sum(price * size) / sum(size)
+ * @param prices Fixed-point prices
+ * @param sizes Sizes
+ * @param count Number of rows
+ * @return VWAP as a double, or NaN if there is no volume
+ */
+DATABENTO_API double dbento_kernel_vwap(
+    const int64_t* prices,
+    const uint32_t* sizes,
+    size_t count
+);
+
+/**
+ * Count, min/max price, volume and notional per instrument
+ *
+ * Groups are returned in order of first appearance. Runs of rows with the same instrument
+ * are processed vectorized. Notional is sum(price * size) in price units, so the VWAP of a
+ * group is notional / volume. Groups without a defined price have min/max UNDEF_PRICE.
+ *
+ * @param instrument_ids Instrument ID column
+ * @param prices Fixed-point price column
+ * @param sizes Size column
+ * @param count Number of rows
+ * @param out_instrument_ids Output: instrument ID of each group
+ * @param out_counts Output: rows with a defined price
+ * @param out_min_prices Output: minimum fixed-point price
+ * @param out_max_prices Output: maximum fixed-point price
+ * @param out_volumes Output: sum of sizes
+ * @param out_notionals Output: sum of price * size
+ * @param capacity Number of groups each output array can hold
+ * @param group_count Output: number of groups (also set when capacity is too small)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -3 if there are more groups than capacity, other negative values on error
+ */
+DATABENTO_API int dbento_kernel_instrument_stats(
+    const uint32_t* instrument_ids,
+    const int64_t* prices,
+    const uint32_t* sizes,
+    size_t count,
+    uint32_t* out_instrument_ids,
+    uint64_t* out_counts,
+    int64_t* out_min_prices,
+    int64_t* out_max_prices,
+    uint64_t* out_volumes,
+    double* out_notionals,
+    size_t capacity,
+    size_t* group_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Period-over-period returns of a price series
+ *
+ * out_returns[0] is NaN; out_returns[i] = values[i] / values[i - 1] - 1, or the log of the
+ * ratio when log_returns is non-zero.
+ *
+ * @param values Prices (e.g. from dbento_kernel_prices_to_double)
+ * @param count Number of values
+ * @param log_returns Non-zero for log returns
+ * @param out_returns Output array of count doubles (must not alias values)
+ * @return 0 on success, -2 on invalid parameters
+ */
+DATABENTO_API int dbento_kernel_returns(
+    const double* values,
+    size_t count,
+    int log_returns,
+    double* out_returns
+);
+
+/**
+ * Rolling mean and sample variance over a fixed window of rows
+ *
+ * Outputs are NaN until the window is full and while it contains a NaN.
+ *
+ * @param values Input values
+ * @param count Number of values
+ * @param window Window length in rows
+ * @param out_means Output array of count doubles (may be NULL)
+ * @param out_variances Output array of count doubles (may be NULL)
+ * @return 0 on success, -2 on invalid parameters
+ */
+DATABENTO_API int dbento_kernel_rolling_mean_var(
+    const double* values,
+    size_t count,
+    size_t window,
+    double* out_means,
+    double* out_variances
+);
+
+// ============================================================================
+// DBN File Summary API
+// ============================================================================
+
+/**
+ * Scan one or more DBN files and summarize their records in a single pass
+ *
+ * Files under 32 MiB are summarized whole, one per worker, so many small files run in
+ * parallel; larger files are cut into chunks on record boundaries (in place for
+ * uncompressed files, after frame-parallel decompression for seekable zstd files) that are
+ * summarized on the same worker pool. The result is a JSON object:
+ *
+ *   files, record_count, total_bytes,
+ *   ts_event / ts_recv: {min, max} in UNIX nanoseconds, or null (ts_recv only counts
+ *     records that carry one),
+ *   out_of_order: records whose ts_recv (ts_event if absent) is earlier than that of the
+ *     previous record in the same file,
+ *   rtypes: [{rtype, count, bytes}], record_sizes: [{length, count}],
+ *   publishers: [{publisher_id, count}], instruments: [{instrument_id, count}]
+ *
+ * @param file_paths Paths of the DBN files (any compression or version)
+ * @param file_count Number of paths
+ * @param thread_count Worker threads (0 = hardware threads, capped at 8)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return JSON summary, or NULL on failure (must be freed with dbento_free_string)
+ */
+DATABENTO_API const char* dbento_dbn_file_summarize(
+    const char** file_paths,
+    size_t file_count,
+    int thread_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// DBN Bulk Upgrade API
+// ============================================================================
+
+// Compression: -1 = same as the input (zstd inputs are written in the seekable format),
+// 0 = none (.dbn), 1 = seekable zstd (.dbn.zst)
+
+/**
+ * Upgrade DBN v1/v2 files to the current DBN version, optionally recompressing them
+ *
+ * input_path is a single file or a directory searched recursively for *.dbn and *.dbn.zst.
+ * Records are decoded with VersionUpgradePolicy::UpgradeToV3 and re-encoded, one file per
+ * task on a bounded worker pool. Outputs are written to a temporary file and renamed into
+ * place, so a failure never leaves a partial file. One failing file does not stop the others.
+ * Files whose output would also be another file's output or input (e.g. foo.dbn and
+ * foo.dbn.zst in one directory) fail without being touched.
+ *
+ * @param input_path DBN file or directory
+ * @param output_dir Directory mirroring the input tree, or NULL to upgrade in place (an
+ *                   original whose extension changes with the compression is removed)
+ * @param compression Output compression (see above)
+ * @param compression_level zstd level (0 = default of 3)
+ * @param skip_current Non-zero to leave files already at the current version untouched when
+ *                     their compression would not change
+ * @param thread_count Files processed concurrently (0 = hardware threads, capped at 8)
+ * @param files_upgraded Output: files written (can be NULL)
+ * @param files_skipped Output: files left untouched by skip_current (can be NULL)
+ * @param files_failed Output: files that could not be upgraded (can be NULL)
+ * @param error_buffer Buffer for error messages (the first failure when 1 is returned)
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, 1 if some files failed, -2 on invalid parameters, -1 on other errors
+ */
+DATABENTO_API int dbento_dbn_upgrade_files(
+    const char* input_path,
+    const char* output_dir,
+    int compression,
+    int compression_level,
+    int skip_current,
+    int thread_count,
+    uint64_t* files_upgraded,
+    uint64_t* files_skipped,
+    uint64_t* files_failed,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// DBN Split API
+// ============================================================================
+
+// Split key: 0 = instrument_id, 1 = publisher_id, 2 = hour (UTC, of ts_recv, else ts_event)
+
+/**
+ * Split a DBN file into one file per instrument, publisher or hour in a single pass
+ *
+ * The input (any compression or version) is read once; records are gathered per output
+ * and written in batches by a pool of writer threads, each output keeping the input order.
+ * Every output starts with the input metadata narrowed to its partition: per-instrument
+ * files keep only the symbol mappings and symbols resolving to that instrument, and
+ * per-hour files have start/end set to the hour and keep the mappings of that day. On
+ * failure, the outputs written so far are removed. Existing outputs are overwritten.
+ *
+ * @param input_path DBN file to split
+ * @param key Split key (see above)
+ * @param output_pattern Output path containing `{key}`, replaced by the instrument or
+ *                       publisher ID or by the hour as YYYYMMDDTHH; a `.zst` suffix writes
+ *                       seekable zstd (e.g. "out/{key}.dbn.zst")
+ * @param compression_level zstd level for compressed outputs (0 = default of 3)
+ * @param thread_count Writer threads (0 = hardware threads, capped at 8)
+ * @param records Output: records written (can be NULL)
+ * @param files Output: files written (can be NULL)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -2 on invalid parameters, -1 on other errors
+ */
+DATABENTO_API int dbento_dbn_split(
+    const char* input_path,
+    int key,
+    const char* output_pattern,
+    int compression_level,
+    int thread_count,
+    uint64_t* records,
+    uint64_t* files,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+// ============================================================================
+// DBN Merge Reader API
+// ============================================================================
+
+/**
+ * Open several DBN files as one stream merged by timestamp
+ *
+ * Records are returned in ascending order of the chosen timestamp; records with equal
+ * timestamps keep the order of file_paths. Each file is assumed to be sorted by that
+ * timestamp already (as Databento files are by ts_recv). Inputs are memory-mapped when
+ * possible, seekable zstd inputs are decompressed frame-parallel, and other inputs are
+ * read ahead on a background thread when at most 8 files are merged (read in place
+ * otherwise, to bound threads and memory for large fan-in).
+ *
+ * @param file_paths Array of DBN file paths
+ * @param file_count Number of file paths
+ * @param ts_field Timestamp to merge on: 0 = ts_event, 1 = ts_recv (ts_event for records without one)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to the merge reader, or NULL on failure
+ */
+DATABENTO_API DbnMergeReaderHandle dbento_dbn_merge_open(
+    const char** file_paths,
+    size_t file_count,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Read as many merged records as fit into a caller buffer in one call
+ *
+ * Same buffer layout as dbento_dbn_file_next_records. A record that does not fit is
+ * returned first by the next call.
+ *
+ * @param handle Merge reader handle
+ * @param buffer Destination buffer
+ * @param buffer_capacity Size of destination buffer in bytes
+ * @param record_offsets Output: byte offset of each record in buffer (max_records entries)
+ * @param source_indices Optional output: index into file_paths of each record's file (may be NULL)
+ * @param max_records Maximum number of records to read
+ * @param record_count Output: number of records read
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 if at least one record was read, 1 on EOF, -3 if the next record alone exceeds
+ *         buffer_capacity, other negative values on error
+ */
+DATABENTO_API int dbento_dbn_merge_next_records(
+    DbnMergeReaderHandle handle,
+    uint8_t* buffer,
+    size_t buffer_capacity,
+    size_t* record_offsets,
+    uint32_t* source_indices,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Position every input at its first record with timestamp >= timestamp_ns
+ * (using each file's `.dbnidx` sidecar when present)
+ * @param handle Merge reader handle
+ * @param timestamp_ns Target timestamp in nanoseconds since the UNIX epoch
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_merge_seek_time(
+    DbnMergeReaderHandle handle,
+    uint64_t timestamp_ns,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Close a merge reader and all of its input files
+ * @param handle Merge reader handle
+ */
+DATABENTO_API void dbento_dbn_merge_close(DbnMergeReaderHandle handle);
+
 // ============================================================================
 // DBN File Writer API
 // ============================================================================
@@ -1156,11 +2043,43 @@ DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create(
     size_t error_buffer_size
 );
 
+/**
+ * Create a DBN file writer that emits zstd in the seekable format
+ *
+ * Records are compressed in independently decodable frames of about frame_size uncompressed
+ * bytes, always cut on record boundaries, followed by a seek table. The output is a valid
+ * `.dbn.zst` file for any zstd decoder; dbento_dbn_file_open decompresses its frames in
+ * parallel and seeks into it without decoding from the start.
+ *
+ * With worker threads, full frames are compressed in the background while records keep
+ * being written, and compressed frames are written in order as they complete (at most two
+ * per worker in flight), so live recordings can be stored compressed directly.
+ *
+ * @param file_path Path where the `.dbn.zst` file will be created
+ * @param metadata_json JSON string containing DBN metadata
+ * @param compression_level zstd compression level (e.g. 3; negative levels favour speed)
+ * @param frame_size Target uncompressed bytes per frame (0 = default of 1 MiB)
+ * @param worker_threads Background compression threads (0 = compress on the writing thread)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to DBN file writer, or NULL on failure
+ */
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create_seekable(
+    const char* file_path,
+    const char* metadata_json,
+    int compression_level,
+    size_t frame_size,
+    int worker_threads,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Write a record to a DBN file
  * @param handle DBN file writer handle
  * @param record_bytes Raw record data (DBN format)
- * @param record_length Length of record in bytes
+ * @param record_length Length of record in bytes; must equal the length in its header
+ *        (use dbento_dbn_file_write_records for several records)
  * @param error_buffer Buffer for error messages
  * @param error_buffer_size Size of error buffer
  * @return 0 on success, negative on error
@@ -1173,12 +2092,340 @@ DATABENTO_API int dbento_dbn_file_write_record(
     size_t error_buffer_size
 );
 
+/**
+ * Write a run of records laid out back to back in one call
+ *
+ * Records are copied straight into the writer's 1 MiB output buffer with no per-record
+ * allocation. Every record length is checked first, so a truncated or corrupt run writes
+ * nothing.
+ * @param handle DBN file writer handle
+ * @param records Raw record data (DBN format, whole records)
+ * @param length Length of the data in bytes
+ * @param records_written Output: number of records written (can be NULL)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_write_records(
+    DbnFileWriterHandle handle,
+    const uint8_t* records,
+    size_t length,
+    size_t* records_written,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Move a DBN file writer to background mode
+ *
+ * Later writes only copy records into a lock-free single-producer queue and return; a
+ * dedicated thread writes them to the file, so disk latency (writeback, fsync) no longer
+ * stalls the calling thread. Writes block only while the queue is full. The writer must
+ * still be used from one thread at a time. Errors on the writer thread are reported by the
+ * next write or flush.
+ *
+ * @param handle DBN file writer handle
+ * @param queue_capacity Queue size in bytes (0 = default of 16 MiB; minimum 64 KiB)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error (e.g. already in background mode)
+ */
+DATABENTO_API int dbento_dbn_file_start_background(
+    DbnFileWriterHandle handle,
+    size_t queue_capacity,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Hand written records to the OS (for seekable zstd output: close the open frame)
+ *
+ * In background mode, first waits until the writer thread has written every queued record.
+ * @param handle DBN file writer handle
+ * @param sync Non-zero to also wait until the data is on the device (fsync)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_flush(
+    DbnFileWriterHandle handle,
+    int sync,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Checkpoint a DBN file writer periodically for crash recovery
+ *
+ * As records are written, and at most once per interval (by time and/or by output size),
+ * the file is synced to the device and its durable length, record count and last timestamp
+ * are recorded in a `<file>.ckpt` sidecar (replaced atomically). A clean close removes the
+ * sidecar; if it is still there, the writer did not shut down cleanly and the file should go
+ * through dbento_dbn_file_recover. Must be called before writing records.
+ *
+ * @param handle DBN file writer handle
+ * @param interval_ms Checkpoint after this many milliseconds (0 = not by time)
+ * @param interval_bytes Checkpoint after this many bytes of output (0 = not by size)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_enable_checkpoints(
+    DbnFileWriterHandle handle,
+    uint64_t interval_ms,
+    uint64_t interval_bytes,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Build the seek index and record statistics of a DBN file while writing it
+ *
+ * Every record written is fed to the same sparse index dbento_dbn_file_build_index builds,
+ * to the counts of dbento_dbn_file_summarize and to per-instrument zone maps (record count,
+ * first/last ordinal and timestamp range). When the writer closes cleanly, the index is
+ * saved as `<file_path>.dbnidx`, picked up by readers automatically, and the statistics as
+ * `<file_path>.stats.json`: the summary JSON plus source_size (the DBN file's size, to
+ * detect a stale sidecar), zone_timestamp and
+ * zones: [{instrument_id, count, first_ordinal, last_ordinal, ts: {min, max}}].
+ * Freshly recorded files then need no separate indexing pass. Must be called before
+ * writing records.
+ *
+ * @param handle DBN file writer handle
+ * @param interval Records between index checkpoints (0 = default of 4096)
+ * @param ts_field Timestamp for the index and zone maps: 0 = ts_event, 1 = ts_recv (ts_event for records without one)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_enable_index(
+    DbnFileWriterHandle handle,
+    uint32_t interval,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Checkpoint now: sync everything written so far and record it in the sidecar
+ *
+ * Fails unless checkpoints were enabled with dbento_dbn_file_enable_checkpoints. In
+ * background mode, first waits until the writer thread has written every queued record.
+ * @param handle DBN file writer handle
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_checkpoint(
+    DbnFileWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Repair a DBN file (plain or seekable zstd) left by an unclean shutdown
+ *
+ * Truncates a torn trailing record (for zstd, a torn frame, and rewrites the seek table) and
+ * sets the metadata end time to the last record's timestamp + 1 if it is unset or too early.
+ * For zstd files, the end time can only be patched if the metadata was written uncompressed,
+ * as dbento_dbn_file_create_seekable does. Fails without changing the file if fewer records
+ * are intact than its checkpoint sidecar recorded; on success, removes the sidecar. A file
+ * that was closed cleanly is left unchanged.
+ *
+ * @param file_path Path to the DBN file
+ * @param records Output: number of whole records in the repaired file (can be NULL)
+ * @param bytes_truncated Output: number of bytes cut from the end (can be NULL)
+ * @param end_patched Output: 1 if the metadata end time was updated (can be NULL)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_file_recover(
+    const char* file_path,
+    uint64_t* records,
+    uint64_t* bytes_truncated,
+    int* end_patched,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Complete a DBN file, reporting any error
+ *
+ * Writes what is buffered (for seekable zstd: the last frame and the seek table, which no
+ * flush writes). In background mode or with checkpoints, first waits for every queued
+ * record to be written and then syncs the file to the device. Saves the index and
+ * statistics sidecars if they are enabled, and removes the checkpoint sidecar. Only the
+ * first call has any effect; later writes fail. The handle must still be released with
+ * dbento_dbn_file_close_writer.
+ *
+ * @param handle DBN file writer handle
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -1 on error (e.g. disk full; the file may be incomplete)
+ */
+DATABENTO_API int dbento_dbn_file_finish(
+    DbnFileWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Close and finalize a DBN file writer
+ *
+ * Completes the file as dbento_dbn_file_finish does, unless that was already called, and
+ * releases the handle. Errors cannot be reported here: call dbento_dbn_file_finish first
+ * to observe them.
  * @param handle DBN file writer handle
  */
 DATABENTO_API void dbento_dbn_file_close_writer(DbnFileWriterHandle handle);
 
+// ============================================================================
+// DBN Rolling Writer API
+// ============================================================================
+
+/**
+ * Create a DBN writer that rolls over to a new file on time boundaries and at a size limit
+ *
+ * Files are named <file_prefix>-YYYYMMDDTHHMMSSZ-NNN.dbn[.zst] after the start of their
+ * range and opened on their first record, so a single writer never drops or reorders
+ * records at a boundary. Time boundaries follow the records' ts_recv (ts_event for records
+ * without one). Each file carries the current metadata with start/end set to its range: a
+ * file ended by a time boundary ends at it, any other at its last timestamp + 1, and a file
+ * continuing the same window starts where the previous one ended. Completed files are
+ * appended as JSON lines to the manifest: path, start, end, first_ts, last_ts, record_count,
+ * record_bytes, file_size, compressed.
+ *
+ * @param output_dir Directory for the files (created if missing)
+ * @param file_prefix File name prefix
+ * @param metadata_json JSON string containing DBN metadata for the files
+ * @param rotate_interval_ns Time between boundaries, e.g. 3600000000000 for hourly (0 = none)
+ * @param rotate_offset_ns Boundaries fall at offset + k * interval since the epoch (UTC), e.g.
+ *                         a daily interval offset to the session end
+ * @param max_file_bytes Start a new file before one would exceed this many record bytes
+ *                       (0 = no limit)
+ * @param compress Non-zero to write seekable zstd (.dbn.zst)
+ * @param compression_level zstd compression level
+ * @param frame_size Target uncompressed bytes per zstd frame (0 = default of 1 MiB)
+ * @param worker_threads Background zstd compression threads (0 = compress on the writing thread)
+ * @param manifest_path Manifest file (NULL = <output_dir>/<file_prefix>.manifest.jsonl)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to the rolling writer, or NULL on failure
+ */
+DATABENTO_API DbnRollingWriterHandle dbento_dbn_rolling_writer_create(
+    const char* output_dir,
+    const char* file_prefix,
+    const char* metadata_json,
+    uint64_t rotate_interval_ns,
+    uint64_t rotate_offset_ns,
+    uint64_t max_file_bytes,
+    int compress,
+    int compression_level,
+    size_t frame_size,
+    int worker_threads,
+    const char* manifest_path,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Write a run of records laid out back to back, rolling over files as needed
+ * @param handle Rolling writer handle
+ * @param records Raw record data (DBN format, whole records)
+ * @param length Length of the data in bytes
+ * @param records_written Output: number of records written (can be NULL)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_rolling_writer_write_records(
+    DbnRollingWriterHandle handle,
+    const uint8_t* records,
+    size_t length,
+    size_t* records_written,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Complete the current file now (e.g. at session end); the next record starts a new one
+ * @param handle Rolling writer handle
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_rolling_writer_rotate(
+    DbnRollingWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Replace the metadata (e.g. symbols after a subscription change) for files opened from now on
+ * @param handle Rolling writer handle
+ * @param metadata_json JSON string containing DBN metadata
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -2 if metadata_json is NULL, -1 on other errors
+ */
+DATABENTO_API int dbento_dbn_rolling_writer_set_metadata(
+    DbnRollingWriterHandle handle,
+    const char* metadata_json,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Hand the current file's buffered records to the OS
+ * @param handle Rolling writer handle
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_rolling_writer_flush(
+    DbnRollingWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Get the path of the file being written (empty between files)
+ * @param handle Rolling writer handle
+ * @param path_buffer Buffer for the path
+ * @param path_buffer_size Size of path buffer
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, -2 on invalid parameters, -3 if the buffer is too small, -1 on other errors
+ */
+DATABENTO_API int dbento_dbn_rolling_writer_current_path(
+    DbnRollingWriterHandle handle,
+    char* path_buffer,
+    size_t path_buffer_size,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Complete the current file and report any error doing so
+ * @param handle Rolling writer handle
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return 0 on success, negative on error
+ */
+DATABENTO_API int dbento_dbn_rolling_writer_finish(
+    DbnRollingWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
+/**
+ * Destroy a rolling writer, completing the current file (errors are not reported; call
+ * dbento_dbn_rolling_writer_finish first to observe them)
+ * @param handle Rolling writer handle
+ */
+DATABENTO_API void dbento_dbn_rolling_writer_destroy(DbnRollingWriterHandle handle);
+
 // ============================================================================
 // Symbology Resolution API
 // ============================================================================
@@ -1210,6 +2457,43 @@ DATABENTO_API DbentoSymbologyResolutionHandle dbento_historical_symbology_resolv
     size_t error_buffer_size
 );
 
+/**
+ * Resolve symbols like dbento_historical_symbology_resolve, backed by a persistent on-disk cache
+ *
+ * Results are stored per (API key, dataset, stype_in, stype_out) in a compact binary file
+ * under cache_dir, tracking for each symbol which dates have already been resolved. Only
+ * symbols and date ranges not yet cached are requested from the API (in batches of up to
+ * 2000 symbols); everything else is served from disk. Dates from the current UTC day on are
+ * never cached, since their answer can still change. Requests containing ALL_SYMBOLS bypass
+ * the cache. The returned handle is used with the regular dbento_symbology_resolution_* getters.
+ *
+ * @param handle Historical client handle
+ * @param dataset Dataset name (e.g., "GLBX.MDP3")
+ * @param symbols Array of symbol strings to resolve
+ * @param symbol_count Number of symbols in array
+ * @param stype_in Input symbology type (e.g., "raw_symbol", "instrument_id")
+ * @param stype_out Output symbology type (e.g., "raw_symbol", "continuous")
+ * @param start_date Start date in YYYY-MM-DD format (inclusive)
+ * @param end_date End date in YYYY-MM-DD format (exclusive)
+ * @param cache_dir Directory holding the cache files (created if missing)
+ * @param error_buffer Buffer for error messages
+ * @param error_buffer_size Size of error buffer
+ * @return Handle to symbology resolution result, or NULL on failure
+ */
+DATABENTO_API DbentoSymbologyResolutionHandle dbento_historical_symbology_resolve_cached(
+    DbentoHistoricalClientHandle handle,
+    const char* dataset,
+    const char** symbols,
+    size_t symbol_count,
+    const char* stype_in,
+    const char* stype_out,
+    const char* start_date,
+    const char* end_date,
+    const char* cache_dir,
+    char* error_buffer,
+    size_t error_buffer_size
+);
+
 /**
  * Get the number of mappings in the resolution result
  * @param handle Symbology resolution handle
@@ -1336,6 +2620,66 @@ DATABENTO_API int dbento_symbology_resolution_get_stype_out(
     DbentoSymbologyResolutionHandle handle
 );
 
+/**
+ * Bulk export layout for dbento_symbology_resolution_export
+ *
+ * The buffer starts with a DbentoSymbologyExportHeader. Every *_offset field is a byte offset
+ * from the start of the buffer to a 4-byte aligned array; strings are UTF-8 slices of the
+ * string table (not NUL-terminated), referenced by DbentoStringRef. Dates are encoded as
+ * YYYYMMDD integers (end dates exclusive). All fields use native byte order.
+ */
+typedef struct {
+    uint32_t offset;   // Byte offset into the string table
+    uint32_t length;   // Length in bytes
+} DbentoStringRef;
+
+typedef struct {
+    DbentoStringRef key;         // Input symbol
+    uint32_t first_interval;     // Index of the first interval in the intervals array
+    uint32_t interval_count;     // Number of consecutive intervals for this key
+} DbentoSymbologyMappingEntry;
+
+typedef struct {
+    int32_t start_date;          // YYYYMMDD (inclusive)
+    int32_t end_date;            // YYYYMMDD (exclusive)
+    DbentoStringRef symbol;      // Resolved symbol
+} DbentoSymbologyIntervalEntry;
+
+typedef struct {
+    uint32_t total_size;         // Total bytes of the export, including this header
+    int32_t stype_in;            // SType enum value
+    int32_t stype_out;           // SType enum value
+    uint32_t mapping_count;
+    uint32_t mappings_offset;    // DbentoSymbologyMappingEntry[mapping_count]
+    uint32_t interval_count;
+    uint32_t intervals_offset;   // DbentoSymbologyIntervalEntry[interval_count]
+    uint32_t partial_count;
+    uint32_t partial_offset;     // DbentoStringRef[partial_count]
+    uint32_t not_found_count;
+    uint32_t not_found_offset;   // DbentoStringRef[not_found_count]
+    uint32_t strings_size;
+    uint32_t strings_offset;     // UTF-8 string table
+} DbentoSymbologyExportHeader;
+
+/**
+ * Export all mappings, intervals, partial and not_found entries in one contiguous buffer
+ *
+ * Replaces per-item calls to get_mapping_key / get_intervals_count / get_interval with a
+ * single copy. Call with buffer = NULL to query the required size first.
+ *
+ * @param handle Symbology resolution handle
+ * @param buffer Destination buffer (can be NULL to query the size)
+ * @param buffer_size Size of destination buffer in bytes
+ * @param out_required_size Receives the number of bytes needed for the export
+ * @return 0 on success, -1 on error, -3 if buffer is too small
+ */
+DATABENTO_API int dbento_symbology_resolution_export(
+    DbentoSymbologyResolutionHandle handle,
+    uint8_t* buffer,
+    size_t buffer_size,
+    size_t* out_required_size
+);
+
 /**
  * Destroy a symbology resolution handle and free resources
  * @param handle Symbology resolution handle
@@ -0,0 +1,285 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "simd_kernels.hpp"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+using databento_native::SafeStrCopy;
+namespace kernels = databento_native::kernels;
+
+namespace {
+
+// Runs shorter than this go straight to the scalar loop
+constexpr size_t kMinVectorRun = 8;
+
+/**
+ * Per-instrument stats in order of first appearance
+ */
+struct GroupedStats {
+    std::unordered_map<uint32_t, size_t> index;
+    std::vector<uint32_t> ids;
+    std::vector<kernels::RangeStats> totals;
+
+    size_t Group(uint32_t id) {
+        auto [it, inserted] = index.try_emplace(id, ids.size());
+        if (inserted) {
+            ids.push_back(id);
+            totals.emplace_back();
+        }
+        return it->second;
+    }
+};
+
+kernels::RangeStats StatsOf(const int64_t* prices, const uint32_t* sizes, size_t count) {
+    return count >= kMinVectorRun ? kernels::Stats(prices, sizes, count)
+                                  : kernels::scalar::Stats(prices, sizes, count);
+}
+
+// Long runs of one instrument (per-instrument and single-instrument files): one kernel call per run
+void StatsByRun(const uint32_t* instrument_ids, const int64_t* prices, const uint32_t* sizes,
+                size_t count, GroupedStats& grouped) {
+    size_t i = 0;
+    while (i < count) {
+        const uint32_t id = instrument_ids[i];
+        size_t end = i + 1;
+        while (end < count && instrument_ids[end] == id) {
+            ++end;
+        }
+        grouped.totals[grouped.Group(id)].Merge(StatsOf(prices + i, sizes + i, end - i));
+        i = end;
+    }
+}
+
+// Interleaved instruments (multi-symbol files): gather each instrument's rows into one
+// contiguous slice, then one kernel call per instrument
+void StatsByGather(const uint32_t* instrument_ids, const int64_t* prices, const uint32_t* sizes,
+                   size_t count, GroupedStats& grouped) {
+    std::vector<uint32_t> row_group(count);
+    std::vector<size_t> offsets;
+    uint32_t last_id = 0;
+    size_t last_group = std::numeric_limits<size_t>::max();
+    for (size_t i = 0; i < count; ++i) {
+        if (last_group == std::numeric_limits<size_t>::max() || instrument_ids[i] != last_id) {
+            last_id = instrument_ids[i];
+            last_group = grouped.Group(last_id);
+            if (last_group == offsets.size()) {
+                offsets.push_back(0);
+            }
+        }
+        row_group[i] = static_cast<uint32_t>(last_group);
+        ++offsets[last_group];
+    }
+    size_t next = 0;
+    for (size_t& offset : offsets) {
+        next += std::exchange(offset, next);
+    }
+
+    std::vector<size_t> starts = offsets;
+    std::vector<int64_t> gathered_prices(count);
+    std::vector<uint32_t> gathered_sizes(count);
+    for (size_t i = 0; i < count; ++i) {
+        const size_t slot = offsets[row_group[i]]++;
+        gathered_prices[slot] = prices[i];
+        gathered_sizes[slot] = sizes[i];
+    }
+    for (size_t g = 0; g < starts.size(); ++g) {
+        grouped.totals[g] = StatsOf(gathered_prices.data() + starts[g], gathered_sizes.data() + starts[g],
+                                    offsets[g] - starts[g]);
+    }
+}
+
+// Sliding-window mean / M2 with Welford add and remove steps
+struct RollingMoments {
+    size_t count = 0;
+    double mean = 0.0;
+    double m2 = 0.0;
+
+    void Add(double x) {
+        ++count;
+        const double delta = x - mean;
+        mean += delta / static_cast<double>(count);
+        m2 += delta * (x - mean);
+    }
+
+    void Remove(double x) {
+        if (--count == 0) {
+            mean = 0.0;
+            m2 = 0.0;
+            return;
+        }
+        const double delta = x - mean;
+        mean -= delta / static_cast<double>(count);
+        m2 -= delta * (x - mean);
+    }
+};
+
+}  // namespace
+
+// ============================================================================
+// Analytics Kernels API Implementation
+// ============================================================================
+
+DATABENTO_API int dbento_kernel_simd_level(void)
+{
+    return static_cast<int>(kernels::ActiveSimdLevel());
+}
+
+DATABENTO_API int dbento_kernel_prices_to_double(
+    const int64_t* prices,
+    size_t count,
+    double* out_values)
+{
+    if (count > 0 && (!prices || !out_values)) {
+        return -2;
+    }
+    kernels::PricesToDouble(prices, count, out_values);
+    return 0;
+}
+
+DATABENTO_API double dbento_kernel_vwap(
+    const int64_t* prices,
+    const uint32_t* sizes,
+    size_t count)
+{
+    if (!prices || !sizes || count == 0) {
+        return std::numeric_limits<double>::quiet_NaN();
+    }
+    const kernels::RangeStats stats = kernels::Stats(prices, sizes, count);
+    return stats.volume == 0 ? std::numeric_limits<double>::quiet_NaN()
+                             : stats.notional / static_cast<double>(stats.volume);
+}
+
+DATABENTO_API int dbento_kernel_instrument_stats(
+    const uint32_t* instrument_ids,
+    const int64_t* prices,
+    const uint32_t* sizes,
+    size_t count,
+    uint32_t* out_instrument_ids,
+    uint64_t* out_counts,
+    int64_t* out_min_prices,
+    int64_t* out_max_prices,
+    uint64_t* out_volumes,
+    double* out_notionals,
+    size_t capacity,
+    size_t* group_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if ((count > 0 && (!instrument_ids || !prices || !sizes)) || !out_instrument_ids || !out_counts ||
+            !out_min_prices || !out_max_prices || !out_volumes || !out_notionals || !group_count) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        // Vectorize per run when runs are long, otherwise gather each instrument's rows first
+        size_t runs = count > 0 ? 1 : 0;
+        for (size_t i = 1; i < count; ++i) {
+            runs += instrument_ids[i] != instrument_ids[i - 1];
+        }
+        GroupedStats grouped;
+        if (runs * kMinVectorRun <= count) {
+            StatsByRun(instrument_ids, prices, sizes, count, grouped);
+        } else {
+            StatsByGather(instrument_ids, prices, sizes, count, grouped);
+        }
+        const std::vector<uint32_t>& ids = grouped.ids;
+        const std::vector<kernels::RangeStats>& totals = grouped.totals;
+
+        *group_count = totals.size();
+        if (totals.size() > capacity) {
+            std::string msg = "Output capacity too small: " + std::to_string(totals.size()) + " instruments";
+            SafeStrCopy(error_buffer, error_buffer_size, msg.c_str());
+            return -3;
+        }
+
+        for (size_t g = 0; g < totals.size(); ++g) {
+            out_instrument_ids[g] = ids[g];
+            out_counts[g] = totals[g].count;
+            out_min_prices[g] = totals[g].min_price;
+            out_max_prices[g] = totals[g].count > 0 ? totals[g].max_price : kernels::kUndefPrice;
+            out_volumes[g] = totals[g].volume;
+            out_notionals[g] = totals[g].notional;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_kernel_returns(
+    const double* values,
+    size_t count,
+    int log_returns,
+    double* out_returns)
+{
+    if (count == 0) {
+        return 0;
+    }
+    if (!values || !out_returns || values == out_returns) {
+        return -2;
+    }
+
+    kernels::Ratios(values, count, out_returns);
+    out_returns[0] = std::numeric_limits<double>::quiet_NaN();
+    if (log_returns) {
+        for (size_t i = 1; i < count; ++i) {
+            out_returns[i] = std::log(out_returns[i]);
+        }
+    } else {
+        for (size_t i = 1; i < count; ++i) {
+            out_returns[i] -= 1.0;
+        }
+    }
+    return 0;
+}
+
+DATABENTO_API int dbento_kernel_rolling_mean_var(
+    const double* values,
+    size_t count,
+    size_t window,
+    double* out_means,
+    double* out_variances)
+{
+    if (window == 0 || (count > 0 && !values) || (!out_means && !out_variances)) {
+        return -2;
+    }
+
+    constexpr double kNaN = std::numeric_limits<double>::quiet_NaN();
+    RollingMoments moments;
+    size_t nan_count = 0;  // Windows containing NaN produce NaN
+
+    for (size_t i = 0; i < count; ++i) {
+        if (std::isnan(values[i])) {
+            ++nan_count;
+        } else {
+            moments.Add(values[i]);
+        }
+        if (i >= window) {
+            const double old = values[i - window];
+            if (std::isnan(old)) {
+                --nan_count;
+            } else {
+                moments.Remove(old);
+            }
+        }
+
+        const bool full = i + 1 >= window && nan_count == 0;
+        if (out_means) {
+            out_means[i] = full ? moments.mean : kNaN;
+        }
+        if (out_variances) {
+            out_variances[i] = full && window > 1
+                ? std::max(moments.m2, 0.0) / static_cast<double>(window - 1)
+                : kNaN;
+        }
+    }
+    return 0;
+}
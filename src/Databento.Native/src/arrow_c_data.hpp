@@ -0,0 +1,287 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include "databento_native.h"
+#include "columnar_export.hpp"
+#include "dbn_file_reader.hpp"
+#include "dbn_projection.hpp"
+
+namespace databento_native {
+
+namespace detail {
+
+// Arrow C Data format string of an output column
+inline const char* ArrowFormat(const ColumnSpec& column) {
+    if (column.timestamp) {
+        return "tsn:UTC";
+    }
+    switch (column.type) {
+        case FieldType::UInt8:
+            return "C";
+        case FieldType::Char:
+            return "u";
+        case FieldType::UInt16:
+            return "S";
+        case FieldType::UInt32:
+            return "I";
+        case FieldType::Int32:
+            return "i";
+        case FieldType::UInt64:
+            return "L";
+        case FieldType::Int64:
+            return "l";
+    }
+    return "l";
+}
+
+struct SchemaPrivate {
+    std::string format;
+    std::string name;
+    std::vector<ArrowSchema> child_storage;
+    std::vector<ArrowSchema*> children;
+};
+
+inline void ReleaseSchema(ArrowSchema* schema) {
+    auto* owned = static_cast<SchemaPrivate*>(schema->private_data);
+    for (ArrowSchema* child : owned->children) {
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    delete owned;
+    schema->release = nullptr;
+}
+
+inline void FillSchema(ArrowSchema* out, std::unique_ptr<SchemaPrivate> owned) {
+    *out = ArrowSchema{};
+    out->format = owned->format.c_str();
+    out->name = owned->name.c_str();
+    out->n_children = static_cast<int64_t>(owned->children.size());
+    out->children = owned->children.empty() ? nullptr : owned->children.data();
+    out->release = &ReleaseSchema;
+    out->private_data = owned.release();
+}
+
+// Every array (the struct parent and each child) owns its buffers, so a consumer may
+// move children out and release them independently
+struct ArrayPrivate {
+    std::vector<std::vector<uint8_t>> storage;
+    std::vector<const void*> buffers;
+    std::vector<ArrowArray> child_storage;
+    std::vector<ArrowArray*> children;
+};
+
+inline void ReleaseArray(ArrowArray* array) {
+    auto* owned = static_cast<ArrayPrivate*>(array->private_data);
+    for (ArrowArray* child : owned->children) {
+        if (child->release) {
+            child->release(child);
+        }
+    }
+    delete owned;
+    array->release = nullptr;
+}
+
+inline void FillArray(ArrowArray* out, int64_t length, std::unique_ptr<ArrayPrivate> owned) {
+    *out = ArrowArray{};
+    out->length = length;
+    out->n_buffers = static_cast<int64_t>(owned->buffers.size());
+    out->buffers = owned->buffers.data();
+    out->n_children = static_cast<int64_t>(owned->children.size());
+    out->children = owned->children.empty() ? nullptr : owned->children.data();
+    out->release = &ReleaseArray;
+    out->private_data = owned.release();
+}
+
+}  // namespace detail
+
+/**
+ * Export column specs as an Arrow struct schema ("+s" with one child per column)
+ */
+inline void ExportArrowSchema(const std::vector<ColumnSpec>& columns, ArrowSchema* out) {
+    auto parent = std::make_unique<detail::SchemaPrivate>();
+    parent->format = "+s";
+    parent->child_storage.resize(columns.size());
+    for (size_t c = 0; c < columns.size(); ++c) {
+        auto child = std::make_unique<detail::SchemaPrivate>();
+        child->format = detail::ArrowFormat(columns[c]);
+        child->name = columns[c].name;
+        detail::FillSchema(&parent->child_storage[c], std::move(child));
+        parent->children.push_back(&parent->child_storage[c]);
+    }
+    detail::FillSchema(out, std::move(parent));
+}
+
+/**
+ * Export a batch of projected columns as an Arrow struct array, taking ownership of the
+ * column buffers (each holds at least rows values)
+ */
+inline void ExportArrowArray(const std::vector<ColumnSpec>& columns, ColumnBatch batch, ArrowArray* out) {
+    const auto rows = static_cast<int64_t>(batch.rows);
+    auto parent = std::make_unique<detail::ArrayPrivate>();
+    parent->buffers.push_back(nullptr);  // No validity bitmap: no nulls
+    parent->child_storage.resize(columns.size());
+    for (size_t c = 0; c < columns.size(); ++c) {
+        auto child = std::make_unique<detail::ArrayPrivate>();
+        child->buffers.push_back(nullptr);
+        if (columns[c].type == FieldType::Char) {
+            // Utf8: int32 offsets 0..rows over one byte per value
+            std::vector<uint8_t> offsets((batch.rows + 1) * sizeof(int32_t));
+            for (size_t i = 0; i <= batch.rows; ++i) {
+                const auto offset = static_cast<int32_t>(i);
+                std::memcpy(offsets.data() + i * sizeof(int32_t), &offset, sizeof(offset));
+            }
+            child->storage.push_back(std::move(offsets));
+        }
+        if (batch.columns[c].empty()) {
+            batch.columns[c].resize(8);  // Keep data buffers non-null for empty batches
+        }
+        child->storage.push_back(std::move(batch.columns[c]));
+        for (const auto& buffer : child->storage) {
+            child->buffers.push_back(buffer.data());
+        }
+        detail::FillArray(&parent->child_storage[c], rows, std::move(child));
+        parent->children.push_back(&parent->child_storage[c]);
+    }
+    detail::FillArray(out, rows, std::move(parent));
+}
+
+/**
+ * Accumulates records of one rtype into columns and hands them out as Arrow batches
+ *
+ * State behind a DbentoArrowBuilderHandle. Appends and Finish() are serialized by a mutex,
+ * so a client callback thread can append while the owner takes batches.
+ */
+class ArrowBatchBuilder {
+public:
+    explicit ArrowBatchBuilder(Projector projector)
+        : projector_(std::move(projector))
+    {
+        for (const DbnField* field : projector_.Fields()) {
+            columns_.push_back(ColumnSpec::FromField(*field));
+        }
+        Reset();
+    }
+
+    size_t Rows() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return rows_;
+    }
+
+    /**
+     * Append whole records laid out back to back; other rtypes are skipped
+     * @return Rows added
+     */
+    size_t Append(const uint8_t* records, size_t length) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        size_t added = 0;
+        size_t offset = 0;
+        while (offset < length) {
+            const size_t record_length = static_cast<size_t>(records[offset]) * databento::RecordHeader::kLengthMultiplier;
+            if (record_length < sizeof(databento::RecordHeader) || record_length > length - offset) {
+                throw std::runtime_error("Truncated or corrupt DBN record at byte offset " + std::to_string(offset));
+            }
+            Reserve(rows_ + 1);
+            if (projector_.ProjectRecord(records + offset, pointers_.data(), rows_)) {
+                ++rows_;
+                ++added;
+            }
+            offset += record_length;
+        }
+        return added;
+    }
+
+    /**
+     * Project up to max_rows rows from a reader directly into the column buffers
+     * @return Rows added; fewer than max_rows only at end of file
+     */
+    size_t AppendFrom(DbnFileReaderWrapper& reader, size_t max_rows) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        Reserve(rows_ + max_rows);
+        const size_t added = projector_.Project(reader, pointers_.data(), rows_, max_rows);
+        rows_ += added;
+        return added;
+    }
+
+    /**
+     * Remember an append failure from a record callback, which cannot report it; the
+     * next Finish() throws it
+     */
+    void SetDeferredError(std::string message) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (deferred_error_.empty()) {
+            deferred_error_ = std::move(message);
+        }
+    }
+
+    /**
+     * Export the accumulated rows and start an empty batch
+     */
+    void Finish(ArrowSchema* out_schema, ArrowArray* out_array) {
+        ColumnBatch batch;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (!deferred_error_.empty()) {
+                std::string message = std::move(deferred_error_);
+                deferred_error_.clear();
+                throw std::runtime_error(message);
+            }
+            batch.rows = rows_;
+            for (size_t c = 0; c < data_.size(); ++c) {
+                data_[c].resize(rows_ * projector_.Width(c));
+            }
+            batch.columns = std::move(data_);
+            Reset();
+        }
+        ExportArrowSchema(columns_, out_schema);
+        try {
+            ExportArrowArray(columns_, std::move(batch), out_array);
+        }
+        catch (...) {
+            out_schema->release(out_schema);
+            throw;
+        }
+    }
+
+private:
+    static constexpr size_t kInitialRows = 1024;
+
+    void Reset() {
+        rows_ = 0;
+        data_.assign(columns_.size(), {});
+        pointers_.assign(columns_.size(), nullptr);
+        capacity_ = 0;
+        Reserve(kInitialRows);
+    }
+
+    void Reserve(size_t rows) {
+        if (rows <= capacity_) {
+            return;
+        }
+        capacity_ = std::max(rows, capacity_ * 2);
+        for (size_t c = 0; c < data_.size(); ++c) {
+            data_[c].resize(capacity_ * projector_.Width(c));
+            pointers_[c] = data_[c].data();
+        }
+    }
+
+    Projector projector_;
+    std::vector<ColumnSpec> columns_;
+    std::mutex mutex_;
+    std::vector<std::vector<uint8_t>> data_;
+    std::vector<uint8_t*> pointers_;
+    size_t rows_ = 0;
+    size_t capacity_ = 0;
+    std::string deferred_error_;
+};
+
+}  // namespace databento_native
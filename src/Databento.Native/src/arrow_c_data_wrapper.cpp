@@ -0,0 +1,218 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "handle_validation.hpp"
+#include "arrow_c_data.hpp"
+#include "dbn_file_reader.hpp"
+#include "dbn_projection.hpp"
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+using databento_native::SafeStrCopy;
+using databento_native::ArrowBatchBuilder;
+using databento_native::DbnFileReaderWrapper;
+using databento_native::Projector;
+
+namespace {
+
+// Resolve the field list, reporting bad input through the error buffer
+std::optional<Projector> CreateProjector(uint8_t rtype, const char** field_names, size_t field_count,
+                                         char* error_buffer, size_t error_buffer_size) {
+    if (field_count > 0 && !field_names) {
+        SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+        return std::nullopt;
+    }
+    std::vector<std::string> names;
+    for (size_t i = 0; i < field_count; ++i) {
+        if (!field_names[i]) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Field name cannot be null");
+            return std::nullopt;
+        }
+        names.emplace_back(field_names[i]);
+    }
+    try {
+        return Projector::Create(rtype, names);
+    }
+    catch (const std::invalid_argument& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return std::nullopt;
+    }
+}
+
+void AppendRecordCallback(const uint8_t* record_bytes, size_t record_length, uint8_t /*record_type*/, void* user_data) {
+    auto* builder = databento_native::ValidateAndCast<ArrowBatchBuilder>(
+        user_data, databento_native::HandleType::ArrowBuilder, nullptr);
+    if (!builder || !record_bytes) {
+        return;
+    }
+    try {
+        builder->Append(record_bytes, record_length);
+    }
+    catch (const std::exception& e) {
+        // Exceptions must not cross the callback boundary; reported by the next finish
+        builder->SetDeferredError(e.what());
+    }
+}
+
+}  // namespace
+
+// ============================================================================
+// Arrow C Data Interface API Implementation
+// ============================================================================
+
+DATABENTO_API int dbento_dbn_file_read_arrow(
+    DbnFileReaderHandle handle,
+    uint8_t rtype,
+    const char** field_names,
+    size_t field_count,
+    size_t max_rows,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!out_schema || !out_array || max_rows == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        auto projector = CreateProjector(rtype, field_names, field_count, error_buffer, error_buffer_size);
+        if (!projector) {
+            return -2;
+        }
+
+        ArrowBatchBuilder builder{std::move(*projector)};
+        if (builder.AppendFrom(*wrapper, max_rows) == 0) {
+            return 1;
+        }
+        builder.Finish(out_schema, out_array);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API DbentoArrowBuilderHandle dbento_arrow_builder_create(
+    uint8_t rtype,
+    const char** field_names,
+    size_t field_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto projector = CreateProjector(rtype, field_names, field_count, error_buffer, error_buffer_size);
+        if (!projector) {
+            return nullptr;
+        }
+        auto builder = std::make_unique<ArrowBatchBuilder>(std::move(*projector));
+        return reinterpret_cast<DbentoArrowBuilderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::ArrowBuilder, builder.release()));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_arrow_builder_append(
+    DbentoArrowBuilderHandle handle,
+    const uint8_t* records,
+    size_t length,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* builder = databento_native::ValidateAndCast<ArrowBatchBuilder>(
+            handle, databento_native::HandleType::ArrowBuilder, &validation_error);
+        if (!builder) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!records && length > 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+        builder->Append(records, length);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API RecordCallback dbento_arrow_builder_record_callback(void)
+{
+    return &AppendRecordCallback;
+}
+
+DATABENTO_API int64_t dbento_arrow_builder_row_count(DbentoArrowBuilderHandle handle)
+{
+    try {
+        auto* builder = databento_native::ValidateAndCast<ArrowBatchBuilder>(
+            handle, databento_native::HandleType::ArrowBuilder, nullptr);
+        return builder ? static_cast<int64_t>(builder->Rows()) : -1;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_arrow_builder_finish(
+    DbentoArrowBuilderHandle handle,
+    struct ArrowSchema* out_schema,
+    struct ArrowArray* out_array,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* builder = databento_native::ValidateAndCast<ArrowBatchBuilder>(
+            handle, databento_native::HandleType::ArrowBuilder, &validation_error);
+        if (!builder) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!out_schema || !out_array) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+        builder->Finish(out_schema, out_array);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_arrow_builder_destroy(DbentoArrowBuilderHandle handle)
+{
+    try {
+        auto* builder = databento_native::ValidateAndCast<ArrowBatchBuilder>(
+            handle, databento_native::HandleType::ArrowBuilder, nullptr);
+        if (builder) {
+            delete builder;
+            databento_native::DestroyValidatedHandle(handle);
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "columnar_export.hpp"
+#include "flatbuffer_builder.hpp"
+
+namespace databento_native {
+
+/**
+ * Arrow IPC file (Feather v2) writer for projected DBN columns
+ *
+ * Writes the file format directly (magic, schema message, one record batch message per row
+ * group, footer), so no Arrow library is needed. Encode() builds a batch's metadata and body
+ * and is safe to call from several threads; Write() and Close() append to the file in order.
+ * With zstd, buffers use the IPC body compression (each buffer prefixed by its length).
+ */
+class ArrowIpcFileWriter {
+public:
+    struct EncodedBatch {
+        std::vector<uint8_t> metadata;  // Encapsulated message: continuation, length, flatbuffer, padding
+        std::vector<uint8_t> body;
+    };
+
+    ArrowIpcFileWriter(const std::filesystem::path& path, std::vector<ColumnSpec> columns,
+                       ExportCompression compression, int level)
+        : out_(path, std::ios::binary | std::ios::trunc)
+        , columns_(std::move(columns))
+        , compression_(compression)
+        , level_(level)
+    {
+        if (!out_) {
+            throw std::runtime_error("Failed to create file: " + path.string());
+        }
+        static const char kMagic[8] = {'A', 'R', 'R', 'O', 'W', '1', 0, 0};
+        WriteBytes(kMagic, sizeof(kMagic));
+
+        FlatBufferBuilder builder;
+        const auto schema = BuildSchema(builder);
+        const auto message = BuildMessage(builder, kHeaderSchema, schema, 0);
+        builder.Finish(message);
+        const auto encapsulated = Encapsulate(builder);
+        WriteBytes(encapsulated.data(), encapsulated.size());
+    }
+
+    ArrowIpcFileWriter(const ArrowIpcFileWriter&) = delete;
+    ArrowIpcFileWriter& operator=(const ArrowIpcFileWriter&) = delete;
+
+    EncodedBatch Encode(const ColumnBatch& batch) const {
+        EncodedBatch encoded;
+        std::vector<uint8_t> nodes;
+        std::vector<uint8_t> buffers;
+        std::vector<uint8_t> scratch;
+
+        auto add_buffer = [&](const uint8_t* data, size_t size) {
+            const size_t offset = encoded.body.size();
+            if (size > 0 && compression_ == ExportCompression::Zstd) {
+                // Uncompressed length prefix; -1 marks a buffer left as is
+                const size_t start = encoded.body.size();
+                AppendLe64(encoded.body, size);
+                AppendZstdFrame(encoded.body, data, size, level_);
+                if (encoded.body.size() - start - 8 >= size) {
+                    encoded.body.resize(start);
+                    AppendLe64(encoded.body, static_cast<uint64_t>(-1));
+                    encoded.body.insert(encoded.body.end(), data, data + size);
+                }
+            } else {
+                encoded.body.insert(encoded.body.end(), data, data + size);
+            }
+            const size_t length = encoded.body.size() - offset;
+            encoded.body.resize((encoded.body.size() + 7) & ~size_t{7});
+            AppendLe64(buffers, offset);
+            AppendLe64(buffers, length);
+        };
+
+        for (size_t c = 0; c < columns_.size(); ++c) {
+            AppendLe64(nodes, batch.rows);
+            AppendLe64(nodes, 0);  // null_count
+            add_buffer(nullptr, 0);  // Validity bitmap omitted: no nulls
+            const std::vector<uint8_t>& values = batch.columns[c];
+            if (columns_[c].type == FieldType::Char) {
+                // Utf8: int32 offsets 0..rows, then one byte per value
+                scratch.clear();
+                for (size_t i = 0; i <= batch.rows; ++i) {
+                    AppendLe32(scratch, static_cast<uint32_t>(i));
+                }
+                add_buffer(scratch.data(), scratch.size());
+            }
+            add_buffer(values.data(), batch.rows * FieldWidth(columns_[c].type));
+        }
+
+        FlatBufferBuilder builder;
+        FlatBufferBuilder::Offset compression = 0;
+        if (compression_ == ExportCompression::Zstd) {
+            builder.StartTable();
+            builder.AddScalar<int8_t>(0, kCodecZstd);
+            builder.AddScalar<int8_t>(1, 0);  // BUFFER method
+            compression = builder.EndTable();
+        }
+        const auto node_vector = builder.CreateStructVector(nodes, columns_.size(), 8);
+        const auto buffer_vector = builder.CreateStructVector(buffers, buffers.size() / 16, 8);
+        builder.StartTable();
+        builder.AddScalar<int64_t>(0, static_cast<int64_t>(batch.rows));
+        builder.AddOffset(1, node_vector);
+        builder.AddOffset(2, buffer_vector);
+        if (compression) {
+            builder.AddOffset(3, compression);
+        }
+        const auto record_batch = builder.EndTable();
+        builder.Finish(BuildMessage(builder, kHeaderRecordBatch, record_batch, encoded.body.size()));
+        encoded.metadata = Encapsulate(builder);
+        return encoded;
+    }
+
+    void Write(const EncodedBatch& batch) {
+        blocks_.push_back(Block{position_, batch.metadata.size(), batch.body.size()});
+        WriteBytes(batch.metadata.data(), batch.metadata.size());
+        WriteBytes(batch.body.data(), batch.body.size());
+    }
+
+    /**
+     * Write the end-of-stream marker and footer, then close the file
+     */
+    void Close() {
+        static const uint8_t kEndOfStream[8] = {0xFF, 0xFF, 0xFF, 0xFF, 0, 0, 0, 0};
+        WriteBytes(kEndOfStream, sizeof(kEndOfStream));
+
+        FlatBufferBuilder builder;
+        const auto schema = BuildSchema(builder);
+        std::vector<uint8_t> blocks;
+        for (const auto& block : blocks_) {
+            AppendLe64(blocks, block.offset);
+            AppendLe32(blocks, static_cast<uint32_t>(block.metadata_length));
+            AppendLe32(blocks, 0);  // Struct padding
+            AppendLe64(blocks, block.body_length);
+        }
+        const auto dictionaries = builder.CreateStructVector({}, 0, 8);
+        const auto batches = builder.CreateStructVector(blocks, blocks_.size(), 8);
+        builder.StartTable();
+        builder.AddScalar<int16_t>(0, kMetadataV5);
+        builder.AddOffset(1, schema);
+        builder.AddOffset(2, dictionaries);
+        builder.AddOffset(3, batches);
+        builder.Finish(builder.EndTable());
+
+        WriteBytes(builder.Data(), builder.Size());
+        std::vector<uint8_t> trailer;
+        AppendLe32(trailer, static_cast<uint32_t>(builder.Size()));
+        trailer.insert(trailer.end(), {'A', 'R', 'R', 'O', 'W', '1'});
+        WriteBytes(trailer.data(), trailer.size());
+        out_.close();
+        if (!out_) {
+            throw std::runtime_error("Failed to write Arrow IPC footer");
+        }
+    }
+
+private:
+    // Arrow format constants (Schema.fbs / Message.fbs)
+    static constexpr int16_t kMetadataV5 = 4;
+    static constexpr uint8_t kHeaderSchema = 1;
+    static constexpr uint8_t kHeaderRecordBatch = 3;
+    static constexpr uint8_t kTypeInt = 2;
+    static constexpr uint8_t kTypeUtf8 = 5;
+    static constexpr uint8_t kTypeTimestamp = 10;
+    static constexpr int16_t kTimeUnitNanosecond = 3;
+    static constexpr int8_t kCodecZstd = 1;
+
+    struct Block {
+        uint64_t offset;
+        uint64_t metadata_length;
+        uint64_t body_length;
+    };
+
+    FlatBufferBuilder::Offset BuildSchema(FlatBufferBuilder& builder) const {
+        std::vector<FlatBufferBuilder::Offset> fields;
+        for (const auto& column : columns_) {
+            // Children are built before the table that refers to them
+            const auto name = builder.CreateString(column.name);
+            const auto children = builder.CreateOffsetVector({});
+            FlatBufferBuilder::Offset type = 0;
+            uint8_t type_type = kTypeInt;
+            if (column.timestamp) {
+                const auto timezone = builder.CreateString("UTC");
+                builder.StartTable();
+                builder.AddScalar<int16_t>(0, kTimeUnitNanosecond);
+                builder.AddOffset(1, timezone);
+                type = builder.EndTable();
+                type_type = kTypeTimestamp;
+            } else if (column.type == FieldType::Char) {
+                builder.StartTable();
+                type = builder.EndTable();
+                type_type = kTypeUtf8;
+            } else {
+                const bool is_signed = column.type == FieldType::Int32 || column.type == FieldType::Int64;
+                builder.StartTable();
+                builder.AddScalar<int32_t>(0, static_cast<int32_t>(FieldWidth(column.type) * 8));
+                builder.AddScalar<uint8_t>(1, is_signed ? 1 : 0);
+                type = builder.EndTable();
+            }
+            builder.StartTable();
+            builder.AddOffset(0, name);
+            builder.AddScalar<uint8_t>(1, 0);  // Not nullable
+            builder.AddScalar<uint8_t>(2, type_type);
+            builder.AddOffset(3, type);
+            builder.AddOffset(5, children);
+            fields.push_back(builder.EndTable());
+        }
+        const auto field_vector = builder.CreateOffsetVector(fields);
+        builder.StartTable();
+        builder.AddScalar<int16_t>(0, 0);  // Little-endian
+        builder.AddOffset(1, field_vector);
+        return builder.EndTable();
+    }
+
+    static FlatBufferBuilder::Offset BuildMessage(FlatBufferBuilder& builder, uint8_t header_type,
+                                                  FlatBufferBuilder::Offset header, size_t body_length) {
+        builder.StartTable();
+        builder.AddScalar<int64_t>(3, static_cast<int64_t>(body_length));
+        builder.AddOffset(2, header);
+        builder.AddScalar<int16_t>(0, kMetadataV5);
+        builder.AddScalar<uint8_t>(1, header_type);
+        return builder.EndTable();
+    }
+
+    // Continuation marker, metadata length, flatbuffer, padding to 8 bytes
+    static std::vector<uint8_t> Encapsulate(const FlatBufferBuilder& builder) {
+        const size_t padded = (8 + builder.Size() + 7) & ~size_t{7};
+        std::vector<uint8_t> out;
+        out.reserve(padded);
+        AppendLe32(out, 0xFFFFFFFF);
+        AppendLe32(out, static_cast<uint32_t>(padded - 8));
+        out.insert(out.end(), builder.Data(), builder.Data() + builder.Size());
+        out.resize(padded, 0);
+        return out;
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        if (!out_) {
+            throw std::runtime_error("Failed to write Arrow IPC file");
+        }
+        position_ += size;
+    }
+
+    std::ofstream out_;
+    std::vector<ColumnSpec> columns_;
+    ExportCompression compression_;
+    int level_;
+    uint64_t position_ = 0;
+    std::vector<Block> blocks_;
+};
+
+}  // namespace databento_native
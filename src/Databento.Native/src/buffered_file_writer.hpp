@@ -0,0 +1,223 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <databento/iwritable.hpp>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+namespace databento_native {
+
+/**
+ * Ask the OS to write a file's data to the device (fsync / FlushFileBuffers)
+ *
+ * Opens the file a second time: std::ofstream does not expose its descriptor, and the sync
+ * applies to the file, not to the descriptor it is issued on.
+ */
+inline void SyncFileToDisk(const std::filesystem::path& path) {
+#ifdef _WIN32
+    HANDLE file = ::CreateFileW(path.wstring().c_str(), GENERIC_WRITE,
+                                FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr,
+                                OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("Failed to open file for sync: " + path.string());
+    }
+    const bool synced = ::FlushFileBuffers(file) != 0;
+    ::CloseHandle(file);
+    if (!synced) {
+        throw std::runtime_error("Failed to sync file to disk: " + path.string());
+    }
+#else
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open file for sync: " + path.string());
+    }
+    int result;
+    do {
+        result = ::fsync(fd);
+    } while (result != 0 && errno == EINTR);
+    ::close(fd);
+    if (result != 0) {
+        throw std::runtime_error("Failed to sync file to disk: " + path.string());
+    }
+#endif
+}
+
+/**
+ * Make a rename or file creation in a directory durable (POSIX; NTFS journals the rename
+ * itself, so this is a no-op on Windows)
+ */
+inline void SyncDirectoryToDisk(const std::filesystem::path& directory) {
+#ifndef _WIN32
+    const int fd = ::open(directory.empty() ? "." : directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd < 0) {
+        throw std::runtime_error("Failed to open directory for sync: " + directory.string());
+    }
+    int result;
+    do {
+        result = ::fsync(fd);
+    } while (result != 0 && errno == EINTR);
+    ::close(fd);
+    if (result != 0) {
+        throw std::runtime_error("Failed to sync directory to disk: " + directory.string());
+    }
+#else
+    (void)directory;
+#endif
+}
+
+/**
+ * IWritable collecting bytes in memory, e.g. encoded metadata to be written as one piece
+ */
+class StringWritable : public databento::IWritable {
+public:
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        data.append(reinterpret_cast<const char*>(buffer), length);
+    }
+
+    std::string data;
+};
+
+constexpr size_t kDefaultWriteBufferSize = 1 << 20;
+constexpr size_t kWriteBufferAlignment = 4096;
+
+/**
+ * IWritable file sink gathering small writes in one large page-aligned buffer
+ *
+ * Records are copied once into the buffer and handed to the OS a buffer at a time; writes
+ * at least as large as the buffer go straight through. The stream's own buffer is disabled
+ * so the data is not copied a second time.
+ */
+class BufferedFileWriter : public databento::IWritable {
+public:
+    explicit BufferedFileWriter(const std::filesystem::path& path,
+                                size_t buffer_size = kDefaultWriteBufferSize)
+        : path_(path)
+        , capacity_(buffer_size)
+        , buffer_(static_cast<std::byte*>(::operator new[](buffer_size, std::align_val_t{kWriteBufferAlignment})))
+    {
+        out_.rdbuf()->pubsetbuf(nullptr, 0);  // Must precede open() to take effect
+        out_.open(path, std::ios::binary | std::ios::trunc);
+        if (!out_) {
+            throw std::runtime_error("Failed to create file: " + path.string());
+        }
+    }
+
+    ~BufferedFileWriter() override {
+        try {
+            Close();
+        }
+        catch (...) {
+            // Destructors must not throw; call Close() explicitly to observe errors
+        }
+    }
+
+    BufferedFileWriter(const BufferedFileWriter&) = delete;
+    BufferedFileWriter& operator=(const BufferedFileWriter&) = delete;
+
+    void WriteAll(const std::byte* data, std::size_t length) override {
+        if (closed_) {
+            throw std::runtime_error("Writer is closed");
+        }
+        if (length > capacity_ - used_) {
+            FlushBuffer();
+            if (length >= capacity_) {
+                Write(data, length);
+                return;
+            }
+        }
+        std::memcpy(buffer_.get() + used_, data, length);
+        used_ += length;
+    }
+
+    // Bytes written so far, including those still buffered
+    uint64_t Position() const { return written_ + used_; }
+
+    /**
+     * Hand buffered bytes to the OS
+     */
+    void Flush() {
+        if (closed_) {
+            return;
+        }
+        FlushBuffer();
+        out_.flush();
+        if (!out_) {
+            throw std::runtime_error("Failed to flush DBN file");
+        }
+    }
+
+    /**
+     * Flush and wait until the data is on the device
+     */
+    void Sync() {
+        Flush();
+        SyncFileToDisk(path_);
+    }
+
+    /**
+     * Write what is buffered and close the file (idempotent)
+     */
+    void Close() {
+        if (closed_) {
+            return;
+        }
+        closed_ = true;
+        FlushBuffer();
+        out_.close();
+        if (!out_) {
+            throw std::runtime_error("Failed to close DBN file");
+        }
+    }
+
+private:
+    struct AlignedDelete {
+        void operator()(std::byte* p) const {
+            ::operator delete[](p, std::align_val_t{kWriteBufferAlignment});
+        }
+    };
+
+    void FlushBuffer() {
+        if (used_ > 0) {
+            Write(buffer_.get(), used_);
+            used_ = 0;
+        }
+    }
+
+    void Write(const std::byte* data, size_t length) {
+        out_.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(length));
+        if (!out_) {
+            throw std::runtime_error("Failed to write DBN file");
+        }
+        written_ += length;
+    }
+
+    std::ofstream out_;
+    std::filesystem::path path_;
+    size_t capacity_;
+    size_t used_ = 0;
+    uint64_t written_ = 0;
+    bool closed_ = false;
+    std::unique_ptr<std::byte[], AlignedDelete> buffer_;
+};
+
+}  // namespace databento_native
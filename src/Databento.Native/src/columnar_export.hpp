@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <zstd.h>
+#include "dbn_fields.hpp"
+
+namespace databento_native {
+
+/**
+ * Output formats of the columnar exporter (values match the DBENTO_EXPORT_* codes in the C API)
+ */
+enum class ExportFormat : int {
+    ArrowIpc = 0,  // Arrow IPC file (Feather v2)
+    Parquet = 1
+};
+
+enum class ExportCompression : int {
+    None = 0,
+    Zstd = 1
+};
+
+/**
+ * One output column: a projected DBN field and how it is typed in the output schema
+ *
+ * Integer fields keep their DBN width and signedness, prices stay int64 fixed-point
+ * (1e-9 units), ts_* fields become UTC nanosecond timestamps and character fields
+ * (action, side) one-character strings.
+ */
+struct ColumnSpec {
+    std::string name;
+    FieldType type;
+    bool timestamp;
+
+    static ColumnSpec FromField(const DbnField& field) {
+        return ColumnSpec{field.name, field.type, IsTimestampField(field)};
+    }
+};
+
+/**
+ * A row group of projected values: one buffer of rows * FieldWidth(type) bytes per column
+ */
+struct ColumnBatch {
+    size_t rows = 0;
+    std::vector<std::vector<uint8_t>> columns;
+};
+
+inline void AppendLe32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+inline void AppendLe64(std::vector<uint8_t>& out, uint64_t value) {
+    for (int i = 0; i < 8; ++i) {
+        out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+/**
+ * zstd-compress a buffer into a single frame (appended to out)
+ */
+inline void AppendZstdFrame(std::vector<uint8_t>& out, const uint8_t* data, size_t size, int level) {
+    const size_t start = out.size();
+    out.resize(start + ZSTD_compressBound(size));
+    const size_t written = ZSTD_compress(out.data() + start, out.size() - start, data, size, level);
+    if (ZSTD_isError(written)) {
+        throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(written));
+    }
+    out.resize(start + written);
+}
+
+}  // namespace databento_native
@@ -0,0 +1,186 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "handle_validation.hpp"
+#include "arrow_ipc_writer.hpp"
+#include "columnar_export.hpp"
+#include "dbn_file_reader.hpp"
+#include "dbn_projection.hpp"
+#include "parquet_writer.hpp"
+#include "thread_pool.hpp"
+#include <algorithm>
+#include <deque>
+#include <filesystem>
+#include <future>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+using databento_native::SafeStrCopy;
+using databento_native::ColumnBatch;
+using databento_native::ColumnSpec;
+using databento_native::DbnFileReaderWrapper;
+using databento_native::ExportCompression;
+using databento_native::ExportFormat;
+using databento_native::Projector;
+using databento_native::ThreadPool;
+
+namespace {
+
+// Default row group: about this many bytes of projected values
+constexpr size_t kTargetRowGroupBytes = 64 << 20;
+constexpr size_t kMinRowGroupRows = 4096;
+constexpr size_t kMaxRowGroupRows = 1 << 20;
+
+/**
+ * Project row groups on the calling thread and encode them on the pool
+ *
+ * At most one row group per worker (plus the one being projected) is in flight, and
+ * encoded row groups are written in order as they complete.
+ */
+template <typename Writer>
+uint64_t RunExport(DbnFileReaderWrapper& reader, const Projector& projector, Writer& writer,
+                   size_t row_group_size, size_t threads) {
+    using Encoded = decltype(writer.Encode(std::declval<const ColumnBatch&>()));
+    ThreadPool pool(threads);
+    std::deque<std::future<Encoded>> in_flight;
+    uint64_t total = 0;
+    const size_t column_count = projector.Fields().size();
+    std::vector<uint8_t*> pointers(column_count);
+
+    for (;;) {
+        ColumnBatch batch;
+        batch.columns.resize(column_count);
+        for (size_t c = 0; c < column_count; ++c) {
+            batch.columns[c].resize(row_group_size * projector.Width(c));
+            pointers[c] = batch.columns[c].data();
+        }
+        batch.rows = projector.Project(reader, pointers.data(), 0, row_group_size);
+        if (batch.rows == 0) {
+            break;
+        }
+        total += batch.rows;
+        const bool last = batch.rows < row_group_size;
+        for (size_t c = 0; c < column_count; ++c) {
+            batch.columns[c].resize(batch.rows * projector.Width(c));
+        }
+
+        in_flight.push_back(pool.Submit([&writer, batch = std::move(batch)] { return writer.Encode(batch); }));
+        while (in_flight.size() > pool.Size()) {
+            writer.Write(in_flight.front().get());
+            in_flight.pop_front();
+        }
+        if (last) {
+            break;
+        }
+    }
+
+    while (!in_flight.empty()) {
+        writer.Write(in_flight.front().get());
+        in_flight.pop_front();
+    }
+    writer.Close();
+    return total;
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Columnar Export API Implementation
+// ============================================================================
+
+DATABENTO_API int dbento_dbn_file_export(
+    DbnFileReaderHandle handle,
+    const char* output_path,
+    int format,
+    int rtype,
+    const char** field_names,
+    size_t field_count,
+    size_t row_group_size,
+    int compression,
+    int thread_count,
+    uint64_t* rows_written,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    bool output_created = false;
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!output_path || (field_count > 0 && !field_names) || rtype < -1 || rtype > 0xFF ||
+            (format != static_cast<int>(ExportFormat::ArrowIpc) && format != static_cast<int>(ExportFormat::Parquet)) ||
+            (compression != static_cast<int>(ExportCompression::None) && compression != static_cast<int>(ExportCompression::Zstd))) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        std::vector<std::string> names;
+        for (size_t i = 0; i < field_count; ++i) {
+            if (!field_names[i]) {
+                SafeStrCopy(error_buffer, error_buffer_size, "Field name cannot be null");
+                return -2;
+            }
+            names.emplace_back(field_names[i]);
+        }
+
+        if (rtype == -1) {
+            rtype = Projector::DetectRType(*wrapper);
+            if (rtype == -1) {
+                SafeStrCopy(error_buffer, error_buffer_size, "No records to export");
+                return -1;
+            }
+        }
+        std::optional<Projector> projector;
+        try {
+            projector.emplace(Projector::Create(static_cast<uint8_t>(rtype), names));
+        }
+        catch (const std::invalid_argument& e) {
+            SafeStrCopy(error_buffer, error_buffer_size, e.what());
+            return -2;
+        }
+
+        std::vector<ColumnSpec> columns;
+        size_t row_bytes = 0;
+        for (size_t c = 0; c < projector->Fields().size(); ++c) {
+            columns.push_back(ColumnSpec::FromField(*projector->Fields()[c]));
+            row_bytes += projector->Width(c);
+        }
+        if (row_group_size == 0) {
+            row_group_size = std::clamp(kTargetRowGroupBytes / row_bytes, kMinRowGroupRows, kMaxRowGroupRows);
+        }
+        const size_t threads = thread_count > 0 ? static_cast<size_t>(thread_count)
+                                                : ThreadPool::DefaultThreadCount();
+        const auto codec = static_cast<ExportCompression>(compression);
+        const int level = 3;  // zstd default: fast enough to keep up with projection
+
+        output_created = true;
+        uint64_t rows = 0;
+        if (format == static_cast<int>(ExportFormat::ArrowIpc)) {
+            databento_native::ArrowIpcFileWriter writer{output_path, std::move(columns), codec, level};
+            rows = RunExport(*wrapper, *projector, writer, row_group_size, threads);
+        } else {
+            databento_native::ParquetFileWriter writer{output_path, std::move(columns), codec, level};
+            rows = RunExport(*wrapper, *projector, writer, row_group_size, threads);
+        }
+
+        if (rows_written) {
+            *rows_written = rows;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        if (output_created) {
+            std::error_code ec;
+            std::filesystem::remove(output_path, ec);
+        }
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
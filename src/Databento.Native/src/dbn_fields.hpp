@@ -0,0 +1,314 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include <databento/datetime.hpp>
+#include <databento/enums.hpp>
+#include <databento/record.hpp>
+
+namespace databento_native {
+
+/**
+ * Element type of a projected DBN field (values match the DBENTO_FIELD_* codes in the C API)
+ */
+enum class FieldType : int {
+    UInt8 = 1,
+    Char = 2,  // Single ASCII character (action, side)
+    UInt16 = 3,
+    UInt32 = 4,
+    Int32 = 5,
+    UInt64 = 6,
+    Int64 = 7
+};
+
+inline size_t FieldWidth(FieldType type) {
+    switch (type) {
+        case FieldType::UInt8:
+        case FieldType::Char:
+            return 1;
+        case FieldType::UInt16:
+            return 2;
+        case FieldType::UInt32:
+        case FieldType::Int32:
+            return 4;
+        case FieldType::UInt64:
+        case FieldType::Int64:
+            return 8;
+    }
+    return 0;
+}
+
+/**
+ * A fixed-width field of a DBN record: byte offset from the start of the record and type
+ */
+struct DbnField {
+    std::string name;
+    uint16_t offset;
+    FieldType type;
+};
+
+namespace detail {
+
+template <typename T>
+struct AlwaysFalse : std::false_type {};
+
+template <typename T>
+constexpr FieldType FieldTypeOf() {
+    if constexpr (std::is_enum_v<T>) {
+        using U = std::underlying_type_t<T>;
+        return std::is_same_v<U, char> ? FieldType::Char : FieldTypeOf<U>();
+    } else if constexpr (std::is_same_v<T, databento::UnixNanos>) {
+        return FieldType::UInt64;
+    } else if constexpr (std::is_same_v<T, databento::TimeDeltaNanos>) {
+        return FieldType::Int32;
+    } else if constexpr (std::is_same_v<T, databento::FlagSet>) {
+        return FieldType::UInt8;
+    } else if constexpr (std::is_same_v<T, char>) {
+        return FieldType::Char;
+    } else if constexpr (std::is_same_v<T, uint8_t>) {
+        return FieldType::UInt8;
+    } else if constexpr (std::is_same_v<T, uint16_t>) {
+        return FieldType::UInt16;
+    } else if constexpr (std::is_same_v<T, uint32_t>) {
+        return FieldType::UInt32;
+    } else if constexpr (std::is_same_v<T, int32_t>) {
+        return FieldType::Int32;
+    } else if constexpr (std::is_same_v<T, uint64_t>) {
+        return FieldType::UInt64;
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+        return FieldType::Int64;
+    } else {
+        static_assert(AlwaysFalse<T>::value, "Unsupported DBN field type");
+    }
+}
+
+template <typename T>
+void AddField(std::vector<DbnField>& fields, const char* name, size_t offset) {
+    static_assert(sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8,
+                  "DBN field width must be 1, 2, 4 or 8 bytes");
+    fields.push_back(DbnField{name, static_cast<uint16_t>(offset), FieldTypeOf<T>()});
+}
+
+// Offsets come from the databento-cpp record definitions so they follow the DBN version
+// the library decodes to (files of older versions are upgraded on read)
+#define DBENTO_FIELD(fields, Msg, member) \
+    detail::AddField<decltype(Msg::member)>(fields, #member, offsetof(Msg, member))
+
+inline void AddHeaderFields(std::vector<DbnField>& fields) {
+    using databento::RecordHeader;
+    DBENTO_FIELD(fields, RecordHeader, rtype);
+    DBENTO_FIELD(fields, RecordHeader, publisher_id);
+    DBENTO_FIELD(fields, RecordHeader, instrument_id);
+    DBENTO_FIELD(fields, RecordHeader, ts_event);
+}
+
+template <typename Level>
+void AddLevelFields(std::vector<DbnField>& fields, size_t levels_offset, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        const size_t base = levels_offset + i * sizeof(Level);
+        const std::string suffix{'_', static_cast<char>('0' + i / 10), static_cast<char>('0' + i % 10)};
+#define DBENTO_LEVEL_FIELD(member) \
+        detail::AddField<decltype(Level::member)>( \
+            fields, (std::string{#member} + suffix).c_str(), base + offsetof(Level, member))
+        DBENTO_LEVEL_FIELD(bid_px);
+        DBENTO_LEVEL_FIELD(ask_px);
+        DBENTO_LEVEL_FIELD(bid_sz);
+        DBENTO_LEVEL_FIELD(ask_sz);
+        if constexpr (std::is_same_v<Level, databento::BidAskPair>) {
+            DBENTO_LEVEL_FIELD(bid_ct);
+            DBENTO_LEVEL_FIELD(ask_ct);
+        } else {
+            DBENTO_LEVEL_FIELD(bid_pb);
+            DBENTO_LEVEL_FIELD(ask_pb);
+        }
+#undef DBENTO_LEVEL_FIELD
+    }
+}
+
+template <size_t N>
+std::vector<DbnField> MbpFields() {
+    using Msg = databento::MbpMsg<N>;
+    std::vector<DbnField> fields;
+    AddHeaderFields(fields);
+    DBENTO_FIELD(fields, Msg, price);
+    DBENTO_FIELD(fields, Msg, size);
+    DBENTO_FIELD(fields, Msg, action);
+    DBENTO_FIELD(fields, Msg, side);
+    DBENTO_FIELD(fields, Msg, flags);
+    DBENTO_FIELD(fields, Msg, depth);
+    DBENTO_FIELD(fields, Msg, ts_recv);
+    DBENTO_FIELD(fields, Msg, ts_in_delta);
+    DBENTO_FIELD(fields, Msg, sequence);
+    AddLevelFields<databento::BidAskPair>(fields, offsetof(Msg, levels), N);
+    return fields;
+}
+
+inline std::unordered_map<uint8_t, std::vector<DbnField>> BuildFieldTable() {
+    using databento::RType;
+    std::unordered_map<uint8_t, std::vector<DbnField>> table;
+    auto key = [](RType rtype) { return static_cast<uint8_t>(rtype); };
+
+    {
+        using Msg = databento::MboMsg;
+        auto& fields = table[key(RType::Mbo)];
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, Msg, order_id);
+        DBENTO_FIELD(fields, Msg, price);
+        DBENTO_FIELD(fields, Msg, size);
+        DBENTO_FIELD(fields, Msg, flags);
+        DBENTO_FIELD(fields, Msg, channel_id);
+        DBENTO_FIELD(fields, Msg, action);
+        DBENTO_FIELD(fields, Msg, side);
+        DBENTO_FIELD(fields, Msg, ts_recv);
+        DBENTO_FIELD(fields, Msg, ts_in_delta);
+        DBENTO_FIELD(fields, Msg, sequence);
+    }
+    {
+        using Msg = databento::TradeMsg;
+        auto& fields = table[key(RType::Mbp0)];
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, Msg, price);
+        DBENTO_FIELD(fields, Msg, size);
+        DBENTO_FIELD(fields, Msg, action);
+        DBENTO_FIELD(fields, Msg, side);
+        DBENTO_FIELD(fields, Msg, flags);
+        DBENTO_FIELD(fields, Msg, depth);
+        DBENTO_FIELD(fields, Msg, ts_recv);
+        DBENTO_FIELD(fields, Msg, ts_in_delta);
+        DBENTO_FIELD(fields, Msg, sequence);
+    }
+    table[key(RType::Mbp1)] = MbpFields<1>();
+    table[key(RType::Mbp10)] = MbpFields<10>();
+    {
+        using Msg = databento::BboMsg;
+        std::vector<DbnField> fields;
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, Msg, price);
+        DBENTO_FIELD(fields, Msg, size);
+        DBENTO_FIELD(fields, Msg, side);
+        DBENTO_FIELD(fields, Msg, flags);
+        DBENTO_FIELD(fields, Msg, ts_recv);
+        DBENTO_FIELD(fields, Msg, sequence);
+        AddLevelFields<databento::BidAskPair>(fields, offsetof(Msg, levels), 1);
+        table[key(RType::Bbo1S)] = fields;
+        table[key(RType::Bbo1M)] = std::move(fields);
+    }
+    {
+        using Msg = databento::Cmbp1Msg;
+        std::vector<DbnField> fields;
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, Msg, price);
+        DBENTO_FIELD(fields, Msg, size);
+        DBENTO_FIELD(fields, Msg, action);
+        DBENTO_FIELD(fields, Msg, side);
+        DBENTO_FIELD(fields, Msg, flags);
+        DBENTO_FIELD(fields, Msg, ts_recv);
+        DBENTO_FIELD(fields, Msg, ts_in_delta);
+        AddLevelFields<databento::ConsolidatedBidAskPair>(fields, offsetof(Msg, levels), 1);
+        table[key(RType::Cmbp1)] = fields;
+        table[key(RType::Tcbbo)] = std::move(fields);
+    }
+    {
+        using Msg = databento::CbboMsg;
+        std::vector<DbnField> fields;
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, Msg, price);
+        DBENTO_FIELD(fields, Msg, size);
+        DBENTO_FIELD(fields, Msg, side);
+        DBENTO_FIELD(fields, Msg, flags);
+        DBENTO_FIELD(fields, Msg, ts_recv);
+        AddLevelFields<databento::ConsolidatedBidAskPair>(fields, offsetof(Msg, levels), 1);
+        table[key(RType::Cbbo1S)] = fields;
+        table[key(RType::Cbbo1M)] = std::move(fields);
+    }
+    {
+        using Msg = databento::OhlcvMsg;
+        std::vector<DbnField> fields;
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, Msg, open);
+        DBENTO_FIELD(fields, Msg, high);
+        DBENTO_FIELD(fields, Msg, low);
+        DBENTO_FIELD(fields, Msg, close);
+        DBENTO_FIELD(fields, Msg, volume);
+        for (RType rtype : {RType::Ohlcv1S, RType::Ohlcv1M, RType::Ohlcv1H, RType::Ohlcv1D,
+                            RType::OhlcvEod, RType::OhlcvDeprecated}) {
+            table[key(rtype)] = fields;
+        }
+    }
+    {
+        using Msg = databento::StatMsg;
+        auto& fields = table[key(RType::Statistics)];
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, Msg, ts_recv);
+        DBENTO_FIELD(fields, Msg, ts_ref);
+        DBENTO_FIELD(fields, Msg, price);
+        DBENTO_FIELD(fields, Msg, quantity);
+        DBENTO_FIELD(fields, Msg, sequence);
+        DBENTO_FIELD(fields, Msg, ts_in_delta);
+        DBENTO_FIELD(fields, Msg, stat_type);
+        DBENTO_FIELD(fields, Msg, channel_id);
+        DBENTO_FIELD(fields, Msg, update_action);
+        DBENTO_FIELD(fields, Msg, stat_flags);
+    }
+    {
+        auto& fields = table[key(RType::Status)];
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, databento::StatusMsg, ts_recv);
+    }
+    {
+        auto& fields = table[key(RType::InstrumentDef)];
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, databento::InstrumentDefMsg, ts_recv);
+    }
+    {
+        auto& fields = table[key(RType::Imbalance)];
+        AddHeaderFields(fields);
+        DBENTO_FIELD(fields, databento::ImbalanceMsg, ts_recv);
+    }
+    return table;
+}
+
+#undef DBENTO_FIELD
+
+}  // namespace detail
+
+/**
+ * Projectable fields of records with the given rtype, or nullptr for an unsupported rtype
+ *
+ * Every rtype exposes the header fields (rtype, publisher_id, instrument_id, ts_event).
+ * Book levels are flattened as `bid_px_00`, `ask_sz_09`, and so on.
+ */
+inline const std::vector<DbnField>* FieldsOf(uint8_t rtype) {
+    static const auto table = detail::BuildFieldTable();
+    auto it = table.find(rtype);
+    return it == table.end() ? nullptr : &it->second;
+}
+
+/**
+ * Look up one field of an rtype by name, or nullptr if the rtype has no such field
+ */
+inline const DbnField* FindField(uint8_t rtype, std::string_view name) {
+    const auto* fields = FieldsOf(rtype);
+    if (fields) {
+        for (const auto& field : *fields) {
+            if (field.name == name) {
+                return &field;
+            }
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * Whether a field holds UNIX-epoch nanoseconds (ts_event, ts_recv, ts_ref)
+ */
+inline bool IsTimestampField(const DbnField& field) {
+    return field.type == FieldType::UInt64 && field.name.compare(0, 3, "ts_") == 0;
+}
+
+}  // namespace databento_native
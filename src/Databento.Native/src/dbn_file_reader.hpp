@@ -0,0 +1,463 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <databento/constants.hpp>
+#include <databento/dbn.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/enums.hpp>
+#include <databento/record.hpp>
+#include "common_helpers.hpp"
+#include "dbn_index.hpp"
+#include "descriptor_readable.hpp"
+#include "file_readable.hpp"
+#include "mapped_file.hpp"
+#include "memory_readable.hpp"
+#include "prefetch_readable.hpp"
+#include "seekable_zstd.hpp"
+
+namespace databento_native {
+
+// DBN prefix: "DBN" magic, version byte, u32 little-endian metadata length
+constexpr size_t kDbnPrefixSize = 8;
+
+inline StderrLogReceiver& ReaderLogReceiver() {
+    static StderrLogReceiver log_receiver{databento::LogLevel::Warning};
+    return log_receiver;
+}
+
+/**
+ * DBN file reader state behind a DbnFileReaderHandle
+ *
+ * Shared by the single-file reader API and the readers built on it (merge, projection,
+ * analytics). Picks the cheapest way to iterate a file: in place from a memory mapping,
+ * frame-parallel for seekable zstd, or through databento-cpp's decoder otherwise.
+ *
+ * Besides a path, the DBN bytes can come from memory the caller holds or from a descriptor
+ * the caller opened. Memory and regular-file descriptors use the same in-place and
+ * frame-parallel modes as a mapped path; other descriptors (pipes) are decoded forward only.
+ */
+struct DbnFileReaderWrapper {
+    enum class Source {
+        Path,
+        Memory,  // Caller memory, or a mapping of a regular file opened by the caller
+        Stream   // Caller descriptor that can only be read forward
+    };
+
+    // Buffered mode (any DBN file, including zstd and older versions that are upgraded on read)
+    std::unique_ptr<databento::DbnDecoder> decoder;
+    bool compressed = false;
+    uint64_t records_start = 0;  // Offset of the first record (decompressed offset for zstd)
+    // Zero-copy mode (uncompressed, current-version files): records are read in place
+    std::unique_ptr<MappedFile> mapping;
+    size_t mapped_offset = 0;
+    // Seekable zstd files: frames are decompressed in parallel (offsets are decompressed)
+    std::unique_ptr<SeekableZstdReader> seekable;
+    std::optional<databento::Metadata> metadata;
+    // Records taken from the source so far, including a pending record not yet delivered
+    uint64_t records_consumed = 0;
+    // Record already read from the store that did not fit a caller's batch buffer
+    std::vector<uint8_t> pending_record;
+    std::vector<uint8_t> delivered_record;  // Backs the view of a pending record handed out singly
+    std::filesystem::path file_path;
+    // Read-ahead for buffered mode: I/O and zstd decompression run on a background thread
+    std::optional<PrefetchOptions> prefetch;
+    // Frame-decode pool shared with other readers (seekable zstd); null for a pool of its own
+    std::shared_ptr<ThreadPool> decode_pool;
+    // `.dbnidx` sidecar, loaded on the first seek
+    std::optional<DbnIndex> index;
+    bool index_loaded = false;
+    Source source = Source::Path;
+    std::unique_ptr<MappedFile> source_memory;  // Source::Memory
+    std::vector<uint8_t> source_copy;           // Backs source_memory when the caller's bytes were copied
+    intptr_t source_descriptor = -1;            // Source::Stream
+    // Source::Stream: timestamps of the last record read and the one before it (for Unread)
+    std::array<uint64_t, 2> stream_last_ts{};
+    std::array<uint64_t, 2> stream_previous_ts{};
+
+    explicit DbnFileReaderWrapper(const std::filesystem::path& path)
+        : DbnFileReaderWrapper(path, false) {}
+
+    DbnFileReaderWrapper(const std::filesystem::path& path, bool memory_mapped,
+                         std::optional<PrefetchOptions> prefetch_options = std::nullopt,
+                         std::shared_ptr<ThreadPool> shared_decode_pool = nullptr)
+        : file_path(path)
+        , prefetch(prefetch_options)
+        , decode_pool(std::move(shared_decode_pool)) {
+        Open(memory_mapped);
+    }
+
+    /**
+     * Read DBN bytes (uncompressed or zstd) held in memory
+     * @param copy Copy the bytes first; otherwise they must outlive the reader
+     */
+    static std::unique_ptr<DbnFileReaderWrapper> FromMemory(const uint8_t* data, size_t size, bool copy) {
+        std::unique_ptr<DbnFileReaderWrapper> wrapper{new DbnFileReaderWrapper(Source::Memory)};
+        if (copy) {
+            wrapper->source_copy.assign(data, data + size);
+            data = wrapper->source_copy.data();
+        }
+        wrapper->source_memory = MappedFile::View(data, size);
+        wrapper->Open(true);
+        return wrapper;
+    }
+
+    /**
+     * Read from a descriptor the caller opened (POSIX fd or Windows HANDLE, not closed by
+     * the reader). Regular files are mapped and read from the start; pipes and other
+     * streams are read forward from their current position and cannot seek backwards.
+     */
+    static std::unique_ptr<DbnFileReaderWrapper> FromDescriptor(intptr_t descriptor) {
+        if (IsRegularFileDescriptor(descriptor)) {
+            std::unique_ptr<DbnFileReaderWrapper> wrapper{new DbnFileReaderWrapper(Source::Memory)};
+            wrapper->source_memory = MappedFile::FromDescriptor(descriptor);
+            wrapper->Open(true);
+            return wrapper;
+        }
+        std::unique_ptr<DbnFileReaderWrapper> wrapper{new DbnFileReaderWrapper(Source::Stream)};
+        wrapper->source_descriptor = descriptor;
+        wrapper->Open(false);
+        return wrapper;
+    }
+
+    bool IsOpen() const {
+        return decoder || mapping || seekable;
+    }
+
+    bool IsMapped() const {
+        return mapping != nullptr;
+    }
+
+    const databento::Metadata& GetMetadata() {
+        return *metadata;
+    }
+
+    /**
+     * Zero-based ordinal of the next record to be delivered
+     */
+    uint64_t Position() const {
+        return records_consumed - (pending_record.empty() ? 0 : 1);
+    }
+
+    /**
+     * Advance to the next record without copying it
+     * @return Pointer to the record bytes (valid until the next call in buffered mode,
+     *         until close in mapped mode), or nullptr at end of file
+     */
+    const uint8_t* NextRecordView() {
+        if (!pending_record.empty()) {
+            delivered_record.swap(pending_record);
+            pending_record.clear();
+            NoteStreamRecord(delivered_record.data());
+            return delivered_record.data();
+        }
+        if (seekable) {
+            const uint8_t* record = seekable->NextRecord();
+            if (record) {
+                ++records_consumed;
+            }
+            return record;
+        }
+        if (!mapping) {
+            const databento::Record* record = decoder->DecodeRecord();
+            if (!record) {
+                return nullptr;
+            }
+            ++records_consumed;
+            const auto* bytes = reinterpret_cast<const uint8_t*>(&record->Header());
+            NoteStreamRecord(bytes);
+            return bytes;
+        }
+
+        const size_t length = MappedRecordLength(mapped_offset);
+        if (length == 0) {
+            return nullptr;
+        }
+        const uint8_t* record = mapping->Data() + mapped_offset;
+        mapped_offset += length;
+        ++records_consumed;
+        return record;
+    }
+
+    /**
+     * Validated length of the mapped record starting at offset, or 0 at end of file
+     */
+    size_t MappedRecordLength(size_t offset) const {
+        const size_t size = mapping->Size();
+        if (offset >= size) {
+            return 0;
+        }
+        const size_t length = static_cast<size_t>(mapping->Data()[offset]) * databento::RecordHeader::kLengthMultiplier;
+        if (length < sizeof(databento::RecordHeader) || length > size - offset) {
+            throw std::runtime_error("Truncated or corrupt DBN record at byte offset " +
+                                     std::to_string(offset));
+        }
+        return length;
+    }
+
+    /**
+     * Position the reader so the next record delivered is record number ordinal
+     * (end of file if the file has fewer records)
+     */
+    void SeekOrdinal(uint64_t ordinal) {
+        const DbnIndexEntry* checkpoint =
+            LoadIndex() && CanJump() ? index->FindOrdinal(ordinal) : nullptr;
+        const uint64_t position = Position();
+        if (ordinal < position || (checkpoint && checkpoint->ordinal > position)) {
+            Restart(checkpoint);
+        } else if (ordinal > position) {
+            pending_record.clear();  // The held-back record is skipped like any other
+        }
+        while (records_consumed < ordinal && NextRecordView()) {
+        }
+    }
+
+    /**
+     * Position the reader at the first record whose timestamp is >= ts
+     * (end of file if there is none). Streams scan forward from the next record and fail
+     * if that record was already delivered.
+     */
+    void SeekTime(uint64_t ts, IndexTimestamp field) {
+        if (source == Source::Stream) {
+            if (Position() > 0 && LastDeliveredStreamTs(field) >= ts) {
+                throw std::runtime_error("A DBN stream read from a pipe cannot seek backwards");
+            }
+        } else {
+            const DbnIndexEntry* checkpoint =
+                LoadIndex() && CanJump() && index->Timestamp() == field ? index->FindTime(ts) : nullptr;
+            Restart(checkpoint);
+        }
+
+        while (const uint8_t* record = NextRecordView()) {
+            if (RecordTimestamp(record, field) >= ts) {
+                Unread(record);
+                return;
+            }
+        }
+    }
+
+    /**
+     * Hand the record just returned by NextRecordView() back out on the next read
+     */
+    void Unread(const uint8_t* record) {
+        const size_t length = reinterpret_cast<const databento::RecordHeader*>(record)->Size();
+        if (mapping) {
+            mapped_offset -= length;
+            --records_consumed;
+        } else {
+            pending_record.assign(record, record + length);
+            stream_last_ts = stream_previous_ts;
+        }
+    }
+
+private:
+    explicit DbnFileReaderWrapper(Source kind)
+        : source(kind) {}
+
+    void NoteStreamRecord(const uint8_t* record) {
+        if (source == Source::Stream) {
+            stream_previous_ts = stream_last_ts;
+            stream_last_ts = {RecordTimestamp(record, IndexTimestamp::TsEvent),
+                              RecordTimestamp(record, IndexTimestamp::TsRecv)};
+        }
+    }
+
+    // Timestamp of the last record handed to the caller (while a record is held back, the
+    // one delivered before it)
+    uint64_t LastDeliveredStreamTs(IndexTimestamp field) const {
+        return stream_last_ts[field == IndexTimestamp::TsRecv ? 1 : 0];
+    }
+
+    void Open(bool memory_mapped) {
+        if (!(memory_mapped && TryOpenMapped()) && !TryOpenSeekable()) {
+            ReadPrefix();
+            OpenBuffered(0);
+        }
+    }
+
+    // The whole source in memory: a fresh mapping of the path, or a view of the caller's bytes
+    std::unique_ptr<MappedFile> MapSource() const {
+        if (source == Source::Memory) {
+            return MappedFile::View(source_memory->Data(), source_memory->Size());
+        }
+        return std::make_unique<MappedFile>(file_path);
+    }
+
+    // Map the file if it is an uncompressed DBN file whose records need no upgrade;
+    // otherwise leave the wrapper for the buffered decoder path
+    bool TryOpenMapped() {
+        if (source == Source::Stream) {
+            return false;
+        }
+        auto mapped = MapSource();
+        const uint8_t* data = mapped->Data();
+        const size_t size = mapped->Size();
+        if (size < kDbnPrefixSize || std::memcmp(data, "DBN", 3) != 0) {
+            return false;  // zstd-compressed or not DBN: let the decoder handle/report it
+        }
+
+        databento::DbnDecoder decoder{&ReaderLogReceiver(),
+            std::make_unique<MemoryReadable>(data, size),
+            databento::VersionUpgradePolicy::AsIs};
+        databento::Metadata decoded = decoder.DecodeMetadata();
+        if (decoded.version < databento::kDbnVersion) {
+            return false;  // Records must be upgraded, which requires decoding into a copy
+        }
+
+        const uint32_t metadata_length = static_cast<uint32_t>(data[4]) |
+                                         (static_cast<uint32_t>(data[5]) << 8) |
+                                         (static_cast<uint32_t>(data[6]) << 16) |
+                                         (static_cast<uint32_t>(data[7]) << 24);
+        if (metadata_length > size - kDbnPrefixSize) {
+            throw std::runtime_error("Truncated DBN metadata");
+        }
+
+        mapped->Sequential();
+        records_start = kDbnPrefixSize + metadata_length;
+        mapped_offset = records_start;
+        metadata = std::move(decoded);
+        mapping = std::move(mapped);
+        return true;
+    }
+
+    // Use the parallel frame reader if the file is in the zstd seekable format and its
+    // records need no upgrade
+    bool TryOpenSeekable() {
+        if (source == Source::Stream) {
+            return false;
+        }
+        auto mapped = MapSource();
+        auto frames = ParseSeekTable(mapped->Data(), mapped->Size());
+        if (!frames) {
+            return false;
+        }
+        mapped->Sequential();
+        auto reader = decode_pool
+            ? std::make_unique<SeekableZstdReader>(std::move(mapped), std::move(*frames), decode_pool)
+            : std::make_unique<SeekableZstdReader>(std::move(mapped), std::move(*frames));
+
+        std::vector<uint8_t> prefix = reader->ReadPrefix(kDbnPrefixSize);
+        if (std::memcmp(prefix.data(), "DBN", 3) != 0) {
+            return false;  // Let the decoder report it
+        }
+        std::vector<uint8_t> header = reader->ReadPrefix(kDbnPrefixSize + ReadLe32(prefix.data() + 4));
+        databento::DbnDecoder decoder{&ReaderLogReceiver(),
+            std::make_unique<MemoryReadable>(header.data(), header.size()),
+            databento::VersionUpgradePolicy::AsIs};
+        databento::Metadata decoded = decoder.DecodeMetadata();
+        if (decoded.version < databento::kDbnVersion) {
+            return false;
+        }
+
+        compressed = true;
+        records_start = header.size();
+        reader->Start(records_start);
+        metadata = std::move(decoded);
+        seekable = std::move(reader);
+        return true;
+    }
+
+    // Detect compression and, for uncompressed files, where the records begin
+    void ReadPrefix() {
+        if (source == Source::Stream) {
+            return;  // Unknown until decoded; streams never resume mid-file
+        }
+        uint8_t prefix[kDbnPrefixSize] = {};
+        size_t prefix_length = 0;
+        if (source == Source::Memory) {
+            prefix_length = std::min(source_memory->Size(), sizeof(prefix));
+            if (prefix_length > 0) {
+                std::memcpy(prefix, source_memory->Data(), prefix_length);
+            }
+        } else {
+            std::ifstream in(file_path, std::ios::binary);
+            in.read(reinterpret_cast<char*>(prefix), sizeof(prefix));
+            prefix_length = static_cast<size_t>(in.gcount());
+        }
+        compressed = prefix_length < sizeof(prefix) || std::memcmp(prefix, "DBN", 3) != 0;
+        if (!compressed) {
+            records_start = kDbnPrefixSize + (static_cast<uint32_t>(prefix[4]) |
+                                              (static_cast<uint32_t>(prefix[5]) << 8) |
+                                              (static_cast<uint32_t>(prefix[6]) << 16) |
+                                              (static_cast<uint32_t>(prefix[7]) << 24));
+        }
+    }
+
+    // (Re)open the buffered decoder; for uncompressed files it can start at any record offset
+    void OpenBuffered(uint64_t offset) {
+        const bool resume = !compressed && offset > records_start;
+        std::unique_ptr<databento::IReadable> readable;
+        if (source == Source::Memory) {
+            // No index for in-memory sources, so the decoder always starts at the top
+            readable = std::make_unique<MemoryReadable>(source_memory->Data(), source_memory->Size());
+        } else if (source == Source::Stream) {
+            if (decoder) {
+                throw std::runtime_error("A DBN stream read from a pipe cannot be rewound");
+            }
+            readable = std::make_unique<DescriptorReadable>(source_descriptor);
+        } else if (prefetch) {
+            readable = std::make_unique<PrefetchReadable>(file_path, compressed, *prefetch,
+                                                          resume ? records_start : 0, resume ? offset : 0);
+        } else {
+            auto file = std::make_unique<FileReadable>(file_path);
+            if (resume) {
+                file->Resume(records_start, offset);
+            }
+            readable = std::move(file);
+        }
+        decoder = std::make_unique<databento::DbnDecoder>(&ReaderLogReceiver(), std::move(readable),
+                                                   databento::VersionUpgradePolicy::UpgradeToV3);
+        metadata = decoder->DecodeMetadata();
+    }
+
+    bool LoadIndex() {
+        if (!index_loaded) {
+            if (source == Source::Path) {
+                index = DbnIndex::Load(file_path);  // Sidecars only exist next to files
+            }
+            index_loaded = true;
+        }
+        return index.has_value();
+    }
+
+    // Checkpoints can be jumped to in uncompressed and seekable zstd files; plain zstd
+    // streams have to be decoded from the start
+    bool CanJump() const {
+        return mapping || seekable || !compressed;
+    }
+
+    // Go back to a checkpoint (or the first record when checkpoint is null)
+    void Restart(const DbnIndexEntry* checkpoint) {
+        pending_record.clear();
+        if (checkpoint && (checkpoint->offset < records_start || index->Compressed() != compressed)) {
+            throw std::runtime_error("DBN index checkpoint does not match the file");
+        }
+        if (seekable) {
+            seekable->Start(checkpoint ? checkpoint->offset : records_start);
+            records_consumed = checkpoint ? checkpoint->ordinal : 0;
+            return;
+        }
+        if (mapping) {
+            mapped_offset = checkpoint ? static_cast<size_t>(checkpoint->offset) : records_start;
+            records_consumed = checkpoint ? checkpoint->ordinal : 0;
+            if (mapped_offset < records_start || mapped_offset > mapping->Size()) {
+                throw std::runtime_error("DBN index checkpoint is outside the file");
+            }
+            return;
+        }
+        OpenBuffered(checkpoint ? checkpoint->offset : 0);
+        records_consumed = checkpoint ? checkpoint->ordinal : 0;
+    }
+};
+
+}  // namespace databento_native
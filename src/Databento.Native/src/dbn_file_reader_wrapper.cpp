@@ -1,32 +1,27 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
 #include "handle_validation.hpp"
-#include <databento/dbn_file_store.hpp>
+#include "dbn_file_reader.hpp"
+#include <databento/constants.hpp>
+#include <databento/dbn_decoder.hpp>
 #include <databento/enums.hpp>
 #include <databento/datetime.hpp>
 #include <nlohmann/json.hpp>
 #include <memory>
+#include <optional>
 #include <string>
+#include <vector>
 #include <cstring>
 #include <filesystem>
+#include <fstream>
 
 namespace db = databento;
 using json = nlohmann::json;
 using databento_native::SafeStrCopy;
 
-// ============================================================================
-// DBN File Reader Wrapper Structure
-// ============================================================================
-
-struct DbnFileReaderWrapper {
-    std::unique_ptr<db::DbnFileStore> file_store;
-    std::filesystem::path file_path;
-
-    explicit DbnFileReaderWrapper(const std::filesystem::path& path)
-        : file_path(path) {
-        file_store = std::make_unique<db::DbnFileStore>(path);
-    }
-};
+using databento_native::DbnFileReaderWrapper;
+using databento_native::kDbnPrefixSize;
+using databento_native::ReaderLogReceiver;
 
 // ============================================================================
 // Helper Functions
@@ -105,6 +100,78 @@ static json MetadataToJson(const db::Metadata& metadata) {
     return j;
 }
 
+// Write the `.dbnidx` sidecar for a DBN file. Offsets are file offsets for uncompressed
+// files and decompressed-stream offsets for zstd files.
+static void BuildDbnIndex(const std::filesystem::path& path, uint32_t interval,
+                          databento_native::IndexTimestamp field)
+{
+    auto mapped = std::make_unique<databento_native::MappedFile>(path);
+    const uint8_t* data = mapped->Data();
+    const size_t size = mapped->Size();
+
+    if (size >= kDbnPrefixSize && std::memcmp(data, "DBN", 3) == 0) {
+        // Uncompressed (any DBN version): walk the raw records in place, no decoding needed
+        const size_t metadata_length = databento_native::ReadLe32(data + 4);
+        if (metadata_length > size - kDbnPrefixSize) {
+            throw std::runtime_error("Truncated DBN metadata");
+        }
+        mapped->Sequential();
+        databento_native::DbnIndex index{field, interval, false};
+        size_t offset = kDbnPrefixSize + metadata_length;
+        while (offset < size) {
+            const size_t length = static_cast<size_t>(data[offset]) * db::RecordHeader::kLengthMultiplier;
+            if (length < sizeof(db::RecordHeader) || length > size - offset) {
+                throw std::runtime_error("Truncated or corrupt DBN record at byte offset " +
+                                         std::to_string(offset));
+            }
+            index.Add(data + offset, offset);
+            offset += length;
+        }
+        index.Save(path);
+        return;
+    }
+
+    if (auto frames = databento_native::ParseSeekTable(data, size)) {
+        // Seekable zstd: frames are decompressed in parallel
+        mapped->Sequential();
+        databento_native::SeekableZstdReader reader{std::move(mapped), std::move(*frames)};
+        std::vector<uint8_t> prefix = reader.ReadPrefix(kDbnPrefixSize);
+        if (std::memcmp(prefix.data(), "DBN", 3) != 0) {
+            throw std::runtime_error("Not a DBN file");
+        }
+        reader.Start(kDbnPrefixSize + databento_native::ReadLe32(prefix.data() + 4));
+        databento_native::DbnIndex index{field, interval, true};
+        for (;;) {
+            const uint64_t offset = reader.Offset();
+            const uint8_t* record = reader.NextRecord();
+            if (!record) {
+                break;
+            }
+            index.Add(record, offset);
+        }
+        index.Save(path);
+        return;
+    }
+
+    // Plain zstd stream: decode as-is so record sizes match the stored records
+    std::vector<uint8_t> prefix = databento_native::DecompressPrefix(data, size, kDbnPrefixSize);
+    if (std::memcmp(prefix.data(), "DBN", 3) != 0) {
+        throw std::runtime_error("Not a DBN file");
+    }
+    mapped.reset();
+    db::DbnDecoder decoder{&ReaderLogReceiver(),
+        std::make_unique<databento_native::FileReadable>(path),
+        db::VersionUpgradePolicy::AsIs};
+    decoder.DecodeMetadata();
+    databento_native::DbnIndex index{field, interval, true};
+    uint64_t offset = kDbnPrefixSize + databento_native::ReadLe32(prefix.data() + 4);
+    while (const db::Record* record = decoder.DecodeRecord()) {
+        index.Add(reinterpret_cast<const uint8_t*>(&record->Header()), offset);
+        offset += record->Size();
+    }
+    index.Save(path);
+}
+
 // ============================================================================
 // DBN File Reader API Implementation
 // ============================================================================
@@ -137,6 +204,128 @@ DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open(
     }
 }
 
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_mapped(
+    const char* file_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return nullptr;
+        }
+
+        std::filesystem::path path{file_path};
+        if (!std::filesystem::exists(path)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File does not exist");
+            return nullptr;
+        }
+
+        auto wrapper = std::make_unique<DbnFileReaderWrapper>(path, true);
+        return reinterpret_cast<DbnFileReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileReader, wrapper.release()));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_prefetch(
+    const char* file_path,
+    size_t block_size,
+    size_t block_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return nullptr;
+        }
+
+        std::filesystem::path path{file_path};
+        if (!std::filesystem::exists(path)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File does not exist");
+            return nullptr;
+        }
+
+        databento_native::PrefetchOptions options;
+        if (block_size > 0) {
+            options.block_size = block_size;
+        }
+        if (block_count > 0) {
+            options.block_count = block_count;
+        }
+        auto wrapper = std::make_unique<DbnFileReaderWrapper>(path, false, options);
+        return reinterpret_cast<DbnFileReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileReader, wrapper.release()));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_memory(
+    const uint8_t* data,
+    size_t size,
+    int copy,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!data && size > 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return nullptr;
+        }
+
+        auto wrapper = DbnFileReaderWrapper::FromMemory(data, size, copy != 0);
+        return reinterpret_cast<DbnFileReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileReader, wrapper.release()));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileReaderHandle dbento_dbn_file_open_descriptor(
+    intptr_t descriptor,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (descriptor == -1) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid descriptor");
+            return nullptr;
+        }
+
+        auto wrapper = DbnFileReaderWrapper::FromDescriptor(descriptor);
+        return reinterpret_cast<DbnFileReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileReader, wrapper.release()));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_is_mapped(DbnFileReaderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, nullptr);
+        if (!wrapper) {
+            return -1;
+        }
+        return wrapper->IsMapped() ? 1 : 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
 DATABENTO_API const char* dbento_dbn_file_get_metadata(
     DbnFileReaderHandle handle,
     char* error_buffer,
@@ -146,13 +335,13 @@ DATABENTO_API const char* dbento_dbn_file_get_metadata(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
             handle, databento_native::HandleType::DbnFileReader, &validation_error);
-        if (!wrapper || !wrapper->file_store) {
+        if (!wrapper || !wrapper->IsOpen()) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return nullptr;
         }
 
-        const db::Metadata& metadata = wrapper->file_store->GetMetadata();
+        const db::Metadata& metadata = wrapper->GetMetadata();
         json j = MetadataToJson(metadata);
         std::string json_str = j.dump();
         return AllocateString(json_str);
@@ -176,13 +365,13 @@ DATABENTO_API int dbento_dbn_file_next_record(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
             handle, databento_native::HandleType::DbnFileReader, &validation_error);
-        if (!wrapper || !wrapper->file_store) {
+        if (!wrapper || !wrapper->IsOpen()) {
             SafeStrCopy(error_buffer, error_buffer_size,
                 wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
             return -1;
         }
 
-        const db::Record* record = wrapper->file_store->NextRecord();
+        const uint8_t* record = wrapper->NextRecordView();
 
         // nullptr indicates end of file
         if (!record) {
@@ -190,19 +379,17 @@ DATABENTO_API int dbento_dbn_file_next_record(
             return 1; // Return 1 to indicate EOF (not an error)
         }
 
-        // Get record size and type
-        size_t rec_size = record->Size();
-        uint8_t rec_type = static_cast<uint8_t>(record->RType());
+        // Get record size and type from the RecordHeader
+        const auto* header = reinterpret_cast<const db::RecordHeader*>(record);
+        size_t rec_size = header->Size();
+        uint8_t rec_type = static_cast<uint8_t>(header->rtype);
 
         if (rec_size > record_buffer_size) {
             SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
             return -1;
         }
 
-        // Copy record data from the underlying RecordHeader pointer
-        // The Record class is a wrapper - we need to get the actual data pointer
-        const void* record_data = &record->Header();
-        std::memcpy(record_buffer, record_data, rec_size);
+        std::memcpy(record_buffer, record, rec_size);
         *record_length = rec_size;
         *record_type = rec_type;
 
@@ -214,6 +401,249 @@ DATABENTO_API int dbento_dbn_file_next_record(
     }
 }
 
+DATABENTO_API int dbento_dbn_file_next_record_view(
+    DbnFileReaderHandle handle,
+    const uint8_t** record_ptr,
+    size_t* record_length,
+    uint8_t* record_type,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper || !wrapper->IsOpen()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!record_ptr || !record_length || !record_type) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Output parameters cannot be null");
+            return -2;
+        }
+
+        const uint8_t* record = wrapper->NextRecordView();
+        if (!record) {
+            *record_ptr = nullptr;
+            *record_length = 0;
+            return 1; // EOF
+        }
+
+        const auto* header = reinterpret_cast<const db::RecordHeader*>(record);
+        *record_ptr = record;
+        *record_length = header->Size();
+        *record_type = static_cast<uint8_t>(header->rtype);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_next_records(
+    DbnFileReaderHandle handle,
+    uint8_t* buffer,
+    size_t buffer_capacity,
+    size_t* record_offsets,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper || !wrapper->IsOpen()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!buffer || !record_offsets || !record_count || max_records == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        size_t used = 0;
+        size_t count = 0;
+
+        // Deliver a record left over from the previous call first
+        if (!wrapper->pending_record.empty()) {
+            if (wrapper->pending_record.size() > buffer_capacity) {
+                *record_count = 0;
+                SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
+                return -3;
+            }
+            std::memcpy(buffer, wrapper->pending_record.data(), wrapper->pending_record.size());
+            record_offsets[count++] = 0;
+            used = wrapper->pending_record.size();
+            wrapper->pending_record.clear();
+        }
+
+        if (wrapper->IsMapped()) {
+            // Records are contiguous in the mapping: find how many fit, then copy them at once
+            const size_t start = wrapper->mapped_offset;
+            const size_t first = count;
+            size_t end = start;
+            while (count < max_records) {
+                size_t length = wrapper->MappedRecordLength(end);
+                if (length == 0 || used + (end - start) + length > buffer_capacity) {
+                    break;
+                }
+                record_offsets[count++] = used + (end - start);
+                end += length;
+            }
+            if (end > start) {
+                std::memcpy(buffer + used, wrapper->mapping->Data() + start, end - start);
+                used += end - start;
+                wrapper->mapped_offset = end;
+                wrapper->records_consumed += count - first;
+            }
+        } else {
+            while (count < max_records) {
+                const uint8_t* record = wrapper->NextRecordView();
+                if (!record) {
+                    break;
+                }
+                size_t length = reinterpret_cast<const db::RecordHeader*>(record)->Size();
+                if (used + length > buffer_capacity) {
+                    // Keep it for the next call; the store's buffer is reused on the next read
+                    wrapper->pending_record.assign(record, record + length);
+                    break;
+                }
+                std::memcpy(buffer + used, record, length);
+                record_offsets[count++] = used;
+                used += length;
+            }
+        }
+
+        *record_count = count;
+        if (count > 0) {
+            return 0;
+        }
+
+        // Nothing delivered: either the next record alone exceeds the buffer, or EOF
+        bool too_small = !wrapper->pending_record.empty() ||
+            (wrapper->IsMapped() && wrapper->MappedRecordLength(wrapper->mapped_offset) > 0);
+        if (too_small) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
+            return -3;
+        }
+        return 1; // EOF
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_build_index(
+    const char* file_path,
+    uint32_t interval,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return -2;
+        }
+        if (ts_field != 0 && ts_field != 1) {
+            SafeStrCopy(error_buffer, error_buffer_size, "ts_field must be 0 (ts_event) or 1 (ts_recv)");
+            return -2;
+        }
+
+        std::filesystem::path path{file_path};
+        if (!std::filesystem::exists(path)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File does not exist");
+            return -1;
+        }
+
+        BuildDbnIndex(path, interval, static_cast<databento_native::IndexTimestamp>(ts_field));
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_seek_ordinal(
+    DbnFileReaderHandle handle,
+    uint64_t ordinal,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper || !wrapper->IsOpen()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        wrapper->SeekOrdinal(ordinal);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_seek_time(
+    DbnFileReaderHandle handle,
+    uint64_t timestamp_ns,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper || !wrapper->IsOpen()) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "File store not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (ts_field != 0 && ts_field != 1) {
+            SafeStrCopy(error_buffer, error_buffer_size, "ts_field must be 0 (ts_event) or 1 (ts_recv)");
+            return -2;
+        }
+
+        wrapper->SeekTime(timestamp_ns, static_cast<databento_native::IndexTimestamp>(ts_field));
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int64_t dbento_dbn_file_position(DbnFileReaderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, nullptr);
+        if (!wrapper || !wrapper->IsOpen()) {
+            return -1;
+        }
+        return static_cast<int64_t>(wrapper->Position());
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
 DATABENTO_API void dbento_dbn_file_close(DbnFileReaderHandle handle)
 {
     try {
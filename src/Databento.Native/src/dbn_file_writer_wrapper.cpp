@@ -1,110 +1,372 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
+#include "buffered_file_writer.hpp"
+#include "dbn_index.hpp"
+#include "dbn_recovery.hpp"
+#include "dbn_summary.hpp"
 #include "handle_validation.hpp"
+#include "metadata_json.hpp"
+#include "seekable_zstd.hpp"
+#include "spsc_record_ring.hpp"
 #include <databento/dbn_encoder.hpp>
-#include <databento/file_stream.hpp>
 #include <databento/dbn.hpp>
 #include <databento/enums.hpp>
-#include <databento/datetime.hpp>
 #include <databento/record.hpp>
-#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <cstring>
 #include <filesystem>
-#include <sstream>
-#include <date/date.h>
+#include <thread>
 
 namespace db = databento;
-using json = nlohmann::json;
 using databento_native::SafeStrCopy;
+using databento_native::ParseMetadataFromJson;
 
 // ============================================================================
 // DBN File Writer Wrapper Structure
 // ============================================================================
 
 struct DbnFileWriterWrapper {
-    std::unique_ptr<db::OutFileStream> file_stream;
-    std::unique_ptr<db::DbnEncoder> encoder;
+    std::unique_ptr<databento_native::BufferedFileWriter> file_stream;
+    // Seekable zstd output (instead of file_stream); finished when the wrapper is destroyed
+    std::unique_ptr<databento_native::SeekableZstdWriter> zstd_stream;
     std::filesystem::path file_path;
 
+    // Background mode: writes only enqueue into ring; writer_thread owns the sinks
+    std::unique_ptr<databento_native::SpscRecordRing> ring;
+    std::thread writer_thread;
+    uint64_t records_queued = 0;  // Producer side only
+    std::mutex progress_mutex;
+    std::condition_variable progress_cv;
+    uint64_t records_written = 0;  // Guarded by progress_mutex
+    std::atomic<bool> writer_failed{false};
+    std::string writer_error;  // Set before writer_failed is published
+
+    // Checkpoints (see dbn_recovery.hpp); used by whichever thread writes to the sinks
+    bool checkpointing = false;
+    std::chrono::milliseconds checkpoint_interval{0};
+    uint64_t checkpoint_bytes = 0;
+    std::chrono::steady_clock::time_point last_checkpoint_time;
+    uint64_t last_checkpoint_position = 0;
+    uint64_t sink_records = 0;
+    uint64_t sink_max_ts = 0;
+
+    // Seek index, statistics and zone maps built as records are written, saved as sidecars
+    // on a clean close; used by whichever thread writes to the sinks
+    std::unique_ptr<databento_native::DbnIndex> index;
+    std::unique_ptr<databento_native::DbnSummary> summary;
+    std::unique_ptr<databento_native::DbnZoneMap> zones;
+    uint64_t stream_offset = 0;  // Offset of the next record (decompressed, for zstd)
+    bool records_started = false;  // Producer side only
+    bool closed = false;
+
     DbnFileWriterWrapper(const std::filesystem::path& path,
-                         std::unique_ptr<db::OutFileStream> stream,
-                         std::unique_ptr<db::DbnEncoder> enc)
+                         std::unique_ptr<databento_native::BufferedFileWriter> stream,
+                         const db::Metadata& metadata)
         : file_stream(std::move(stream))
-        , encoder(std::move(enc))
         , file_path(path) {
+        db::DbnEncoder::EncodeMetadata(metadata, file_stream.get());
+        stream_offset = file_stream->Position();
     }
-};
 
-// ============================================================================
-// Helper Functions
-// ============================================================================
+    DbnFileWriterWrapper(const std::filesystem::path& path,
+                         std::unique_ptr<databento_native::SeekableZstdWriter> stream,
+                         const db::Metadata& metadata)
+        : zstd_stream(std::move(stream))
+        , file_path(path) {
+        // Metadata gets a frame of its own, stored uncompressed so recovery can patch its end
+        // time, and every later frame starts on a record
+        databento_native::StringWritable encoded;
+        db::DbnEncoder::EncodeMetadata(metadata, &encoded);
+        zstd_stream->WriteStoredFrame(reinterpret_cast<const std::byte*>(encoded.data.data()), encoded.data.size());
+        stream_offset = encoded.data.size();
+    }
 
-// Parse JSON metadata and construct db::Metadata
-static db::Metadata ParseMetadataFromJson(const std::string& json_str) {
-    json j = json::parse(json_str);
+    ~DbnFileWriterWrapper() {
+        StopBackground();  // The writer thread uses the sinks: join it before they close
+    }
+
+    DbnFileWriterWrapper(const DbnFileWriterWrapper&) = delete;
+    DbnFileWriterWrapper& operator=(const DbnFileWriterWrapper&) = delete;
+
+    /**
+     * Switch to background mode: later writes are queued and written by a dedicated thread
+     */
+    void StartBackground(size_t ring_capacity) {
+        if (ring) {
+            throw std::runtime_error("Background writer already started");
+        }
+        ring = std::make_unique<databento_native::SpscRecordRing>(
+            ring_capacity > 0 ? ring_capacity : databento_native::SpscRecordRing::kDefaultCapacity);
+        writer_thread = std::thread([this] { BackgroundLoop(); });
+    }
+
+    /**
+     * Checkpoint every interval and/or every interval_bytes of output (0 = not by that measure)
+     *
+     * Call before writing records: the checkpoint counts only records written from then on.
+     */
+    void EnableCheckpoints(std::chrono::milliseconds interval, uint64_t interval_bytes) {
+        ThrowIfStarted("Checkpoints");
+        checkpointing = true;
+        checkpoint_interval = interval;
+        checkpoint_bytes = interval_bytes;
+        WriteCheckpoint();
+    }
 
-    db::Metadata metadata;
-    metadata.version = j["version"].get<std::uint8_t>();
-    metadata.dataset = j["dataset"].get<std::string>();
+    /**
+     * Build the seek index (`.dbnidx`), statistics and per-instrument zone maps
+     * (`.stats.json`) while writing; both sidecars are saved when the writer closes cleanly
+     *
+     * Call before writing records, so the index covers the whole file.
+     */
+    void EnableIndex(uint32_t interval, databento_native::IndexTimestamp timestamp) {
+        ThrowIfStarted("Indexing");
+        index = std::make_unique<databento_native::DbnIndex>(timestamp, interval, static_cast<bool>(zstd_stream));
+        summary = std::make_unique<databento_native::DbnSummary>();
+        summary->files = 1;
+        zones = std::make_unique<databento_native::DbnZoneMap>(timestamp);
+    }
 
-    // Parse optional schema
-    if (!j["schema"].is_null()) {
-        metadata.schema = static_cast<db::Schema>(j["schema"].get<int>());
+    /**
+     * Write records laid out back to back; all lengths are checked before anything is written
+     *
+     * DbnEncoder::EncodeRecord only copies the record bytes to its output, so the records
+     * go to the sink directly instead of through a db::Record (which needs a mutable header).
+     * In background mode the records are only copied into the ring, blocking while it is full.
+     * @return Number of records written
+     */
+    size_t WriteRecords(const uint8_t* records, size_t length) {
+        ThrowIfClosed();
+        size_t count = 0;
+        for (size_t offset = 0; offset < length; ++count) {
+            const size_t record_length = static_cast<size_t>(records[offset]) * db::RecordHeader::kLengthMultiplier;
+            if (record_length < sizeof(db::RecordHeader) || record_length > length - offset) {
+                throw std::runtime_error("Truncated or corrupt DBN record at byte offset " + std::to_string(offset));
+            }
+            offset += record_length;
+        }
+        records_started = records_started || length > 0;
+
+        if (ring) {
+            ThrowIfWriterFailed();
+            for (size_t offset = 0; offset < length;) {
+                const size_t record_length = static_cast<size_t>(records[offset]) * db::RecordHeader::kLengthMultiplier;
+                if (!ring->Push(records + offset, record_length)) {
+                    ThrowIfWriterFailed();
+                }
+                ++records_queued;
+                offset += record_length;
+            }
+        } else {
+            WriteToSink(records, length);
+            MaybeCheckpoint();
+        }
+        return count;
     }
 
-    // Parse start/end timestamps (nanoseconds)
-    auto start_ns = j["start"].get<int64_t>();
-    auto end_ns = j["end"].get<int64_t>();
-    metadata.start = db::UnixNanos{std::chrono::duration<uint64_t, std::nano>{static_cast<uint64_t>(start_ns)}};
-    metadata.end = db::UnixNanos{std::chrono::duration<uint64_t, std::nano>{static_cast<uint64_t>(end_ns)}};
+    /**
+     * Hand written records to the OS, and with sync wait until they are on the device
+     *
+     * In background mode, first waits for the writer thread to write every queued record.
+     */
+    void Flush(bool sync) {
+        ThrowIfClosed();
+        WaitForWriter();
+        if (zstd_stream) {
+            if (sync) {
+                zstd_stream->Sync();
+            } else {
+                zstd_stream->Flush();  // Close the open frame and write every compressed frame
+            }
+        } else if (sync) {
+            file_stream->Sync();
+        } else {
+            file_stream->Flush();
+        }
+    }
 
-    metadata.limit = j["limit"].get<std::uint64_t>();
+    /**
+     * Sync everything written so far to the device and record it in the sidecar
+     */
+    void Checkpoint() {
+        ThrowIfClosed();
+        if (!checkpointing) {
+            throw std::runtime_error("Checkpoints are not enabled for this writer");
+        }
+        WaitForWriter();
+        WriteCheckpoint();
+    }
 
-    // Parse optional stype_in
-    if (!j["stype_in"].is_null()) {
-        metadata.stype_in = static_cast<db::SType>(j["stype_in"].get<int>());
+    /**
+     * Drain the queue, close the output and, in background mode or with checkpoints, sync it
+     * to the device; a clean close removes the checkpoint sidecar. Only the first call does
+     * anything, so errors are reported once.
+     */
+    void Close() {
+        if (closed) {
+            return;
+        }
+        closed = true;
+        const bool background = static_cast<bool>(ring);
+        StopBackground();
+        ThrowIfWriterFailed();
+        if (zstd_stream) {
+            zstd_stream->Finish();
+        } else {
+            file_stream->Close();
+        }
+        if (background || checkpointing) {
+            databento_native::SyncFileToDisk(file_path);
+        }
+        if (index) {
+            index->Save(file_path);
+            databento_native::SaveStatsSidecar(file_path, *summary, *zones);
+        }
+        if (checkpointing) {
+            databento_native::RemoveCheckpoint(file_path);
+        }
     }
 
-    metadata.stype_out = static_cast<db::SType>(j["stype_out"].get<int>());
-    metadata.ts_out = j["ts_out"].get<bool>();
-    metadata.symbol_cstr_len = j["symbol_cstr_len"].get<std::size_t>();
+private:
+    void ThrowIfClosed() const {
+        if (closed) {
+            throw std::runtime_error("DBN file writer is closed");
+        }
+    }
 
-    // Parse symbol arrays
-    metadata.symbols = j["symbols"].get<std::vector<std::string>>();
-    metadata.partial = j["partial"].get<std::vector<std::string>>();
-    metadata.not_found = j["not_found"].get<std::vector<std::string>>();
+    // The writer thread touches no sink or index state before the first record is queued
+    void ThrowIfStarted(const char* feature) const {
+        if (records_started) {
+            throw std::runtime_error(std::string(feature) + " must be enabled before writing records");
+        }
+    }
 
-    // Parse mappings
-    if (j.contains("mappings") && j["mappings"].is_array()) {
-        for (const auto& mapping_json : j["mappings"]) {
-            db::SymbolMapping mapping;
-            mapping.raw_symbol = mapping_json["raw_symbol"].get<std::string>();
+    // In background mode, wait until the writer thread has written every queued record
+    void WaitForWriter() {
+        if (ring) {
+            std::unique_lock<std::mutex> lock(progress_mutex);
+            progress_cv.wait(lock, [this] {
+                return records_written >= records_queued || writer_failed.load(std::memory_order_acquire);
+            });
+            lock.unlock();
+            ThrowIfWriterFailed();
+            // The writer thread is idle until the next push, so the sinks can be used here
+        }
+    }
 
-            for (const auto& interval_json : mapping_json["intervals"]) {
-                db::MappingInterval interval;
+    uint64_t SinkPosition() const {
+        return zstd_stream ? zstd_stream->Position() : file_stream->Position();
+    }
 
-                // Parse ISO 8601 date strings
-                std::string start_date_str = interval_json["start_date"].get<std::string>();
-                std::string end_date_str = interval_json["end_date"].get<std::string>();
+    void WriteCheckpoint() {
+        // Sync closes the open zstd frame, so the position is a frame boundary
+        if (zstd_stream) {
+            zstd_stream->Sync();
+        } else {
+            file_stream->Sync();
+        }
+        databento_native::DbnWriteCheckpoint checkpoint;
+        checkpoint.offset = SinkPosition();
+        checkpoint.records = sink_records;
+        checkpoint.last_ts = sink_max_ts;
+        checkpoint.compressed = static_cast<bool>(zstd_stream);
+        databento_native::WriteCheckpoint(file_path, checkpoint);
+        last_checkpoint_time = std::chrono::steady_clock::now();
+        last_checkpoint_position = checkpoint.offset;
+    }
 
-                std::istringstream ss_start(start_date_str);
-                std::istringstream ss_end(end_date_str);
+    void MaybeCheckpoint() {
+        if (!checkpointing) {
+            return;
+        }
+        const bool by_bytes = checkpoint_bytes > 0 && SinkPosition() - last_checkpoint_position >= checkpoint_bytes;
+        const bool by_time = checkpoint_interval.count() > 0 &&
+                             std::chrono::steady_clock::now() - last_checkpoint_time >= checkpoint_interval;
+        if (by_bytes || by_time) {
+            WriteCheckpoint();
+        }
+    }
 
-                ss_start >> date::parse("%Y-%m-%d", interval.start_date);
-                ss_end >> date::parse("%Y-%m-%d", interval.end_date);
+    void WriteToSink(const uint8_t* records, size_t length) {
+        const auto* bytes = reinterpret_cast<const std::byte*>(records);
+        if (zstd_stream) {
+            // Record by record so frames can close on any record boundary
+            for (size_t offset = 0; offset < length;) {
+                const size_t record_length = static_cast<size_t>(records[offset]) * db::RecordHeader::kLengthMultiplier;
+                zstd_stream->WriteAll(bytes + offset, record_length);
+                zstd_stream->RecordBoundary();
+                offset += record_length;
+            }
+        } else {
+            file_stream->WriteAll(bytes, length);
+        }
+        if (checkpointing || index) {
+            for (size_t offset = 0; offset < length;) {
+                const uint8_t* record = records + offset;
+                const size_t record_length = static_cast<size_t>(record[0]) * db::RecordHeader::kLengthMultiplier;
+                if (checkpointing) {
+                    const uint64_t ts = databento_native::OrderTimestamp(record, record_length);
+                    if (ts != databento_native::kUndefTimestamp) {
+                        sink_max_ts = std::max(sink_max_ts, ts);
+                    }
+                    ++sink_records;
+                }
+                if (index) {
+                    index->Add(record, stream_offset);
+                    summary->Add(record);
+                    zones->Add(record);
+                    stream_offset += record_length;
+                }
+                offset += record_length;
+            }
+        }
+    }
 
-                interval.symbol = interval_json["symbol"].get<std::string>();
-                mapping.intervals.push_back(interval);
+    void BackgroundLoop() {
+        try {
+            uint64_t written = 0;
+            while (ring->ConsumeBatch([&](const uint8_t* record, size_t length) {
+                WriteToSink(record, length);
+                ++written;
+            })) {
+                MaybeCheckpoint();
+                {
+                    std::lock_guard<std::mutex> lock(progress_mutex);
+                    records_written = written;
+                }
+                progress_cv.notify_all();
             }
+        }
+        catch (const std::exception& e) {
+            {
+                std::lock_guard<std::mutex> lock(progress_mutex);
+                writer_error = e.what();
+                writer_failed.store(true, std::memory_order_release);
+            }
+            ring->Cancel();  // Unblocks a producer waiting for space
+            progress_cv.notify_all();
+        }
+    }
 
-            metadata.mappings.push_back(mapping);
+    void StopBackground() {
+        if (writer_thread.joinable()) {
+            ring->Close();
+            writer_thread.join();
         }
     }
 
-    return metadata;
-}
+    void ThrowIfWriterFailed() const {
+        if (writer_failed.load(std::memory_order_acquire)) {
+            throw std::runtime_error("Background DBN writer failed: " + writer_error);
+        }
+    }
+};
 
 // ============================================================================
 // DBN File Writer API Implementation
@@ -127,13 +389,44 @@ DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create(
 
         // Create file stream
         std::filesystem::path path{file_path};
-        auto file_stream = std::make_unique<db::OutFileStream>(path);
+        auto file_stream = std::make_unique<databento_native::BufferedFileWriter>(path);
+
+        // Create wrapper (it writes the metadata header)
+        auto* wrapper = new DbnFileWriterWrapper(path, std::move(file_stream), metadata);
+        return reinterpret_cast<DbnFileWriterHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileWriter, wrapper));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API DbnFileWriterHandle dbento_dbn_file_create_seekable(
+    const char* file_path,
+    const char* metadata_json,
+    int compression_level,
+    size_t frame_size,
+    int worker_threads,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path || !metadata_json) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path and metadata cannot be null");
+            return nullptr;
+        }
+        if (worker_threads < 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Worker thread count cannot be negative");
+            return nullptr;
+        }
 
-        // Create encoder (it will write the metadata header automatically)
-        auto encoder = std::make_unique<db::DbnEncoder>(metadata, file_stream.get());
+        db::Metadata metadata = ParseMetadataFromJson(metadata_json);
 
-        // Create wrapper
-        auto* wrapper = new DbnFileWriterWrapper(path, std::move(file_stream), std::move(encoder));
+        std::filesystem::path path{file_path};
+        auto zstd_stream = std::make_unique<databento_native::SeekableZstdWriter>(
+            path, compression_level, frame_size, static_cast<size_t>(worker_threads));
+        auto* wrapper = new DbnFileWriterWrapper(path, std::move(zstd_stream), metadata);
         return reinterpret_cast<DbnFileWriterHandle>(
             databento_native::CreateValidatedHandle(databento_native::HandleType::DbnFileWriter, wrapper));
     }
@@ -154,9 +447,8 @@ DATABENTO_API int dbento_dbn_file_write_record(
         databento_native::ValidationError validation_error;
         auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
             handle, databento_native::HandleType::DbnFileWriter, &validation_error);
-        if (!wrapper || !wrapper->encoder) {
-            SafeStrCopy(error_buffer, error_buffer_size,
-                wrapper ? "Encoder not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
             return -1;
         }
 
@@ -164,18 +456,220 @@ DATABENTO_API int dbento_dbn_file_write_record(
             SafeStrCopy(error_buffer, error_buffer_size, "Invalid record data");
             return -1;
         }
+        // Exactly one record: packed runs go through dbento_dbn_file_write_records
+        if (static_cast<size_t>(record_bytes[0]) * db::RecordHeader::kLengthMultiplier != record_length) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Record length does not match its header");
+            return -1;
+        }
 
-        // Create Record from raw bytes (Record constructor requires mutable pointer)
-        // Copy data to mutable buffer to avoid const_cast undefined behavior
-        std::vector<uint8_t> mutable_copy(record_bytes, record_bytes + record_length);
-        const db::Record record{reinterpret_cast<db::RecordHeader*>(mutable_copy.data())};
+        wrapper->WriteRecords(record_bytes, record_length);
+        return 0; // Success
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
 
-        // SAFETY: EncodeRecord processes the record synchronously and does not store
-        // the pointer. The mutable_copy vector remains alive until after EncodeRecord
-        // returns, ensuring no use-after-free. This is safe by design of databento-cpp.
-        wrapper->encoder->EncodeRecord(record);
+DATABENTO_API int dbento_dbn_file_write_records(
+    DbnFileWriterHandle handle,
+    const uint8_t* records,
+    size_t length,
+    size_t* records_written,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (!records && length > 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid record data");
+            return -1;
+        }
 
-        return 0; // Success
+        const size_t count = length > 0 ? wrapper->WriteRecords(records, length) : 0;
+        if (records_written) {
+            *records_written = count;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_start_background(
+    DbnFileWriterHandle handle,
+    size_t queue_capacity,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        wrapper->StartBackground(queue_capacity);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_flush(
+    DbnFileWriterHandle handle,
+    int sync,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        wrapper->Flush(sync != 0);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_enable_checkpoints(
+    DbnFileWriterHandle handle,
+    uint64_t interval_ms,
+    uint64_t interval_bytes,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        wrapper->EnableCheckpoints(std::chrono::milliseconds{interval_ms}, interval_bytes);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_enable_index(
+    DbnFileWriterHandle handle,
+    uint32_t interval,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        if (ts_field != 0 && ts_field != 1) {
+            SafeStrCopy(error_buffer, error_buffer_size, "ts_field must be 0 (ts_event) or 1 (ts_recv)");
+            return -2;
+        }
+        wrapper->EnableIndex(interval, static_cast<databento_native::IndexTimestamp>(ts_field));
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_checkpoint(
+    DbnFileWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        wrapper->Checkpoint();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_recover(
+    const char* file_path,
+    uint64_t* records,
+    uint64_t* bytes_truncated,
+    int* end_patched,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_path) {
+            SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+            return -2;
+        }
+        const auto result = databento_native::RecoverDbnFile(std::filesystem::path{file_path});
+        if (records) {
+            *records = result.records;
+        }
+        if (bytes_truncated) {
+            *bytes_truncated = result.bytes_truncated;
+        }
+        if (end_patched) {
+            *end_patched = result.end_patched ? 1 : 0;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_file_finish(
+    DbnFileWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
+            handle, databento_native::HandleType::DbnFileWriter, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        wrapper->Close();
+        return 0;
     }
     catch (const std::exception& e) {
         SafeStrCopy(error_buffer, error_buffer_size, e.what());
@@ -189,7 +683,14 @@ DATABENTO_API void dbento_dbn_file_close_writer(DbnFileWriterHandle handle)
         auto* wrapper = databento_native::ValidateAndCast<DbnFileWriterWrapper>(
             handle, databento_native::HandleType::DbnFileWriter, nullptr);
         if (wrapper) {
-            // Destructor will automatically flush and close the file stream
+            // Drain any background queue, then flush and close the file stream
+            // (for seekable zstd output: write the last frame and the seek table)
+            try {
+                wrapper->Close();
+            }
+            catch (...) {
+                // Close errors cannot be reported here; call dbento_dbn_file_finish first to observe them
+            }
             delete wrapper;
             databento_native::DestroyValidatedHandle(handle);
         }
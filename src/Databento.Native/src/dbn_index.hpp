@@ -0,0 +1,290 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <vector>
+#include <databento/enums.hpp>
+
+namespace databento_native {
+
+/**
+ * Timestamp a DBN index is keyed on
+ */
+enum class IndexTimestamp : uint8_t {
+    TsEvent = 0,
+    TsRecv = 1
+};
+
+/**
+ * Offset of ts_recv in a record body of the given rtype, or 0 for the schemas without one
+ * (OHLCV, system, error, symbol mapping)
+ */
+inline size_t TsRecvOffset(uint8_t rtype) {
+    switch (static_cast<databento::RType>(rtype)) {
+        case databento::RType::Mbo:
+            return 40;
+        case databento::RType::Mbp0:
+        case databento::RType::Mbp1:
+        case databento::RType::Mbp10:
+        case databento::RType::Cmbp1:
+        case databento::RType::Cbbo1S:
+        case databento::RType::Cbbo1M:
+        case databento::RType::Tcbbo:
+        case databento::RType::Bbo1S:
+        case databento::RType::Bbo1M:
+            return 32;
+        case databento::RType::InstrumentDef:
+        case databento::RType::Imbalance:
+        case databento::RType::Statistics:
+        case databento::RType::Status:
+            return 16;
+        default:
+            return 0;
+    }
+}
+
+/**
+ * Read the index timestamp of a raw DBN record
+ *
+ * Records without a ts_recv fall back to the header's ts_event.
+ */
+inline uint64_t RecordTimestamp(const uint8_t* record, IndexTimestamp field) {
+    size_t offset = 8;  // RecordHeader::ts_event
+    if (field == IndexTimestamp::TsRecv) {
+        if (const size_t recv_offset = TsRecvOffset(record[1])) {
+            offset = recv_offset;
+        }
+    }
+    uint64_t ts;
+    std::memcpy(&ts, record + offset, sizeof(ts));
+    return ts;
+}
+
+/**
+ * Timestamp DBN files are sorted by: ts_recv, or ts_event for records without one
+ */
+inline uint64_t OrderTimestamp(const uint8_t* record, size_t length) {
+    const size_t recv_offset = TsRecvOffset(record[1]);
+    uint64_t ts;
+    std::memcpy(&ts, record + (recv_offset != 0 && recv_offset + sizeof(ts) <= length ? recv_offset : 8),
+                sizeof(ts));
+    return ts;
+}
+
+/**
+ * One checkpoint of a DBN index
+ *
+ * max_ts_before is the largest timestamp of any record before this checkpoint (0 for the
+ * first), which is monotonic even when the file is not strictly sorted, so a time seek can
+ * binary-search the checkpoints and still land on the first qualifying record.
+ */
+struct DbnIndexEntry {
+    uint64_t max_ts_before;
+    uint64_t offset;   // Byte offset of the record (in the decompressed stream for zstd files)
+    uint64_t ordinal;  // Zero-based record number
+};
+
+/**
+ * Sparse timestamp / ordinal index stored as a `.dbnidx` sidecar next to a DBN file
+ *
+ * A checkpoint is taken every `interval` records. For uncompressed files the offsets are
+ * file offsets; for zstd files they are offsets into the decompressed stream, which readers
+ * of seekable zstd files jump to through the frame seek table. Plain zstd streams cannot be
+ * entered mid-stream, so readers decode those forward instead.
+ *
+ * The sidecar records the size and modification time of the file it was built from, and is
+ * ignored when they no longer match.
+ *
+ * File layout (little-endian):
+ *   "DBNIDX" u16 version, u8 timestamp, u8 compressed, u32 interval, u64 source_size,
+ *   i64 source_mtime, u64 record_count, u64 max_ts, u64 entry_count,
+ *   entry_count * (u64 max_ts_before, u64 offset, u64 ordinal)
+ */
+class DbnIndex {
+public:
+    static constexpr char kMagic[6] = {'D', 'B', 'N', 'I', 'D', 'X'};
+    static constexpr uint16_t kVersion = 1;
+    static constexpr uint32_t kDefaultInterval = 4096;
+
+    DbnIndex(IndexTimestamp timestamp, uint32_t interval, bool compressed)
+        : timestamp_(timestamp)
+        , interval_(interval == 0 ? kDefaultInterval : interval)
+        , compressed_(compressed)
+    {}
+
+    static std::filesystem::path SidecarPath(const std::filesystem::path& dbn_path) {
+        std::filesystem::path path = dbn_path;
+        path += ".dbnidx";
+        return path;
+    }
+
+    /**
+     * Feed the next record in file order
+     */
+    void Add(const uint8_t* record, uint64_t offset) {
+        if (record_count_ % interval_ == 0) {
+            entries_.push_back(DbnIndexEntry{max_ts_, offset, record_count_});
+        }
+        max_ts_ = std::max(max_ts_, RecordTimestamp(record, timestamp_));
+        ++record_count_;
+    }
+
+    IndexTimestamp Timestamp() const { return timestamp_; }
+    bool Compressed() const { return compressed_; }
+    uint64_t RecordCount() const { return record_count_; }
+
+    /**
+     * Last checkpoint at or before ordinal, or nullptr if there is none
+     */
+    const DbnIndexEntry* FindOrdinal(uint64_t ordinal) const {
+        auto it = std::upper_bound(entries_.begin(), entries_.end(), ordinal,
+            [](uint64_t value, const DbnIndexEntry& e) { return value < e.ordinal; });
+        return it == entries_.begin() ? nullptr : &*std::prev(it);
+    }
+
+    /**
+     * Last checkpoint before which no record has a timestamp >= ts, or nullptr if there is none
+     */
+    const DbnIndexEntry* FindTime(uint64_t ts) const {
+        auto it = std::lower_bound(entries_.begin(), entries_.end(), ts,
+            [](const DbnIndexEntry& e, uint64_t value) { return e.max_ts_before < value; });
+        return it == entries_.begin() ? nullptr : &*std::prev(it);
+    }
+
+    /**
+     * Write the sidecar atomically (temp file + rename)
+     * @throws std::runtime_error on I/O failure
+     */
+    void Save(const std::filesystem::path& dbn_path) const {
+        std::error_code ec;
+        const uint64_t source_size = std::filesystem::file_size(dbn_path);
+        const int64_t source_mtime = ModificationTime(dbn_path);
+
+        std::string out;
+        out.append(kMagic, sizeof(kMagic));
+        AppendPod(out, kVersion);
+        AppendPod(out, static_cast<uint8_t>(timestamp_));
+        AppendPod(out, static_cast<uint8_t>(compressed_ ? 1 : 0));
+        AppendPod(out, interval_);
+        AppendPod(out, source_size);
+        AppendPod(out, source_mtime);
+        AppendPod(out, record_count_);
+        AppendPod(out, max_ts_);
+        AppendPod(out, static_cast<uint64_t>(entries_.size()));
+        for (const auto& entry : entries_) {
+            AppendPod(out, entry.max_ts_before);
+            AppendPod(out, entry.offset);
+            AppendPod(out, entry.ordinal);
+        }
+
+        const std::filesystem::path path = SidecarPath(dbn_path);
+        std::filesystem::path tmp_path = path;
+        tmp_path += ".tmp";
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            if (!file || !file.write(out.data(), static_cast<std::streamsize>(out.size()))) {
+                throw std::runtime_error("Failed to write DBN index: " + tmp_path.string());
+            }
+        }
+        std::filesystem::rename(tmp_path, path, ec);
+        if (ec) {
+            throw std::runtime_error("Failed to replace DBN index: " + ec.message());
+        }
+    }
+
+    /**
+     * Load the sidecar of dbn_path; a missing, stale or corrupt sidecar yields nullopt
+     */
+    static std::optional<DbnIndex> Load(const std::filesystem::path& dbn_path) {
+        std::ifstream in(SidecarPath(dbn_path), std::ios::binary);
+        if (!in) {
+            return std::nullopt;
+        }
+        std::vector<char> data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        try {
+            Reader reader{data.data(), data.size(), 0};
+            char magic[sizeof(kMagic)];
+            reader.Bytes(magic, sizeof(magic));
+            if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || reader.Pod<uint16_t>() != kVersion) {
+                return std::nullopt;
+            }
+            auto timestamp = static_cast<IndexTimestamp>(reader.Pod<uint8_t>());
+            bool compressed = reader.Pod<uint8_t>() != 0;
+            DbnIndex index{timestamp, reader.Pod<uint32_t>(), compressed};
+
+            const uint64_t source_size = reader.Pod<uint64_t>();
+            const int64_t source_mtime = reader.Pod<int64_t>();
+            if (source_size != std::filesystem::file_size(dbn_path) ||
+                source_mtime != ModificationTime(dbn_path)) {
+                return std::nullopt;
+            }
+
+            index.record_count_ = reader.Pod<uint64_t>();
+            index.max_ts_ = reader.Pod<uint64_t>();
+            const uint64_t entry_count = reader.Pod<uint64_t>();
+            if (entry_count > (data.size() - reader.offset) / (3 * sizeof(uint64_t))) {
+                return std::nullopt;
+            }
+            index.entries_.reserve(static_cast<size_t>(entry_count));
+            for (uint64_t i = 0; i < entry_count; ++i) {
+                DbnIndexEntry entry;
+                entry.max_ts_before = reader.Pod<uint64_t>();
+                entry.offset = reader.Pod<uint64_t>();
+                entry.ordinal = reader.Pod<uint64_t>();
+                index.entries_.push_back(entry);
+            }
+            return index;
+        }
+        catch (const std::exception&) {
+            return std::nullopt;
+        }
+    }
+
+private:
+    struct Reader {
+        const char* data;
+        size_t size;
+        size_t offset;
+
+        void Bytes(void* dest, size_t count) {
+            if (count > size - offset) {
+                throw std::runtime_error("Truncated DBN index");
+            }
+            std::memcpy(dest, data + offset, count);
+            offset += count;
+        }
+
+        template <typename T>
+        T Pod() {
+            T value;
+            Bytes(&value, sizeof(T));
+            return value;
+        }
+    };
+
+    template <typename T>
+    static void AppendPod(std::string& out, T value) {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static int64_t ModificationTime(const std::filesystem::path& path) {
+        return static_cast<int64_t>(std::filesystem::last_write_time(path).time_since_epoch().count());
+    }
+
+    IndexTimestamp timestamp_;
+    uint32_t interval_;
+    bool compressed_;
+    uint64_t record_count_ = 0;
+    uint64_t max_ts_ = 0;
+    std::vector<DbnIndexEntry> entries_;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,271 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "handle_validation.hpp"
+#include "dbn_file_reader.hpp"
+#include "dbn_index.hpp"
+#include <databento/record.hpp>
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace db = databento;
+using databento_native::SafeStrCopy;
+using databento_native::DbnFileReaderWrapper;
+using databento_native::IndexTimestamp;
+
+// ============================================================================
+// DBN Merge Reader Wrapper Structure
+// ============================================================================
+
+/**
+ * K-way merge over several DBN files
+ *
+ * Every input keeps its head record in a min-heap keyed by (timestamp, input index), so
+ * records come out in timestamp order and ties keep the order the files were given in.
+ * Each input uses the reader's fastest mode: memory-mapped, frame-parallel for seekable zstd,
+ * or buffered otherwise, with background read-ahead (a thread and about 3 MiB each) only
+ * for merges of up to kMaxPrefetchedInputs files. Seekable zstd inputs share one decode
+ * pool and keep two frames in flight each, so threads do not grow with the file count.
+ * A delivered record's input is only advanced on the next read, so record views stay
+ * valid until then.
+ */
+struct DbnMergeReaderWrapper {
+    static constexpr size_t kMaxPrefetchedInputs = 8;
+
+    struct HeapEntry {
+        uint64_t ts;
+        uint32_t input;
+        const uint8_t* record;
+    };
+
+    std::vector<std::unique_ptr<DbnFileReaderWrapper>> inputs;
+    IndexTimestamp field;
+    std::vector<HeapEntry> heap;
+    bool has_popped = false;
+    uint32_t popped_input = 0;
+
+    DbnMergeReaderWrapper(const std::vector<std::filesystem::path>& paths, IndexTimestamp ts_field)
+        : field(ts_field) {
+        inputs.reserve(paths.size());
+        std::optional<databento_native::PrefetchOptions> prefetch;
+        if (paths.size() <= kMaxPrefetchedInputs) {
+            prefetch = databento_native::PrefetchOptions{};
+        }
+        auto decode_pool = std::make_shared<databento_native::ThreadPool>(
+            databento_native::ThreadPool::DefaultThreadCount());
+        for (const auto& path : paths) {
+            inputs.push_back(std::make_unique<DbnFileReaderWrapper>(path, true, prefetch, decode_pool));
+        }
+        Prime();
+    }
+
+    /**
+     * Head record of the merge without consuming it, or nullptr once all inputs are exhausted
+     */
+    const uint8_t* Peek(uint32_t* source) {
+        if (has_popped) {
+            has_popped = false;
+            Advance(popped_input);
+        }
+        if (heap.empty()) {
+            return nullptr;
+        }
+        if (source) {
+            *source = heap.front().input;
+        }
+        return heap.front().record;
+    }
+
+    /**
+     * Consume the record returned by the last Peek (its view stays valid until the next Peek)
+     */
+    void Pop() {
+        std::pop_heap(heap.begin(), heap.end(), Later);
+        popped_input = heap.back().input;
+        heap.pop_back();
+        has_popped = true;
+    }
+
+    /**
+     * Position every input at its first record with timestamp >= ts
+     */
+    void SeekTime(uint64_t ts) {
+        for (auto& input : inputs) {
+            input->SeekTime(ts, field);
+        }
+        Prime();
+    }
+
+private:
+    static bool Later(const HeapEntry& a, const HeapEntry& b) {
+        return a.ts != b.ts ? a.ts > b.ts : a.input > b.input;
+    }
+
+    void Prime() {
+        heap.clear();
+        has_popped = false;
+        for (uint32_t i = 0; i < inputs.size(); ++i) {
+            Advance(i);
+        }
+    }
+
+    void Advance(uint32_t input) {
+        const uint8_t* record = inputs[input]->NextRecordView();
+        if (record) {
+            heap.push_back(HeapEntry{databento_native::RecordTimestamp(record, field), input, record});
+            std::push_heap(heap.begin(), heap.end(), Later);
+        }
+    }
+};
+
+// ============================================================================
+// DBN Merge Reader API Implementation
+// ============================================================================
+
+DATABENTO_API DbnMergeReaderHandle dbento_dbn_merge_open(
+    const char** file_paths,
+    size_t file_count,
+    int ts_field,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_paths || file_count == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "At least one file path is required");
+            return nullptr;
+        }
+        if (ts_field != 0 && ts_field != 1) {
+            SafeStrCopy(error_buffer, error_buffer_size, "ts_field must be 0 (ts_event) or 1 (ts_recv)");
+            return nullptr;
+        }
+
+        std::vector<std::filesystem::path> paths;
+        paths.reserve(file_count);
+        for (size_t i = 0; i < file_count; ++i) {
+            if (!file_paths[i]) {
+                SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+                return nullptr;
+            }
+            std::filesystem::path path{file_paths[i]};
+            if (!std::filesystem::exists(path)) {
+                std::string msg = "File does not exist: " + path.string();
+                SafeStrCopy(error_buffer, error_buffer_size, msg.c_str());
+                return nullptr;
+            }
+            paths.push_back(std::move(path));
+        }
+
+        auto wrapper = std::make_unique<DbnMergeReaderWrapper>(paths, static_cast<IndexTimestamp>(ts_field));
+        return reinterpret_cast<DbnMergeReaderHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnMergeReader, wrapper.release()));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_dbn_merge_next_records(
+    DbnMergeReaderHandle handle,
+    uint8_t* buffer,
+    size_t buffer_capacity,
+    size_t* record_offsets,
+    uint32_t* source_indices,
+    size_t max_records,
+    size_t* record_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnMergeReaderWrapper>(
+            handle, databento_native::HandleType::DbnMergeReader, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!buffer || !record_offsets || !record_count || max_records == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        size_t used = 0;
+        size_t count = 0;
+        const uint8_t* record = nullptr;
+        uint32_t source = 0;
+        while (count < max_records && (record = wrapper->Peek(&source)) != nullptr) {
+            const size_t length = reinterpret_cast<const db::RecordHeader*>(record)->Size();
+            if (used + length > buffer_capacity) {
+                break;  // Stays at the head of the merge for the next call
+            }
+            std::memcpy(buffer + used, record, length);
+            record_offsets[count] = used;
+            if (source_indices) {
+                source_indices[count] = source;
+            }
+            ++count;
+            used += length;
+            wrapper->Pop();
+        }
+
+        *record_count = count;
+        if (count > 0) {
+            return 0;
+        }
+        if (record) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Record buffer too small");
+            return -3;
+        }
+        return 1; // EOF
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_merge_seek_time(
+    DbnMergeReaderHandle handle,
+    uint64_t timestamp_ns,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnMergeReaderWrapper>(
+            handle, databento_native::HandleType::DbnMergeReader, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        wrapper->SeekTime(timestamp_ns);
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_dbn_merge_close(DbnMergeReaderHandle handle)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<DbnMergeReaderWrapper>(
+            handle, databento_native::HandleType::DbnMergeReader, nullptr);
+        if (wrapper) {
+            delete wrapper;
+            databento_native::DestroyValidatedHandle(handle);
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
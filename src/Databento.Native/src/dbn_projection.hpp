@@ -0,0 +1,133 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "dbn_fields.hpp"
+#include "dbn_file_reader.hpp"
+
+namespace databento_native {
+
+/**
+ * Copies selected fields of records with one rtype into struct-of-arrays columns
+ *
+ * The field list is resolved once; Project() then walks the reader (in place when it is
+ * memory-mapped) and scatters each matching record's fields into the column buffers.
+ * Used by the projection API, the columnar exporters and the Arrow C Data batch builder.
+ */
+class Projector {
+public:
+    Projector(uint8_t rtype, std::vector<const DbnField*> fields)
+        : rtype_(rtype)
+        , fields_(std::move(fields))
+    {
+        for (const DbnField* field : fields_) {
+            const size_t width = FieldWidth(field->type);
+            widths_.push_back(width);
+            min_length_ = std::max(min_length_, field->offset + width);
+        }
+    }
+
+    /**
+     * Resolve field names for an rtype; an empty list selects every field
+     * @throws std::invalid_argument for an unknown rtype or field
+     */
+    static Projector Create(uint8_t rtype, const std::vector<std::string>& names) {
+        const auto* all = FieldsOf(rtype);
+        if (!all) {
+            throw std::invalid_argument("Unsupported rtype " + std::to_string(rtype));
+        }
+        std::vector<const DbnField*> fields;
+        if (names.empty()) {
+            for (const auto& field : *all) {
+                fields.push_back(&field);
+            }
+        }
+        for (const auto& name : names) {
+            const DbnField* field = FindField(rtype, name);
+            if (!field) {
+                throw std::invalid_argument("Unknown field '" + name + "' for rtype " + std::to_string(rtype));
+            }
+            fields.push_back(field);
+        }
+        return Projector{rtype, std::move(fields)};
+    }
+
+    uint8_t RType() const { return rtype_; }
+    const std::vector<const DbnField*>& Fields() const { return fields_; }
+    size_t Width(size_t column) const { return widths_[column]; }
+
+    /**
+     * Project up to max_rows rows starting at row offset first_row of the output columns
+     * (columns[i] must hold first_row + max_rows elements of field i)
+     * @return Rows written; fewer than max_rows only at end of file
+     */
+    size_t Project(DbnFileReaderWrapper& reader, uint8_t* const* columns, size_t first_row, size_t max_rows) const {
+        size_t rows = 0;
+        while (rows < max_rows) {
+            const uint8_t* record = reader.NextRecordView();
+            if (!record) {
+                break;
+            }
+            rows += ProjectRecord(record, columns, first_row + rows) ? 1 : 0;
+        }
+        return rows;
+    }
+
+    /**
+     * Copy the fields of one record into row `row` of the columns
+     * @return false (nothing written) if the record has another rtype
+     */
+    bool ProjectRecord(const uint8_t* record, uint8_t* const* columns, size_t row) const {
+        if (record[1] != rtype_) {
+            return false;
+        }
+        if (static_cast<size_t>(record[0]) * databento::RecordHeader::kLengthMultiplier < min_length_) {
+            throw std::runtime_error("Record too short for the projected fields");
+        }
+        for (size_t c = 0; c < fields_.size(); ++c) {
+            const uint8_t* src = record + fields_[c]->offset;
+            switch (widths_[c]) {
+                case 1:
+                    columns[c][row] = *src;
+                    break;
+                case 2:
+                    std::memcpy(columns[c] + row * 2, src, 2);
+                    break;
+                case 4:
+                    std::memcpy(columns[c] + row * 4, src, 4);
+                    break;
+                default:
+                    std::memcpy(columns[c] + row * 8, src, 8);
+                    break;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * rtype of the first projectable record of the reader, which is left unconsumed
+     * (system, error and symbol mapping records before it are skipped); -1 for an empty file
+     */
+    static int DetectRType(DbnFileReaderWrapper& reader) {
+        while (const uint8_t* record = reader.NextRecordView()) {
+            if (FieldsOf(record[1])) {
+                reader.Unread(record);
+                return record[1];
+            }
+        }
+        return -1;
+    }
+
+private:
+    uint8_t rtype_;
+    std::vector<const DbnField*> fields_;
+    std::vector<size_t> widths_;
+    size_t min_length_ = 0;
+};
+
+}  // namespace databento_native
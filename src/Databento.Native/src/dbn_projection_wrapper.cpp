@@ -0,0 +1,85 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "handle_validation.hpp"
+#include "dbn_file_reader.hpp"
+#include "dbn_fields.hpp"
+#include "dbn_projection.hpp"
+#include <optional>
+#include <string>
+#include <vector>
+
+using databento_native::SafeStrCopy;
+using databento_native::DbnField;
+using databento_native::DbnFileReaderWrapper;
+using databento_native::Projector;
+
+// ============================================================================
+// DBN Columnar Projection API Implementation
+// ============================================================================
+
+DATABENTO_API int dbento_dbn_field_type(uint8_t rtype, const char* field_name)
+{
+    if (!field_name) {
+        return -1;
+    }
+    const DbnField* field = databento_native::FindField(rtype, field_name);
+    return field ? static_cast<int>(field->type) : -1;
+}
+
+DATABENTO_API int dbento_dbn_file_project(
+    DbnFileReaderHandle handle,
+    uint8_t rtype,
+    const char** field_names,
+    size_t field_count,
+    void** out_columns,
+    size_t max_rows,
+    size_t* row_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<DbnFileReaderWrapper>(
+            handle, databento_native::HandleType::DbnFileReader, &validation_error);
+        if (!wrapper) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!field_names || field_count == 0 || !out_columns || !row_count || max_rows == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        // Resolve the field list once per call
+        std::vector<std::string> names;
+        names.reserve(field_count);
+        for (size_t i = 0; i < field_count; ++i) {
+            if (!field_names[i] || !out_columns[i]) {
+                SafeStrCopy(error_buffer, error_buffer_size, "Field name and output column cannot be null");
+                return -2;
+            }
+            names.emplace_back(field_names[i]);
+        }
+        std::optional<Projector> projector;
+        try {
+            projector.emplace(Projector::Create(rtype, names));
+        }
+        catch (const std::invalid_argument& e) {
+            SafeStrCopy(error_buffer, error_buffer_size, e.what());
+            return -2;
+        }
+
+        // Walk the records (in place when the file is mapped) and scatter the selected
+        // fields into the output columns; records of other rtypes are skipped
+        const size_t rows = projector->Project(*wrapper, reinterpret_cast<uint8_t* const*>(out_columns), 0, max_rows);
+
+        *row_count = rows;
+        return rows > 0 ? 0 : 1;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
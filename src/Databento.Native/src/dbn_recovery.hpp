@@ -0,0 +1,339 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+#include <zstd.h>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include "buffered_file_writer.hpp"
+#include "dbn_index.hpp"
+#include "mapped_file.hpp"
+#include "seekable_zstd.hpp"
+
+namespace databento_native {
+
+/**
+ * Crash-safe checkpoints and tail recovery for DBN files
+ *
+ * While checkpointing, the writer periodically syncs the file to the device and records the
+ * synced length in a `<file>.ckpt` sidecar, which a clean close removes. After an unclean
+ * shutdown, RecoverDbnFile cuts the file back to its last whole record (whole frame for
+ * seekable zstd, which also gets its seek table back) and patches the metadata end time so
+ * readers see a well-formed file. The sidecar lets recovery tell a torn tail, which is
+ * expected, from damage before the last checkpoint, which is not.
+ */
+
+// Offset of Metadata::end in the encoded metadata
+constexpr size_t kMetadataEndOffset = 34;
+constexpr uint64_t kUndefTimestamp = std::numeric_limits<uint64_t>::max();
+
+struct DbnWriteCheckpoint {
+    uint64_t offset = 0;   // File length known to be on the device
+    uint64_t records = 0;  // Records before offset
+    uint64_t last_ts = 0;  // Largest ts_recv (else ts_event) of those records, 0 if none
+    bool compressed = false;
+};
+
+struct DbnRecoveryResult {
+    uint64_t records = 0;          // Whole records kept
+    uint64_t bytes_truncated = 0;  // Torn tail removed
+    bool end_patched = false;      // Metadata end time was set from the records
+};
+
+inline std::filesystem::path CheckpointPath(const std::filesystem::path& path) {
+    std::filesystem::path sidecar = path;
+    sidecar += ".ckpt";
+    return sidecar;
+}
+
+/**
+ * Replace the sidecar of path; written aside and renamed over so it is never torn
+ */
+inline void WriteCheckpoint(const std::filesystem::path& path, const DbnWriteCheckpoint& checkpoint) {
+    const std::filesystem::path sidecar = CheckpointPath(path);
+    std::filesystem::path temp = sidecar;
+    temp += ".tmp";
+    {
+        const nlohmann::json json{
+            {"offset", checkpoint.offset},
+            {"records", checkpoint.records},
+            {"last_ts", checkpoint.last_ts},
+            {"compressed", checkpoint.compressed}
+        };
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        out << json.dump();
+        out.close();
+        if (!out) {
+            throw std::runtime_error("Failed to write checkpoint " + temp.string());
+        }
+    }
+    // Both the contents and the rename must survive a host crash, or recovery would find
+    // an empty or missing sidecar and skip its damage check
+    SyncFileToDisk(temp);
+    std::filesystem::rename(temp, sidecar);
+    SyncDirectoryToDisk(sidecar.parent_path());
+}
+
+inline std::optional<DbnWriteCheckpoint> ReadCheckpoint(const std::filesystem::path& path) {
+    std::ifstream in(CheckpointPath(path), std::ios::binary);
+    if (!in) {
+        return std::nullopt;
+    }
+    const nlohmann::json json = nlohmann::json::parse(in, nullptr, false);
+    if (json.is_discarded() || !json.is_object()) {
+        return std::nullopt;
+    }
+    DbnWriteCheckpoint checkpoint;
+    checkpoint.offset = json.value("offset", uint64_t{0});
+    checkpoint.records = json.value("records", uint64_t{0});
+    checkpoint.last_ts = json.value("last_ts", uint64_t{0});
+    checkpoint.compressed = json.value("compressed", false);
+    return checkpoint;
+}
+
+inline void RemoveCheckpoint(const std::filesystem::path& path) {
+    std::error_code ec;
+    std::filesystem::remove(CheckpointPath(path), ec);
+}
+
+namespace detail {
+
+/**
+ * Walks decoded DBN bytes (metadata, then records) that may arrive in pieces
+ */
+class RecoveryScanner {
+public:
+    /**
+     * Consume the next bytes; stops at the first record with an impossible length
+     * @return False once the data stops making sense
+     */
+    bool Consume(const uint8_t* data, size_t size) {
+        pending_.insert(pending_.end(), data, data + size);
+        size_t offset = 0;
+        if (!metadata_length_) {
+            if (pending_.size() < 8) {
+                return true;
+            }
+            if (std::memcmp(pending_.data(), "DBN", 3) != 0) {
+                throw std::runtime_error("Not a DBN file");
+            }
+            const size_t length = 8 + ReadLe32(pending_.data() + 4);
+            if (pending_.size() < length) {
+                return true;
+            }
+            if (length >= kMetadataEndOffset + sizeof(uint64_t)) {
+                std::memcpy(&metadata_end_, pending_.data() + kMetadataEndOffset, sizeof(metadata_end_));
+            }
+            metadata_length_ = length;
+            offset = length;
+        }
+        bool valid = true;
+        while (pending_.size() - offset > 0) {
+            const size_t record_length = static_cast<size_t>(pending_[offset]) * databento::RecordHeader::kLengthMultiplier;
+            if (record_length < sizeof(databento::RecordHeader)) {
+                valid = false;
+                break;
+            }
+            if (record_length > pending_.size() - offset) {
+                break;  // Continues in the next piece, or is the torn tail
+            }
+            const uint64_t ts = OrderTimestamp(pending_.data() + offset, record_length);
+            if (ts != kUndefTimestamp) {
+                max_ts_ = std::max(max_ts_, ts);
+                has_ts_ = true;
+            }
+            ++records_;
+            offset += record_length;
+        }
+        consumed_ += offset;
+        pending_.erase(pending_.begin(), pending_.begin() + static_cast<std::ptrdiff_t>(offset));
+        return valid;
+    }
+
+    bool HasMetadata() const { return metadata_length_.has_value(); }
+    // Bytes up to the end of the last whole record
+    uint64_t Consumed() const { return consumed_; }
+    uint64_t Records() const { return records_; }
+
+    // End time the records call for, if the metadata's is unset or too early
+    std::optional<uint64_t> PatchedEnd() const {
+        if (!has_ts_) {
+            return std::nullopt;
+        }
+        if (metadata_end_ != kUndefTimestamp && metadata_end_ > max_ts_) {
+            return std::nullopt;
+        }
+        return max_ts_ + 1;
+    }
+
+private:
+    std::vector<uint8_t> pending_;
+    std::optional<size_t> metadata_length_;
+    uint64_t metadata_end_ = kUndefTimestamp;
+    uint64_t consumed_ = 0;
+    uint64_t records_ = 0;
+    uint64_t max_ts_ = 0;
+    bool has_ts_ = false;
+};
+
+inline void PatchMetadataEnd(const std::filesystem::path& path, uint64_t metadata_offset, uint64_t end) {
+    std::fstream patch(path, std::ios::in | std::ios::out | std::ios::binary);
+    patch.seekp(static_cast<std::streamoff>(metadata_offset + kMetadataEndOffset));
+    patch.write(reinterpret_cast<const char*>(&end), sizeof(end));
+    patch.close();
+    if (!patch) {
+        throw std::runtime_error("Failed to update metadata of " + path.string());
+    }
+}
+
+inline void CheckAgainstCheckpoint(const std::filesystem::path& path, const RecoveryScanner& scanner,
+                                   uint64_t checkpointed_records) {
+    if (!scanner.HasMetadata()) {
+        throw std::runtime_error("DBN metadata is incomplete; " + path.string() + " cannot be recovered");
+    }
+    if (scanner.Records() < checkpointed_records) {
+        throw std::runtime_error("Only " + std::to_string(scanner.Records()) + " records of " + path.string() +
+                                 " are intact but " + std::to_string(checkpointed_records) +
+                                 " were checkpointed; the file is damaged before its tail");
+    }
+}
+
+inline DbnRecoveryResult RecoverPlain(const std::filesystem::path& path, uint64_t checkpointed_records) {
+    RecoveryScanner scanner;
+    uint64_t size;
+    {
+        MappedFile file(path);
+        size = file.Size();
+        scanner.Consume(file.Data(), file.Size());
+    }
+    CheckAgainstCheckpoint(path, scanner, checkpointed_records);
+
+    DbnRecoveryResult result;
+    result.records = scanner.Records();
+    const uint64_t good_end = scanner.Consumed();
+    if (good_end < size) {
+        std::filesystem::resize_file(path, good_end);
+        result.bytes_truncated = size - good_end;
+    }
+    if (const auto end = scanner.PatchedEnd()) {
+        PatchMetadataEnd(path, 0, *end);
+        result.end_patched = true;
+    }
+    return result;
+}
+
+inline DbnRecoveryResult RecoverSeekable(const std::filesystem::path& path, uint64_t checkpointed_records) {
+    RecoveryScanner scanner;
+    std::vector<std::pair<uint32_t, uint32_t>> frames;
+    std::optional<uint64_t> metadata_offset;
+    uint64_t size;
+    uint64_t good_end = 0;
+    bool intact = false;
+    {
+        MappedFile file(path);
+        const uint8_t* data = file.Data();
+        size = file.Size();
+        const bool has_table = ParseSeekTable(data, size).has_value();
+        std::vector<uint8_t> decoded;
+        uint64_t pos = 0;
+        while (pos < size) {
+            const size_t frame_size = ZSTD_findFrameCompressedSize(data + pos, size - pos);
+            if (ZSTD_isError(frame_size)) {
+                break;
+            }
+            if ((ReadLe32(data + pos) & 0xFFFFFFF0U) == 0x184D2A50U) {
+                // The seek table of a cleanly finished file; no other skippable frames are written
+                intact = has_table && pos + frame_size == size;
+                break;
+            }
+            const unsigned long long content_size = ZSTD_getFrameContentSize(data + pos, frame_size);
+            if (content_size == ZSTD_CONTENTSIZE_ERROR || content_size == ZSTD_CONTENTSIZE_UNKNOWN ||
+                content_size > kMaxSeekableFrameSize) {
+                break;
+            }
+            decoded.resize(static_cast<size_t>(content_size));
+            const size_t decoded_size = ZSTD_decompress(decoded.data(), decoded.size(), data + pos, frame_size);
+            if (ZSTD_isError(decoded_size) || decoded_size != content_size) {
+                break;  // Torn or corrupt (the writer checksums every compressed frame)
+            }
+            if (pos == 0 && frame_size >= 12 + kMetadataEndOffset + sizeof(uint64_t) && data[4] == 0xA0 &&
+                (data[9] & 0x06) == 0 && std::memcmp(data + 12, decoded.data(), std::min<size_t>(decoded_size, 16)) == 0) {
+                metadata_offset = 12;  // Metadata stored uncompressed (see WriteStoredFrame)
+            }
+            if (!scanner.Consume(decoded.data(), decoded_size)) {
+                break;
+            }
+            frames.emplace_back(static_cast<uint32_t>(frame_size), static_cast<uint32_t>(decoded_size));
+            pos += frame_size;
+            good_end = pos;
+        }
+    }
+    CheckAgainstCheckpoint(path, scanner, checkpointed_records);
+
+    DbnRecoveryResult result;
+    result.records = scanner.Records();
+    if (intact) {
+        return result;
+    }
+
+    if (good_end < size) {
+        std::filesystem::resize_file(path, good_end);
+        result.bytes_truncated = size - good_end;
+    }
+    {
+        std::string table;
+        AppendSeekTable(table, frames);
+        std::ofstream out(path, std::ios::binary | std::ios::app);
+        out.write(table.data(), static_cast<std::streamsize>(table.size()));
+        out.close();
+        if (!out) {
+            throw std::runtime_error("Failed to write seek table of " + path.string());
+        }
+    }
+    if (const auto end = scanner.PatchedEnd(); end && metadata_offset) {
+        PatchMetadataEnd(path, *metadata_offset, *end);
+        result.end_patched = true;
+    }
+    return result;
+}
+
+}  // namespace detail
+
+/**
+ * Repair a DBN file (plain or seekable zstd) left by an unclean shutdown
+ *
+ * Cuts off a torn trailing record or frame, restores the seek table of zstd output and sets
+ * the metadata end time to the last record's timestamp + 1 if it is unset or too early (for
+ * zstd, only when the metadata was written uncompressed, as DbnFileWriter does). Throws if
+ * the file is damaged before the last checkpoint recorded in its sidecar, which is removed
+ * once the file is repaired.
+ */
+inline DbnRecoveryResult RecoverDbnFile(const std::filesystem::path& path) {
+    uint8_t magic[4] = {};
+    {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Failed to open file: " + path.string());
+        }
+        in.read(reinterpret_cast<char*>(magic), sizeof(magic));
+    }
+    const auto checkpoint = ReadCheckpoint(path);
+    const uint64_t checkpointed_records = checkpoint ? checkpoint->records : 0;
+    const DbnRecoveryResult result = ReadLe32(magic) == kZstdFrameMagic
+        ? detail::RecoverSeekable(path, checkpointed_records)
+        : detail::RecoverPlain(path, checkpointed_records);
+    RemoveCheckpoint(path);
+    return result;
+}
+
+}  // namespace databento_native
@@ -0,0 +1,310 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <databento/dbn.hpp>
+#include <databento/dbn_encoder.hpp>
+#include <databento/iwritable.hpp>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include "buffered_file_writer.hpp"
+#include "dbn_index.hpp"
+#include "seekable_zstd.hpp"
+
+namespace databento_native {
+
+struct RollingWriterConfig {
+    std::filesystem::path output_dir;
+    std::string file_prefix;
+    std::filesystem::path manifest_path;
+    uint64_t rotate_interval_ns = 0;  // 0 = no time-based rotation
+    uint64_t rotate_offset_ns = 0;    // Boundaries fall at offset + k * interval (UTC)
+    uint64_t max_file_bytes = 0;      // 0 = no size-based rotation
+    bool compressed = false;
+    int compression_level = 3;
+    size_t frame_size = 0;
+    size_t worker_threads = 0;
+};
+
+/**
+ * DBN writer that rolls over to a new file on time boundaries and at a size limit
+ *
+ * Records are assigned to files in the order they are written, so nothing is dropped or
+ * reordered at a boundary. Time boundaries are taken from the records' ts_recv (ts_event
+ * for records without one), the order live data arrives in. Files are opened on their first
+ * record; each starts with the current metadata, whose start/end are patched once the file
+ * is complete: a file ended by a time boundary ends at that boundary, any other at its last
+ * timestamp + 1, and a file continuing the same window starts where the previous one ended.
+ * Completed files are appended to a JSON-lines manifest.
+ */
+class DbnRollingWriter {
+public:
+    DbnRollingWriter(RollingWriterConfig config, databento::Metadata metadata)
+        : config_(std::move(config))
+        , metadata_(std::move(metadata))
+    {
+        std::filesystem::create_directories(config_.output_dir);
+        if (config_.manifest_path.empty()) {
+            config_.manifest_path = config_.output_dir / (config_.file_prefix + ".manifest.jsonl");
+        }
+    }
+
+    ~DbnRollingWriter() {
+        try {
+            CloseFile(false);
+        }
+        catch (...) {
+            // Destructors must not throw; call Finish() explicitly to observe errors
+        }
+    }
+
+    DbnRollingWriter(const DbnRollingWriter&) = delete;
+    DbnRollingWriter& operator=(const DbnRollingWriter&) = delete;
+
+    /**
+     * Write records laid out back to back; all lengths are checked before anything is written
+     * @return Number of records written
+     */
+    size_t WriteRecords(const uint8_t* records, size_t length) {
+        size_t count = 0;
+        for (size_t offset = 0; offset < length; ++count) {
+            const size_t record_length = static_cast<size_t>(records[offset]) * databento::RecordHeader::kLengthMultiplier;
+            if (record_length < sizeof(databento::RecordHeader) || record_length > length - offset) {
+                throw std::runtime_error("Truncated or corrupt DBN record at byte offset " + std::to_string(offset));
+            }
+            offset += record_length;
+        }
+        for (size_t offset = 0; offset < length;) {
+            const size_t record_length = static_cast<size_t>(records[offset]) * databento::RecordHeader::kLengthMultiplier;
+            WriteRecord(records + offset, record_length);
+            offset += record_length;
+        }
+        return count;
+    }
+
+    /**
+     * Close the current file now (e.g. at session end); the next record starts a new one
+     */
+    void Rotate() {
+        CloseFile(false);
+    }
+
+    /**
+     * Metadata (dataset, schema, symbols, ...) for files opened from now on
+     */
+    void SetMetadata(databento::Metadata metadata) {
+        metadata_ = std::move(metadata);
+    }
+
+    /**
+     * Hand the current file's records to the OS
+     */
+    void Flush() {
+        if (file_) {
+            if (file_->zstd) {
+                file_->zstd->Flush();
+            } else {
+                file_->plain->Flush();
+            }
+        }
+    }
+
+    /**
+     * Close the current file and record it in the manifest
+     */
+    void Finish() {
+        CloseFile(false);
+    }
+
+    const std::filesystem::path& ManifestPath() const { return config_.manifest_path; }
+
+    // Path of the file being written, or empty between files
+    std::filesystem::path CurrentPath() const {
+        return file_ ? file_->path : std::filesystem::path{};
+    }
+
+private:
+    static constexpr uint64_t kNoTimestamp = std::numeric_limits<uint64_t>::max();
+    // Offset of Metadata::start in the encoded metadata (end follows it)
+    static constexpr size_t kMetadataStartOffset = 26;
+
+    struct RollingFile {
+        std::filesystem::path path;
+        std::unique_ptr<BufferedFileWriter> plain;
+        std::unique_ptr<SeekableZstdWriter> zstd;
+        uint64_t metadata_offset = 0;
+        uint64_t start = 0;
+        uint64_t window_end = kNoTimestamp;
+        uint64_t first_ts = kNoTimestamp;
+        uint64_t last_ts = 0;
+        uint64_t records = 0;
+        uint64_t bytes = 0;
+    };
+
+    uint64_t WindowEnd(uint64_t ts) const {
+        const uint64_t interval = config_.rotate_interval_ns;
+        if (interval == 0 || ts == kNoTimestamp) {
+            return kNoTimestamp;
+        }
+        const uint64_t offset = config_.rotate_offset_ns % interval;
+        if (ts < offset) {
+            return offset;
+        }
+        return offset + ((ts - offset) / interval + 1) * interval;
+    }
+
+    void WriteRecord(const uint8_t* record, size_t length) {
+        const uint64_t ts = OrderTimestamp(record, length);
+        if (file_) {
+            if (ts != kNoTimestamp && ts >= file_->window_end) {
+                CloseFile(true);
+            } else if (config_.max_file_bytes > 0 && file_->records > 0 &&
+                       file_->bytes + length > config_.max_file_bytes) {
+                CloseFile(false);
+            }
+        }
+        if (!file_) {
+            Open(ts);
+        }
+
+        const auto* bytes = reinterpret_cast<const std::byte*>(record);
+        if (file_->zstd) {
+            file_->zstd->WriteAll(bytes, length);
+            file_->zstd->RecordBoundary();
+        } else {
+            file_->plain->WriteAll(bytes, length);
+        }
+        ++file_->records;
+        file_->bytes += length;
+        if (ts != kNoTimestamp) {
+            file_->first_ts = std::min(file_->first_ts, ts);
+            file_->last_ts = std::max(file_->last_ts, ts);
+        }
+    }
+
+    void Open(uint64_t ts) {
+        auto file = std::make_unique<RollingFile>();
+        file->window_end = WindowEnd(ts);
+        if (continue_from_ != kNoTimestamp && (config_.rotate_interval_ns == 0 || file->window_end == continue_window_)) {
+            file->start = continue_from_;  // Same window as the previous file: carry on from its end
+        } else if (file->window_end != kNoTimestamp) {
+            file->start = file->window_end >= config_.rotate_interval_ns
+                ? file->window_end - config_.rotate_interval_ns : 0;
+        } else {
+            file->start = ts == kNoTimestamp ? 0 : ts;
+        }
+        file->path = NextPath(file->start);
+
+        databento::Metadata metadata = metadata_;
+        metadata.start = databento::UnixNanos{std::chrono::duration<uint64_t, std::nano>{file->start}};
+        metadata.end = databento::UnixNanos{std::chrono::duration<uint64_t, std::nano>{kNoTimestamp}};
+        metadata.limit = 0;
+        StringWritable encoded;
+        databento::DbnEncoder::EncodeMetadata(metadata, &encoded);
+
+        const auto* bytes = reinterpret_cast<const std::byte*>(encoded.data.data());
+        if (config_.compressed) {
+            file->zstd = std::make_unique<SeekableZstdWriter>(
+                file->path, config_.compression_level, config_.frame_size, config_.worker_threads);
+            // Stored uncompressed so start/end can be patched when the file is complete
+            file->metadata_offset = file->zstd->WriteStoredFrame(bytes, encoded.data.size());
+        } else {
+            file->plain = std::make_unique<BufferedFileWriter>(file->path);
+            file->plain->WriteAll(bytes, encoded.data.size());
+        }
+        file_ = std::move(file);
+    }
+
+    // <prefix>-YYYYMMDDTHHMMSSZ-NNN.dbn[.zst], numbered past any existing file
+    std::filesystem::path NextPath(uint64_t start) const {
+        const std::time_t seconds = static_cast<std::time_t>(start / 1000000000ULL);
+        std::tm utc{};
+#ifdef _WIN32
+        gmtime_s(&utc, &seconds);
+#else
+        gmtime_r(&seconds, &utc);
+#endif
+        char stamp[32];
+        std::strftime(stamp, sizeof(stamp), "%Y%m%dT%H%M%SZ", &utc);
+        const char* extension = config_.compressed ? ".dbn.zst" : ".dbn";
+        for (unsigned sequence = 0;; ++sequence) {
+            char suffix[16];
+            std::snprintf(suffix, sizeof(suffix), "-%03u", sequence);
+            std::filesystem::path path = config_.output_dir / (config_.file_prefix + "-" + stamp + suffix + extension);
+            if (!std::filesystem::exists(path)) {
+                return path;
+            }
+        }
+    }
+
+    /**
+     * Complete the current file: close it, patch its metadata range and add it to the manifest
+     * @param at_boundary True if a record past the file's time window ended it
+     */
+    void CloseFile(bool at_boundary) {
+        if (!file_) {
+            return;
+        }
+        std::unique_ptr<RollingFile> file = std::move(file_);
+        const uint64_t end = at_boundary ? file->window_end
+                                         : std::max(file->start, file->first_ts == kNoTimestamp ? file->start
+                                                                                                : file->last_ts + 1);
+        if (file->zstd) {
+            file->zstd->Finish();
+        } else {
+            file->plain->Close();
+        }
+
+        {
+            std::fstream patch(file->path, std::ios::in | std::ios::out | std::ios::binary);
+            const uint64_t range[2] = {file->start, end};
+            patch.seekp(static_cast<std::streamoff>(file->metadata_offset + kMetadataStartOffset));
+            patch.write(reinterpret_cast<const char*>(range), sizeof(range));
+            patch.close();
+            if (!patch) {
+                throw std::runtime_error("Failed to update metadata of " + file->path.string());
+            }
+        }
+
+        continue_from_ = at_boundary ? kNoTimestamp : end;
+        continue_window_ = file->window_end;
+
+        const nlohmann::json entry{
+            {"path", file->path.filename().string()},
+            {"start", file->start},
+            {"end", end},
+            {"first_ts", file->first_ts == kNoTimestamp ? nlohmann::json(nullptr) : nlohmann::json(file->first_ts)},
+            {"last_ts", file->first_ts == kNoTimestamp ? nlohmann::json(nullptr) : nlohmann::json(file->last_ts)},
+            {"record_count", file->records},
+            {"record_bytes", file->bytes},
+            {"file_size", std::filesystem::file_size(file->path)},
+            {"compressed", static_cast<bool>(file->zstd)}
+        };
+        std::ofstream manifest(config_.manifest_path, std::ios::binary | std::ios::app);
+        manifest << entry.dump() << '\n';
+        manifest.close();
+        if (!manifest) {
+            throw std::runtime_error("Failed to append to manifest " + config_.manifest_path.string());
+        }
+    }
+
+    RollingWriterConfig config_;
+    databento::Metadata metadata_;
+    std::unique_ptr<RollingFile> file_;
+    // End of the last file closed other than at a time boundary, and its window
+    uint64_t continue_from_ = kNoTimestamp;
+    uint64_t continue_window_ = kNoTimestamp;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,232 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_rolling_writer.hpp"
+#include "handle_validation.hpp"
+#include "metadata_json.hpp"
+#include <cstring>
+#include <string>
+
+using databento_native::SafeStrCopy;
+using databento_native::DbnRollingWriter;
+using databento_native::ParseMetadataFromJson;
+using databento_native::RollingWriterConfig;
+
+namespace {
+
+DbnRollingWriter* GetWriter(DbnRollingWriterHandle handle, char* error_buffer, size_t error_buffer_size) {
+    databento_native::ValidationError validation_error;
+    auto* writer = databento_native::ValidateAndCast<DbnRollingWriter>(
+        handle, databento_native::HandleType::DbnRollingWriter, &validation_error);
+    if (!writer) {
+        SafeStrCopy(error_buffer, error_buffer_size, databento_native::GetValidationErrorMessage(validation_error));
+    }
+    return writer;
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Rolling Writer API Implementation
+// ============================================================================
+
+DATABENTO_API DbnRollingWriterHandle dbento_dbn_rolling_writer_create(
+    const char* output_dir,
+    const char* file_prefix,
+    const char* metadata_json,
+    uint64_t rotate_interval_ns,
+    uint64_t rotate_offset_ns,
+    uint64_t max_file_bytes,
+    int compress,
+    int compression_level,
+    size_t frame_size,
+    int worker_threads,
+    const char* manifest_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!output_dir || !file_prefix || !metadata_json || worker_threads < 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return nullptr;
+        }
+
+        RollingWriterConfig config;
+        config.output_dir = output_dir;
+        config.file_prefix = file_prefix;
+        if (manifest_path) {
+            config.manifest_path = manifest_path;
+        }
+        config.rotate_interval_ns = rotate_interval_ns;
+        config.rotate_offset_ns = rotate_offset_ns;
+        config.max_file_bytes = max_file_bytes;
+        config.compressed = compress != 0;
+        config.compression_level = compression_level;
+        config.frame_size = frame_size;
+        config.worker_threads = static_cast<size_t>(worker_threads);
+
+        auto* writer = new DbnRollingWriter(std::move(config), ParseMetadataFromJson(metadata_json));
+        return reinterpret_cast<DbnRollingWriterHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::DbnRollingWriter, writer));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
+DATABENTO_API int dbento_dbn_rolling_writer_write_records(
+    DbnRollingWriterHandle handle,
+    const uint8_t* records,
+    size_t length,
+    size_t* records_written,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* writer = GetWriter(handle, error_buffer, error_buffer_size);
+        if (!writer) {
+            return -1;
+        }
+        if (!records && length > 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid record data");
+            return -1;
+        }
+
+        const size_t count = length > 0 ? writer->WriteRecords(records, length) : 0;
+        if (records_written) {
+            *records_written = count;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_rolling_writer_rotate(
+    DbnRollingWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* writer = GetWriter(handle, error_buffer, error_buffer_size);
+        if (!writer) {
+            return -1;
+        }
+        writer->Rotate();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_rolling_writer_set_metadata(
+    DbnRollingWriterHandle handle,
+    const char* metadata_json,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* writer = GetWriter(handle, error_buffer, error_buffer_size);
+        if (!writer) {
+            return -1;
+        }
+        if (!metadata_json) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Metadata cannot be null");
+            return -2;
+        }
+        writer->SetMetadata(ParseMetadataFromJson(metadata_json));
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_rolling_writer_flush(
+    DbnRollingWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* writer = GetWriter(handle, error_buffer, error_buffer_size);
+        if (!writer) {
+            return -1;
+        }
+        writer->Flush();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_rolling_writer_current_path(
+    DbnRollingWriterHandle handle,
+    char* path_buffer,
+    size_t path_buffer_size,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* writer = GetWriter(handle, error_buffer, error_buffer_size);
+        if (!writer) {
+            return -1;
+        }
+        if (!path_buffer || path_buffer_size == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+        const std::string path = writer->CurrentPath().string();
+        if (path.size() >= path_buffer_size) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Path buffer too small");
+            return -3;
+        }
+        SafeStrCopy(path_buffer, path_buffer_size, path.c_str());
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API int dbento_dbn_rolling_writer_finish(
+    DbnRollingWriterHandle handle,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        auto* writer = GetWriter(handle, error_buffer, error_buffer_size);
+        if (!writer) {
+            return -1;
+        }
+        writer->Finish();
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_dbn_rolling_writer_destroy(DbnRollingWriterHandle handle)
+{
+    try {
+        auto* writer = databento_native::ValidateAndCast<DbnRollingWriter>(
+            handle, databento_native::HandleType::DbnRollingWriter, nullptr);
+        if (writer) {
+            // Completes the current file (metadata range and manifest entry)
+            delete writer;
+            databento_native::DestroyValidatedHandle(handle);
+        }
+    }
+    catch (...) {
+        // Swallow exceptions in cleanup
+    }
+}
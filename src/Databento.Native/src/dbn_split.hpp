@@ -0,0 +1,361 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <vector>
+#include <databento/dbn.hpp>
+#include <databento/dbn_encoder.hpp>
+#include <databento/enums.hpp>
+#include <databento/record.hpp>
+#include "buffered_file_writer.hpp"
+#include "dbn_file_reader.hpp"
+#include "dbn_index.hpp"
+#include "seekable_zstd.hpp"
+#include "thread_pool.hpp"
+
+namespace databento_native {
+
+/**
+ * One-pass DBN splitter
+ *
+ * Reads a DBN file once (in place, or frame-parallel for seekable zstd) and partitions its
+ * records by instrument_id, publisher_id or UTC hour (of ts_recv, else ts_event). Records
+ * are gathered per output and written in batches on a worker pool; the batches of one
+ * output are chained so its records keep their input order. An output's file is open only
+ * while a batch is appended to it (zstd outputs keep their seek table entries in memory),
+ * so splitting into thousands of files needs neither thousands of descriptors nor a
+ * writer per file. Each output carries the input
+ * metadata narrowed to its partition: per-instrument files keep only that instrument's
+ * symbol mappings and symbols, per-hour files cover only their hour and the mappings of
+ * that day.
+ */
+enum class SplitKey : int {
+    InstrumentId = 0,
+    PublisherId = 1,
+    Hour = 2
+};
+
+struct DbnSplitResult {
+    uint64_t records = 0;
+    uint64_t files = 0;
+};
+
+namespace detail {
+
+constexpr uint64_t kNanosPerHour = 3600ULL * 1000000000ULL;
+constexpr uint64_t kNanosPerDay = 24 * kNanosPerHour;
+// Records appended to an output at once (one zstd frame for compressed outputs)
+constexpr size_t kSplitBatchBytes = 256 * 1024;
+// Records held for all outputs; past it the largest pending batches are handed to the
+// workers until half of it is left
+constexpr size_t kSplitBufferBudget = 64 * 1024 * 1024;
+
+inline uint64_t SplitPartition(const uint8_t* record, size_t length, SplitKey key) {
+    const auto& header = *reinterpret_cast<const databento::RecordHeader*>(record);
+    switch (key) {
+        case SplitKey::InstrumentId:
+            return header.instrument_id;
+        case SplitKey::PublisherId:
+            return header.publisher_id;
+        case SplitKey::Hour: {
+            const uint64_t ts = OrderTimestamp(record, length);
+            if (ts == std::numeric_limits<uint64_t>::max()) {
+                throw std::runtime_error("Record without a timestamp cannot be split by hour");
+            }
+            return ts / kNanosPerHour;
+        }
+    }
+    throw std::invalid_argument("Invalid split key");
+}
+
+// Text substituted for {key}: the ID, or the hour as YYYYMMDDTHH (UTC)
+inline std::string SplitLabel(SplitKey key, uint64_t partition) {
+    if (key != SplitKey::Hour) {
+        return std::to_string(partition);
+    }
+    const std::time_t seconds = static_cast<std::time_t>(partition * 3600);
+    std::tm utc{};
+#ifdef _WIN32
+    gmtime_s(&utc, &seconds);
+#else
+    gmtime_r(&seconds, &utc);
+#endif
+    char label[16];
+    std::strftime(label, sizeof(label), "%Y%m%dT%H", &utc);
+    return label;
+}
+
+inline std::filesystem::path ExpandSplitPattern(const std::string& pattern, const std::string& label) {
+    static constexpr char kPlaceholder[] = "{key}";
+    std::string path = pattern;
+    for (size_t pos = path.find(kPlaceholder); pos != std::string::npos;
+         pos = path.find(kPlaceholder, pos + label.size())) {
+        path.replace(pos, sizeof(kPlaceholder) - 1, label);
+    }
+    return std::filesystem::path{path};
+}
+
+inline int64_t DayNumber(const date::year_month_day& ymd) {
+    return static_cast<int64_t>(date::sys_days{ymd}.time_since_epoch().count());
+}
+
+/**
+ * Input metadata narrowed to one partition
+ */
+inline databento::Metadata SplitMetadata(const databento::Metadata& source, SplitKey key, uint64_t partition) {
+    databento::Metadata metadata = source;
+    metadata.limit = 0;
+
+    if (key == SplitKey::InstrumentId && source.stype_out == databento::SType::InstrumentId) {
+        // Mapping intervals map raw symbols to instrument IDs: keep those of this instrument
+        const std::string id = std::to_string(partition);
+        metadata.mappings.clear();
+        metadata.symbols.clear();
+        for (const auto& mapping : source.mappings) {
+            databento::SymbolMapping kept{mapping.raw_symbol, {}};
+            for (const auto& interval : mapping.intervals) {
+                if (interval.symbol == id) {
+                    kept.intervals.push_back(interval);
+                }
+            }
+            if (!kept.intervals.empty()) {
+                if (std::find(metadata.symbols.begin(), metadata.symbols.end(), kept.raw_symbol) ==
+                    metadata.symbols.end()) {
+                    metadata.symbols.push_back(kept.raw_symbol);
+                }
+                metadata.mappings.push_back(std::move(kept));
+            }
+        }
+        auto not_kept = [&](const std::string& symbol) {
+            return std::find(metadata.symbols.begin(), metadata.symbols.end(), symbol) == metadata.symbols.end();
+        };
+        metadata.partial.erase(std::remove_if(metadata.partial.begin(), metadata.partial.end(), not_kept),
+                               metadata.partial.end());
+        metadata.not_found.clear();
+    } else if (key == SplitKey::Hour) {
+        const uint64_t hour_start = partition * kNanosPerHour;
+        const uint64_t hour_end = hour_start + kNanosPerHour;
+        const uint64_t start = std::max<uint64_t>(source.start.time_since_epoch().count(), hour_start);
+        const uint64_t source_end = source.end.time_since_epoch().count();
+        const uint64_t end = source_end == std::numeric_limits<uint64_t>::max() ? hour_end
+                                                                                 : std::min(source_end, hour_end);
+        metadata.start = databento::UnixNanos{std::chrono::duration<uint64_t, std::nano>{start}};
+        metadata.end = databento::UnixNanos{std::chrono::duration<uint64_t, std::nano>{std::max(start, end)}};
+
+        // Mapping intervals are whole days: keep those covering this hour's day
+        const int64_t day = static_cast<int64_t>(hour_start / kNanosPerDay);
+        metadata.mappings.clear();
+        for (const auto& mapping : source.mappings) {
+            databento::SymbolMapping kept{mapping.raw_symbol, {}};
+            for (const auto& interval : mapping.intervals) {
+                if (DayNumber(interval.start_date) <= day && day < DayNumber(interval.end_date)) {
+                    kept.intervals.push_back(interval);
+                }
+            }
+            if (!kept.intervals.empty()) {
+                metadata.mappings.push_back(std::move(kept));
+            }
+        }
+    }
+    return metadata;
+}
+
+/**
+ * One output file, created by the worker writing its first batch and reopened for each later one
+ */
+struct SplitOutput {
+    std::filesystem::path path;
+    databento::Metadata metadata;
+    bool compressed = false;
+    int level = 0;
+    std::vector<uint8_t> pending;  // Records not yet handed to a worker
+    std::shared_future<void> last;  // Latest batch; each batch waits for the one before it
+    uint64_t records = 0;
+    bool created = false;
+    std::vector<std::pair<uint32_t, uint32_t>> frames;  // zstd seek table entries so far
+
+    void Write(const std::vector<uint8_t>& batch) {
+        std::string head;
+        if (!created) {
+            StringWritable encoded;
+            databento::DbnEncoder::EncodeMetadata(metadata, &encoded);
+            if (compressed) {
+                // Stored like DbnFileWriter's, so every later frame starts on a record
+                AppendStoredFrame(head, reinterpret_cast<const std::byte*>(encoded.data.data()), encoded.data.size());
+                frames.emplace_back(static_cast<uint32_t>(head.size()), static_cast<uint32_t>(encoded.data.size()));
+            } else {
+                head = std::move(encoded.data);
+            }
+        }
+        if (compressed) {
+            const std::string frame = CompressSeekableFrame(
+                reinterpret_cast<const char*>(batch.data()), batch.size(), level);
+            frames.emplace_back(static_cast<uint32_t>(frame.size()), static_cast<uint32_t>(batch.size()));
+            head += frame;
+            Append(head, nullptr, 0);
+        } else {
+            Append(head, batch.data(), batch.size());
+        }
+    }
+
+    void Finish() {
+        if (compressed && created) {
+            std::string table;
+            AppendSeekTable(table, frames);
+            Append(table, nullptr, 0);
+        }
+    }
+
+private:
+    void Append(const std::string& head, const uint8_t* body, size_t body_size) {
+        std::ofstream file(path, created ? std::ios::binary | std::ios::app : std::ios::binary | std::ios::trunc);
+        if (!file) {
+            throw std::runtime_error("Failed to open split output " + path.string());
+        }
+        created = true;
+        file.write(head.data(), static_cast<std::streamsize>(head.size()));
+        file.write(reinterpret_cast<const char*>(body), static_cast<std::streamsize>(body_size));
+        file.close();
+        if (!file) {
+            throw std::runtime_error("Failed to write split output " + path.string());
+        }
+    }
+};
+
+}  // namespace detail
+
+/**
+ * Split a DBN file into one file per instrument, publisher or hour
+ *
+ * @param output_pattern Output path containing `{key}`, replaced by the instrument or
+ *        publisher ID or the hour (YYYYMMDDTHH, UTC); a `.zst` suffix selects seekable zstd
+ * @param compression_level zstd level for compressed outputs
+ * @param thread_count Writer threads (0 = hardware threads, capped at 8)
+ * @throws std::runtime_error on failure, after removing the outputs written so far
+ */
+inline DbnSplitResult SplitDbnFile(const std::filesystem::path& input, SplitKey key,
+                                   const std::string& output_pattern, int compression_level,
+                                   size_t thread_count) {
+    if (output_pattern.find("{key}") == std::string::npos) {
+        throw std::invalid_argument("Output pattern must contain {key}");
+    }
+    const bool compressed = output_pattern.size() >= 4 &&
+                            output_pattern.compare(output_pattern.size() - 4, 4, ".zst") == 0;
+
+    DbnFileReaderWrapper reader{input, true};
+    const databento::Metadata source = reader.GetMetadata();
+
+    // Outputs outlive the pool, whose workers reference them
+    std::unordered_map<uint64_t, std::unique_ptr<detail::SplitOutput>> outputs;
+    ThreadPool pool(thread_count > 0 ? thread_count : ThreadPool::DefaultThreadCount());
+    std::deque<std::shared_future<void>> in_flight;
+    size_t buffered = 0;
+    DbnSplitResult result;
+
+    auto submit = [&](detail::SplitOutput& output) {
+        buffered -= output.pending.size();
+        output.last = pool.Submit([&output, previous = output.last, batch = std::move(output.pending)] {
+            if (previous.valid()) {
+                previous.get();  // Started earlier (the pool is FIFO), so this cannot deadlock
+            }
+            output.Write(batch);
+        }).share();
+        output.pending = {};
+        in_flight.push_back(output.last);
+        while (in_flight.size() > pool.Size() * 4) {
+            in_flight.front().get();
+            in_flight.pop_front();
+        }
+    };
+
+    try {
+        while (const uint8_t* record = reader.NextRecordView()) {
+            const size_t length = reinterpret_cast<const databento::RecordHeader*>(record)->Size();
+            const uint64_t partition = detail::SplitPartition(record, length, key);
+            auto& slot = outputs[partition];
+            if (!slot) {
+                slot = std::make_unique<detail::SplitOutput>();
+                slot->path = detail::ExpandSplitPattern(output_pattern, detail::SplitLabel(key, partition));
+                slot->metadata = detail::SplitMetadata(source, key, partition);
+                slot->compressed = compressed;
+                slot->level = compression_level;
+                if (slot->path.has_parent_path()) {
+                    std::filesystem::create_directories(slot->path.parent_path());
+                }
+            }
+            detail::SplitOutput& output = *slot;
+            output.pending.insert(output.pending.end(), record, record + length);
+            ++output.records;
+            ++result.records;
+            buffered += length;
+            if (output.pending.size() >= detail::kSplitBatchBytes) {
+                submit(output);
+            }
+            if (buffered >= detail::kSplitBufferBudget) {
+                std::vector<detail::SplitOutput*> largest;
+                for (auto& [id, other] : outputs) {
+                    if (!other->pending.empty()) {
+                        largest.push_back(other.get());
+                    }
+                }
+                std::sort(largest.begin(), largest.end(), [](const auto* a, const auto* b) {
+                    return a->pending.size() > b->pending.size();
+                });
+                for (auto* other : largest) {
+                    if (buffered <= detail::kSplitBufferBudget / 2) {
+                        break;
+                    }
+                    submit(*other);
+                }
+            }
+        }
+        for (auto& [id, output] : outputs) {
+            if (!output->pending.empty()) {
+                submit(*output);
+            }
+        }
+        // Finish every output on the pool once its last batch is written
+        for (auto& [id, output] : outputs) {
+            detail::SplitOutput* target = output.get();
+            in_flight.push_back(pool.Submit([target, previous = output->last] {
+                if (previous.valid()) {
+                    previous.get();
+                }
+                target->Finish();
+            }).share());
+        }
+        while (!in_flight.empty()) {
+            in_flight.front().get();
+            in_flight.pop_front();
+        }
+    }
+    catch (...) {
+        for (auto& pending : in_flight) {
+            pending.wait();
+        }
+        for (auto& [id, output] : outputs) {
+            std::error_code ec;
+            std::filesystem::remove(output->path, ec);
+        }
+        throw;
+    }
+
+    result.files = outputs.size();
+    return result;
+}
+
+}  // namespace databento_native
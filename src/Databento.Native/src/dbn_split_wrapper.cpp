@@ -0,0 +1,57 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_split.hpp"
+#include <filesystem>
+#include <string>
+
+using databento_native::SafeStrCopy;
+using databento_native::SplitKey;
+
+namespace {
+
+constexpr int kDefaultSplitLevel = 3;
+
+}  // namespace
+
+// ============================================================================
+// DBN Split API Implementation
+// ============================================================================
+
+DATABENTO_API int dbento_dbn_split(
+    const char* input_path,
+    int key,
+    const char* output_pattern,
+    int compression_level,
+    int thread_count,
+    uint64_t* records,
+    uint64_t* files,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!input_path || !output_pattern || thread_count < 0 ||
+            key < static_cast<int>(SplitKey::InstrumentId) || key > static_cast<int>(SplitKey::Hour)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+        if (std::string(output_pattern).find("{key}") == std::string::npos) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Output pattern must contain {key}");
+            return -2;
+        }
+
+        const auto result = databento_native::SplitDbnFile(
+            std::filesystem::path{input_path}, static_cast<SplitKey>(key), output_pattern,
+            compression_level != 0 ? compression_level : kDefaultSplitLevel, static_cast<size_t>(thread_count));
+        if (records) {
+            *records = result.records;
+        }
+        if (files) {
+            *files = result.files;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
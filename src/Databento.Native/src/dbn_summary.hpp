@@ -0,0 +1,432 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <databento/record.hpp>
+#include <nlohmann/json.hpp>
+#include "dbn_file_reader.hpp"
+#include "dbn_index.hpp"
+#include "thread_pool.hpp"
+
+namespace databento_native {
+
+/**
+ * Record statistics of one or more DBN files
+ *
+ * Built per chunk on worker threads and merged in file order. Out-of-order records are
+ * counted against the previous record of the same file using ts_recv (ts_event for records
+ * without one), the order DBN files are sorted in.
+ */
+struct DbnSummary {
+    struct Range {
+        uint64_t min = std::numeric_limits<uint64_t>::max();
+        uint64_t max = 0;
+
+        bool Empty() const { return min > max; }
+
+        void Add(uint64_t ts) {
+            min = std::min(min, ts);
+            max = std::max(max, ts);
+        }
+
+        void Merge(const Range& other) {
+            min = std::min(min, other.min);
+            max = std::max(max, other.max);
+        }
+    };
+
+    uint64_t files = 0;
+    uint64_t records = 0;
+    uint64_t bytes = 0;
+    Range ts_event;
+    Range ts_recv;  // Only records that carry a ts_recv
+    uint64_t out_of_order = 0;
+    std::array<uint64_t, 256> rtype_records{};
+    std::array<uint64_t, 256> rtype_bytes{};
+    std::map<size_t, uint64_t> record_sizes;  // Record length -> count
+    std::unordered_map<uint16_t, uint64_t> publishers;
+    std::unordered_map<uint32_t, uint64_t> instruments;
+    // Order timestamps of the first and last record, to count disorder across chunk boundaries
+    uint64_t first_ts = 0;
+    uint64_t last_ts = 0;
+
+    /**
+     * Add a whole record (length already validated)
+     */
+    void Add(const uint8_t* record) {
+        const auto& header = *reinterpret_cast<const databento::RecordHeader*>(record);
+        const size_t length = header.Size();
+        ++records;
+        bytes += length;
+        ++rtype_records[record[1]];
+        rtype_bytes[record[1]] += length;
+        ++record_sizes[length];
+        ++publishers[header.publisher_id];
+        ++instruments[header.instrument_id];
+
+        const uint64_t event = header.ts_event.time_since_epoch().count();
+        ts_event.Add(event);
+        uint64_t order_ts = event;
+        const size_t recv_offset = TsRecvOffset(record[1]);
+        if (recv_offset != 0 && recv_offset + sizeof(uint64_t) <= length) {
+            std::memcpy(&order_ts, record + recv_offset, sizeof(order_ts));
+            ts_recv.Add(order_ts);
+        }
+        if (records == 1) {
+            first_ts = order_ts;
+        } else if (order_ts < last_ts) {
+            ++out_of_order;
+        }
+        last_ts = order_ts;
+    }
+
+    /**
+     * Fold in the summary of another chunk or file
+     * @param follows True if other's records come right after this one's in the same file
+     */
+    void Merge(const DbnSummary& other, bool follows) {
+        if (other.records == 0) {
+            files += other.files;
+            return;
+        }
+        if (follows && records > 0 && other.first_ts < last_ts) {
+            ++out_of_order;
+        }
+        if (records == 0) {
+            first_ts = other.first_ts;
+        }
+        last_ts = other.last_ts;
+
+        files += other.files;
+        records += other.records;
+        bytes += other.bytes;
+        ts_event.Merge(other.ts_event);
+        ts_recv.Merge(other.ts_recv);
+        out_of_order += other.out_of_order;
+        for (size_t i = 0; i < rtype_records.size(); ++i) {
+            rtype_records[i] += other.rtype_records[i];
+            rtype_bytes[i] += other.rtype_bytes[i];
+        }
+        for (const auto& [length, count] : other.record_sizes) {
+            record_sizes[length] += count;
+        }
+        for (const auto& [publisher, count] : other.publishers) {
+            publishers[publisher] += count;
+        }
+        for (const auto& [instrument, count] : other.instruments) {
+            instruments[instrument] += count;
+        }
+    }
+};
+
+/**
+ * Per-instrument zone map of one DBN file: where each instrument's records lie and when
+ *
+ * Lets a reader skip a file, or jump to the first relevant ordinal through the seek index,
+ * without scanning it for an instrument.
+ */
+class DbnZoneMap {
+public:
+    struct Zone {
+        uint64_t count = 0;
+        uint64_t first_ordinal = 0;
+        uint64_t last_ordinal = 0;
+        DbnSummary::Range ts;
+    };
+
+    explicit DbnZoneMap(IndexTimestamp timestamp) : timestamp_(timestamp) {}
+
+    /**
+     * Add a whole record (length already validated) in file order
+     */
+    void Add(const uint8_t* record) {
+        const auto& header = *reinterpret_cast<const databento::RecordHeader*>(record);
+        Zone& zone = zones_[header.instrument_id];
+        if (zone.count == 0) {
+            zone.first_ordinal = ordinal_;
+        }
+        ++zone.count;
+        zone.last_ordinal = ordinal_;
+        zone.ts.Add(RecordTimestamp(record, timestamp_));
+        ++ordinal_;
+    }
+
+    IndexTimestamp Timestamp() const { return timestamp_; }
+    const std::unordered_map<uint32_t, Zone>& Zones() const { return zones_; }
+
+private:
+    IndexTimestamp timestamp_;
+    uint64_t ordinal_ = 0;
+    std::unordered_map<uint32_t, Zone> zones_;
+};
+
+namespace detail {
+
+inline nlohmann::json RangeToJson(const DbnSummary::Range& range) {
+    if (range.Empty()) {
+        return nullptr;
+    }
+    return nlohmann::json{{"min", range.min}, {"max", range.max}};
+}
+
+// Counts keyed by id, sorted by id
+template <typename Map>
+nlohmann::json CountsToJson(const Map& counts, const char* key) {
+    std::vector<std::pair<typename Map::key_type, uint64_t>> sorted(counts.begin(), counts.end());
+    std::sort(sorted.begin(), sorted.end());
+    nlohmann::json out = nlohmann::json::array();
+    for (const auto& [id, count] : sorted) {
+        out.push_back(nlohmann::json{{key, id}, {"count", count}});
+    }
+    return out;
+}
+
+}  // namespace detail
+
+inline nlohmann::json SummaryToJson(const DbnSummary& summary) {
+    nlohmann::json rtypes = nlohmann::json::array();
+    for (size_t rtype = 0; rtype < summary.rtype_records.size(); ++rtype) {
+        if (summary.rtype_records[rtype] > 0) {
+            rtypes.push_back(nlohmann::json{{"rtype", rtype},
+                                            {"count", summary.rtype_records[rtype]},
+                                            {"bytes", summary.rtype_bytes[rtype]}});
+        }
+    }
+    return nlohmann::json{
+        {"files", summary.files},
+        {"record_count", summary.records},
+        {"total_bytes", summary.bytes},
+        {"ts_event", detail::RangeToJson(summary.ts_event)},
+        {"ts_recv", detail::RangeToJson(summary.ts_recv)},
+        {"out_of_order", summary.out_of_order},
+        {"rtypes", std::move(rtypes)},
+        {"record_sizes", detail::CountsToJson(summary.record_sizes, "length")},
+        {"publishers", detail::CountsToJson(summary.publishers, "publisher_id")},
+        {"instruments", detail::CountsToJson(summary.instruments, "instrument_id")}
+    };
+}
+
+inline std::filesystem::path StatsSidecarPath(const std::filesystem::path& dbn_path) {
+    std::filesystem::path path = dbn_path;
+    path += ".stats.json";
+    return path;
+}
+
+/**
+ * Write the `<file>.stats.json` sidecar of a finished DBN file atomically (temp file + rename)
+ *
+ * The summary JSON of dbento_dbn_file_summarize plus source_size (the DBN file's size, to
+ * detect a stale sidecar), zone_timestamp and zones sorted by instrument_id:
+ * [{instrument_id, count, first_ordinal, last_ordinal, ts: {min, max}}].
+ * @throws std::runtime_error on I/O failure
+ */
+inline void SaveStatsSidecar(const std::filesystem::path& dbn_path, const DbnSummary& summary,
+                             const DbnZoneMap& zones) {
+    std::vector<std::pair<uint32_t, DbnZoneMap::Zone>> sorted(zones.Zones().begin(), zones.Zones().end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+    nlohmann::json zones_json = nlohmann::json::array();
+    for (const auto& [instrument_id, zone] : sorted) {
+        zones_json.push_back(nlohmann::json{
+            {"instrument_id", instrument_id},
+            {"count", zone.count},
+            {"first_ordinal", zone.first_ordinal},
+            {"last_ordinal", zone.last_ordinal},
+            {"ts", detail::RangeToJson(zone.ts)}
+        });
+    }
+    nlohmann::json out = SummaryToJson(summary);
+    out["source_size"] = std::filesystem::file_size(dbn_path);
+    out["zone_timestamp"] = zones.Timestamp() == IndexTimestamp::TsRecv ? "ts_recv" : "ts_event";
+    out["zones"] = std::move(zones_json);
+
+    const std::filesystem::path path = StatsSidecarPath(dbn_path);
+    std::filesystem::path tmp_path = path;
+    tmp_path += ".tmp";
+    {
+        const std::string text = out.dump();
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file || !file.write(text.data(), static_cast<std::streamsize>(text.size()))) {
+            throw std::runtime_error("Failed to write DBN statistics: " + tmp_path.string());
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        throw std::runtime_error("Failed to replace DBN statistics: " + ec.message());
+    }
+}
+
+namespace detail {
+
+// Records handed to a worker: a span of a memory mapping, or a copy for the other readers
+struct SummaryChunk {
+    const uint8_t* begin = nullptr;
+    const uint8_t* end = nullptr;
+    std::vector<uint8_t> copy;
+
+    size_t Size() const {
+        return copy.empty() ? static_cast<size_t>(end - begin) : copy.size();
+    }
+};
+
+inline DbnSummary SummarizeChunk(const SummaryChunk& chunk) {
+    const uint8_t* data = chunk.copy.empty() ? chunk.begin : chunk.copy.data();
+    const size_t size = chunk.Size();
+    DbnSummary summary;
+    for (size_t offset = 0; offset < size;) {
+        summary.Add(data + offset);
+        offset += static_cast<size_t>(data[offset]) * databento::RecordHeader::kLengthMultiplier;
+    }
+    return summary;
+}
+
+}  // namespace detail
+
+/**
+ * Summarize one DBN file with the pool's workers
+ *
+ * The calling thread walks record boundaries (in place for memory-mapped files, with
+ * frame-parallel decompression for seekable zstd files) and cuts ~4 MiB chunks, which the
+ * workers summarize; at most two chunks per worker are in flight, merged in file order.
+ */
+inline DbnSummary SummarizeDbnFile(const std::filesystem::path& path, ThreadPool& pool) {
+    constexpr size_t kChunkBytes = 4 << 20;
+
+    DbnFileReaderWrapper reader{path, true};
+    std::deque<std::future<DbnSummary>> in_flight;
+    DbnSummary summary;
+    summary.files = 1;
+
+    auto drain = [&](size_t limit) {
+        while (in_flight.size() > limit) {
+            summary.Merge(in_flight.front().get(), true);
+            in_flight.pop_front();
+        }
+    };
+
+    try {
+        detail::SummaryChunk chunk;
+        for (;;) {
+            const uint8_t* record = reader.NextRecordView();
+            if (record) {
+                const size_t length = reinterpret_cast<const databento::RecordHeader*>(record)->Size();
+                if (reader.IsMapped()) {
+                    // Mapped records are contiguous: extend the span
+                    if (!chunk.begin) {
+                        chunk.begin = record;
+                    }
+                    chunk.end = record + length;
+                } else {
+                    chunk.copy.insert(chunk.copy.end(), record, record + length);
+                }
+            }
+            if (chunk.Size() > 0 && (!record || chunk.Size() >= kChunkBytes)) {
+                in_flight.push_back(pool.Submit([chunk = std::move(chunk)] {
+                    return detail::SummarizeChunk(chunk);
+                }));
+                chunk = detail::SummaryChunk{};
+                drain(pool.Size() * 2);
+            }
+            if (!record) {
+                break;
+            }
+        }
+        drain(0);
+    }
+    catch (...) {
+        // Workers may still read the mapping: wait for them before the reader closes
+        for (auto& pending : in_flight) {
+            pending.wait();
+        }
+        throw;
+    }
+    return summary;
+}
+
+/**
+ * Summarize a set of DBN files, merged in the order given
+ *
+ * Files below kSummaryWholeFileBytes are each summarized by one worker, all submitted up
+ * front, so a set of many small files runs in parallel; larger files are meanwhile cut into
+ * chunks by the calling thread (SummarizeDbnFile). Small seekable zstd files share one
+ * frame-decode pool rather than starting one per file.
+ * @throws std::runtime_error naming the file that failed
+ */
+inline DbnSummary SummarizeDbnFiles(const std::vector<std::filesystem::path>& paths, ThreadPool& pool) {
+    constexpr uintmax_t kSummaryWholeFileBytes = 32 << 20;
+
+    std::vector<std::future<DbnSummary>> small(paths.size());
+    std::vector<DbnSummary> large(paths.size());
+    std::shared_ptr<ThreadPool> decode_pool;
+    auto fail = [&](size_t i, const std::exception& e) {
+        for (auto& pending : small) {
+            if (pending.valid()) {
+                pending.wait();
+            }
+        }
+        return std::runtime_error(paths[i].string() + ": " + e.what());
+    };
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        std::error_code ec;
+        const uintmax_t size = std::filesystem::file_size(paths[i], ec);
+        if (ec || size >= kSummaryWholeFileBytes) {
+            continue;  // Chunked below (a missing file reports its error there)
+        }
+        if (!decode_pool) {
+            decode_pool = std::make_shared<ThreadPool>(ThreadPool::DefaultThreadCount());
+        }
+        small[i] = pool.Submit([path = paths[i], decode_pool] {
+            DbnFileReaderWrapper reader{path, true, std::nullopt, decode_pool};
+            DbnSummary summary;
+            summary.files = 1;
+            while (const uint8_t* record = reader.NextRecordView()) {
+                summary.Add(record);
+            }
+            return summary;
+        });
+    }
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (!small[i].valid()) {
+            try {
+                large[i] = SummarizeDbnFile(paths[i], pool);
+            }
+            catch (const std::exception& e) {
+                throw fail(i, e);
+            }
+        }
+    }
+
+    DbnSummary total;
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (small[i].valid()) {
+            try {
+                total.Merge(small[i].get(), false);
+            }
+            catch (const std::exception& e) {
+                throw fail(i, e);
+            }
+        } else {
+            total.Merge(large[i], false);
+        }
+    }
+    return total;
+}
+
+}  // namespace databento_native
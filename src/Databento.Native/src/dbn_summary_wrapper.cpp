@@ -0,0 +1,60 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_summary.hpp"
+#include "thread_pool.hpp"
+#include <cstring>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using databento_native::SafeStrCopy;
+using databento_native::DbnSummary;
+using databento_native::SummaryToJson;
+using databento_native::ThreadPool;
+
+namespace {
+
+// Allocate a string that can be freed with dbento_free_string
+char* AllocateString(const std::string& str) {
+    char* result = new char[str.size() + 1];
+    std::memcpy(result, str.c_str(), str.size());
+    result[str.size()] = '\0';
+    return result;
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN File Summary API Implementation
+// ============================================================================
+
+DATABENTO_API const char* dbento_dbn_file_summarize(
+    const char** file_paths,
+    size_t file_count,
+    int thread_count,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!file_paths || file_count == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return nullptr;
+        }
+        for (size_t i = 0; i < file_count; ++i) {
+            if (!file_paths[i]) {
+                SafeStrCopy(error_buffer, error_buffer_size, "File path cannot be null");
+                return nullptr;
+            }
+        }
+
+        ThreadPool pool(thread_count > 0 ? static_cast<size_t>(thread_count)
+                                         : ThreadPool::DefaultThreadCount());
+        const std::vector<std::filesystem::path> paths(file_paths, file_paths + file_count);
+        const DbnSummary total = databento_native::SummarizeDbnFiles(paths, pool);
+        return AllocateString(SummaryToJson(total).dump());
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
@@ -0,0 +1,320 @@
+#include "databento_native.h"
+#include "common_helpers.hpp"
+#include "dbn_file_reader.hpp"
+#include "file_readable.hpp"
+#include "seekable_zstd.hpp"
+#include "thread_pool.hpp"
+#include <databento/constants.hpp>
+#include <databento/dbn_decoder.hpp>
+#include <databento/dbn_encoder.hpp>
+#include <databento/enums.hpp>
+#include <databento/iwritable.hpp>
+#include <databento/record.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace db = databento;
+using databento_native::SafeStrCopy;
+using databento_native::FileReadable;
+using databento_native::ReaderLogReceiver;
+using databento_native::SeekableZstdWriter;
+using databento_native::ThreadPool;
+
+namespace {
+
+// Output compression of dbento_dbn_upgrade_files
+enum class TranscodeCompression : int {
+    Keep = -1,  // Same as the input (zstd inputs are rewritten in the seekable format)
+    None = 0,
+    Zstd = 1    // Seekable zstd
+};
+
+constexpr int kDefaultTranscodeLevel = 3;
+
+// Plain file sink whose close errors are reported, unlike db::OutFileStream
+class PlainFileWriter : public db::IWritable {
+public:
+    explicit PlainFileWriter(const std::filesystem::path& path)
+        : out_(path, std::ios::binary | std::ios::trunc)
+    {
+        if (!out_) {
+            throw std::runtime_error("Failed to create file: " + path.string());
+        }
+    }
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        out_.write(reinterpret_cast<const char*>(buffer), static_cast<std::streamsize>(length));
+        if (!out_) {
+            throw std::runtime_error("Failed to write DBN output");
+        }
+    }
+
+    void Close() {
+        out_.close();
+        if (!out_) {
+            throw std::runtime_error("Failed to close DBN output");
+        }
+    }
+
+private:
+    std::ofstream out_;
+};
+
+bool IsDbnFile(const std::filesystem::path& path) {
+    const std::string name = path.filename().string();
+    auto ends_with = [&](const char* suffix) {
+        const size_t length = std::strlen(suffix);
+        return name.size() > length && name.compare(name.size() - length, length, suffix) == 0;
+    };
+    return ends_with(".dbn") || ends_with(".dbn.zst");
+}
+
+// Name without the .dbn / .dbn.zst extension
+std::string StemOf(const std::filesystem::path& path) {
+    std::string name = path.filename().string();
+    for (const char* suffix : {".dbn.zst", ".dbn"}) {
+        const size_t length = std::strlen(suffix);
+        if (name.size() > length && name.compare(name.size() - length, length, suffix) == 0) {
+            return name.substr(0, name.size() - length);
+        }
+    }
+    return name;
+}
+
+bool IsCompressed(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    char prefix[3] = {};
+    in.read(prefix, sizeof(prefix));
+    return in.gcount() < 3 || std::memcmp(prefix, "DBN", 3) != 0;
+}
+
+// Path TranscodeFile writes for input
+std::filesystem::path OutputPath(const std::filesystem::path& input, const std::filesystem::path& output_dir,
+                                 TranscodeCompression compression, bool input_compressed) {
+    const bool zstd = compression == TranscodeCompression::Keep ? input_compressed
+                                                                : compression == TranscodeCompression::Zstd;
+    return (output_dir / (StemOf(input) + (zstd ? ".dbn.zst" : ".dbn"))).lexically_normal();
+}
+
+enum class FileOutcome { Upgraded, Skipped };
+
+/**
+ * Decode one file with UpgradeToV3 and re-encode it at the current DBN version
+ *
+ * Output goes to a temporary file next to the target and is renamed over it once complete,
+ * so a failure never leaves a partial file; in-place upgrades that change the extension
+ * remove the original afterwards.
+ */
+FileOutcome TranscodeFile(const std::filesystem::path& input, const std::filesystem::path& output_dir,
+                          TranscodeCompression compression, int level, bool skip_current, bool in_place) {
+    const bool input_compressed = IsCompressed(input);
+    {
+        db::DbnDecoder probe{&ReaderLogReceiver(), std::make_unique<FileReadable>(input),
+                             db::VersionUpgradePolicy::AsIs};
+        const bool keeps_compression = compression == TranscodeCompression::Keep ||
+                                       (compression == TranscodeCompression::Zstd) == input_compressed;
+        if (skip_current && keeps_compression && probe.DecodeMetadata().version >= db::kDbnVersion) {
+            return FileOutcome::Skipped;
+        }
+    }
+
+    const std::filesystem::path output = OutputPath(input, output_dir, compression, input_compressed);
+    const bool zstd = output.extension() == ".zst";
+    std::filesystem::path tmp_output = output;
+    tmp_output += ".tmp";
+
+    try {
+        {
+            db::DbnDecoder decoder{&ReaderLogReceiver(), std::make_unique<FileReadable>(input),
+                                   db::VersionUpgradePolicy::UpgradeToV3};
+            db::Metadata metadata = decoder.DecodeMetadata();
+            metadata.version = db::kDbnVersion;
+            metadata.symbol_cstr_len = db::kSymbolCstrLen;
+
+            if (zstd) {
+                SeekableZstdWriter writer{tmp_output, level, 0};
+                db::DbnEncoder encoder{metadata, &writer};
+                writer.RecordBoundary(true);
+                while (const db::Record* record = decoder.DecodeRecord()) {
+                    encoder.EncodeRecord(*record);
+                    writer.RecordBoundary();
+                }
+                writer.Finish();
+            } else {
+                PlainFileWriter writer{tmp_output};
+                db::DbnEncoder encoder{metadata, &writer};
+                while (const db::Record* record = decoder.DecodeRecord()) {
+                    encoder.EncodeRecord(*record);
+                }
+                writer.Close();
+            }
+        }  // Input closed before it may be replaced
+
+        std::filesystem::rename(tmp_output, output);
+    }
+    catch (...) {
+        std::error_code ec;
+        std::filesystem::remove(tmp_output, ec);
+        throw;
+    }
+
+    if (in_place && output != input.lexically_normal()) {
+        std::filesystem::remove(input);  // The extension changed: drop the original
+    }
+    return FileOutcome::Upgraded;
+}
+
+}  // namespace
+
+// ============================================================================
+// DBN Bulk Upgrade API Implementation
+// ============================================================================
+
+DATABENTO_API int dbento_dbn_upgrade_files(
+    const char* input_path,
+    const char* output_dir,
+    int compression,
+    int compression_level,
+    int skip_current,
+    int thread_count,
+    uint64_t* files_upgraded,
+    uint64_t* files_skipped,
+    uint64_t* files_failed,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (!input_path || compression < static_cast<int>(TranscodeCompression::Keep) ||
+            compression > static_cast<int>(TranscodeCompression::Zstd)) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        // Collect (input, output directory) pairs, mirroring the input tree
+        const std::filesystem::path root{input_path};
+        const std::filesystem::path out_root = output_dir ? std::filesystem::path{output_dir}
+                                                          : std::filesystem::path{};
+        std::vector<std::pair<std::filesystem::path, std::filesystem::path>> jobs;
+        if (std::filesystem::is_regular_file(root)) {
+            jobs.emplace_back(root, output_dir ? out_root : root.parent_path());
+        } else if (std::filesystem::is_directory(root)) {
+            for (const auto& entry : std::filesystem::recursive_directory_iterator(root)) {
+                if (!entry.is_regular_file() || !IsDbnFile(entry.path())) {
+                    continue;
+                }
+                const std::filesystem::path parent = entry.path().parent_path();
+                jobs.emplace_back(entry.path(),
+                    output_dir ? out_root / std::filesystem::relative(parent, root) : parent);
+            }
+        } else {
+            SafeStrCopy(error_buffer, error_buffer_size, "Input path does not exist");
+            return -2;
+        }
+        // Largest files first so one big file does not start last
+        std::sort(jobs.begin(), jobs.end(), [](const auto& a, const auto& b) {
+            return std::filesystem::file_size(a.first) > std::filesystem::file_size(b.first);
+        });
+
+        const auto codec = static_cast<TranscodeCompression>(compression);
+        const int level = compression_level != 0 ? compression_level : kDefaultTranscodeLevel;
+        std::atomic<uint64_t> upgraded{0};
+        std::atomic<uint64_t> skipped{0};
+        std::atomic<uint64_t> failed{0};
+        std::mutex error_mutex;
+        std::string first_error;
+
+        // Files whose output is also another file's output or input (e.g. foo.dbn and
+        // foo.dbn.zst recompressed in place) would overwrite each other: fail them all
+        std::map<std::filesystem::path, std::vector<size_t>> writers;
+        std::map<std::filesystem::path, size_t> readers;
+        std::vector<std::filesystem::path> targets;
+        targets.reserve(jobs.size());
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            targets.push_back(OutputPath(jobs[i].first, jobs[i].second, codec, IsCompressed(jobs[i].first)));
+            writers[targets[i]].push_back(i);
+            readers[jobs[i].first.lexically_normal()] = i;
+        }
+        std::vector<bool> conflicted(jobs.size(), false);
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            if (writers[targets[i]].size() > 1) {
+                conflicted[i] = true;
+            }
+            auto reader = readers.find(targets[i]);
+            if (reader != readers.end() && reader->second != i) {
+                conflicted[i] = true;
+                conflicted[reader->second] = true;
+            }
+        }
+        for (size_t i = 0; i < jobs.size(); ++i) {
+            if (conflicted[i]) {
+                ++failed;
+                if (first_error.empty()) {
+                    first_error = jobs[i].first.string() + ": output " + targets[i].string() +
+                                  " is also written or read for another file";
+                }
+            }
+        }
+
+        {
+            ThreadPool pool(thread_count > 0 ? static_cast<size_t>(thread_count)
+                                             : ThreadPool::DefaultThreadCount());
+            std::vector<std::future<void>> pending;
+            pending.reserve(jobs.size());
+            for (size_t i = 0; i < jobs.size(); ++i) {
+                if (conflicted[i]) {
+                    continue;
+                }
+                pending.push_back(pool.Submit([&, input = jobs[i].first, out_dir = jobs[i].second] {
+                    try {
+                        std::filesystem::create_directories(out_dir);
+                        if (TranscodeFile(input, out_dir, codec, level, skip_current != 0, !output_dir) ==
+                            FileOutcome::Skipped) {
+                            ++skipped;
+                        } else {
+                            ++upgraded;
+                        }
+                    }
+                    catch (const std::exception& e) {
+                        ++failed;
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        if (first_error.empty()) {
+                            first_error = input.string() + ": " + e.what();
+                        }
+                    }
+                }));
+            }
+            for (auto& task : pending) {
+                task.wait();
+            }
+        }
+
+        if (files_upgraded) {
+            *files_upgraded = upgraded;
+        }
+        if (files_skipped) {
+            *files_skipped = skipped;
+        }
+        if (files_failed) {
+            *files_failed = failed;
+        }
+        if (failed > 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, first_error.c_str());
+            return 1;
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
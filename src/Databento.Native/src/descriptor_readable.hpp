@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <databento/ireadable.hpp>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <cstring>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace databento_native {
+
+/**
+ * True if the descriptor (POSIX file descriptor or Windows HANDLE) refers to a regular
+ * file, which can be memory-mapped; pipes, sockets and terminals can only be read forward
+ */
+inline bool IsRegularFileDescriptor(intptr_t descriptor) {
+#ifdef _WIN32
+    return ::GetFileType(reinterpret_cast<HANDLE>(descriptor)) == FILE_TYPE_DISK;
+#else
+    struct stat st;
+    return ::fstat(static_cast<int>(descriptor), &st) == 0 && S_ISREG(st.st_mode);
+#endif
+}
+
+/**
+ * IReadable over a caller-owned descriptor, read forward from its current position
+ *
+ * Used for pipes and other streams that cannot be mapped or reopened, e.g. DBN piped in
+ * from another process. The descriptor is not closed.
+ */
+class DescriptorReadable : public databento::IReadable {
+public:
+    explicit DescriptorReadable(intptr_t descriptor)
+        : descriptor_(descriptor)
+    {}
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t total = 0;
+        while (total < length) {
+            size_t count = ReadSome(buffer + total, length - total);
+            if (count == 0) {
+                throw std::runtime_error("Unexpected end of DBN stream");
+            }
+            total += count;
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+#ifdef _WIN32
+        DWORD count = 0;
+        const DWORD request = max_length > MAXDWORD ? MAXDWORD : static_cast<DWORD>(max_length);
+        if (!::ReadFile(reinterpret_cast<HANDLE>(descriptor_), buffer, request, &count, nullptr)) {
+            if (::GetLastError() == ERROR_BROKEN_PIPE) {
+                return 0;  // Writer closed the pipe: end of stream
+            }
+            throw std::runtime_error("Failed to read DBN stream (error " + std::to_string(::GetLastError()) + ")");
+        }
+        return count;
+#else
+        for (;;) {
+            const ssize_t count = ::read(static_cast<int>(descriptor_), buffer, max_length);
+            if (count >= 0) {
+                return static_cast<size_t>(count);
+            }
+            if (errno != EINTR) {
+                throw std::runtime_error(std::string("Failed to read DBN stream (") + std::strerror(errno) + ")");
+            }
+        }
+#endif
+    }
+
+private:
+    intptr_t descriptor_;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <databento/ireadable.hpp>
+
+namespace databento_native {
+
+/**
+ * IReadable over a file that can resume at an arbitrary byte offset
+ *
+ * DbnDecoder always starts by decoding the metadata header, so a reader that wants to
+ * start mid-file cannot simply seek the stream. Resume(prefix_length, offset) makes the
+ * readable serve the first prefix_length bytes (the DBN prefix and metadata) and then
+ * continue at offset, which lets a fresh decoder start at any record boundary of an
+ * uncompressed DBN file.
+ */
+class FileReadable : public databento::IReadable {
+public:
+    explicit FileReadable(const std::filesystem::path& path)
+        : stream_(path, std::ios::binary)
+    {
+        if (!stream_) {
+            throw std::runtime_error("Failed to open file: " + path.string());
+        }
+    }
+
+    /**
+     * After prefix_length bytes have been read, jump to resume_offset
+     */
+    void Resume(uint64_t prefix_length, uint64_t resume_offset) {
+        prefix_remaining_ = prefix_length;
+        resume_offset_ = resume_offset;
+        resume_pending_ = resume_offset != prefix_length;
+    }
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t total = 0;
+        while (total < length) {
+            size_t count = ReadSome(buffer + total, length - total);
+            if (count == 0) {
+                throw std::runtime_error("Unexpected end of DBN file");
+            }
+            total += count;
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        if (resume_pending_ && prefix_remaining_ == 0) {
+            stream_.seekg(static_cast<std::streamoff>(resume_offset_));
+            resume_pending_ = false;
+        }
+        if (resume_pending_ && max_length > prefix_remaining_) {
+            max_length = static_cast<size_t>(prefix_remaining_);
+        }
+        stream_.read(reinterpret_cast<char*>(buffer), static_cast<std::streamsize>(max_length));
+        const size_t count = static_cast<size_t>(stream_.gcount());
+        if (count == 0 && stream_.bad()) {
+            throw std::runtime_error("Failed to read DBN file");
+        }
+        if (resume_pending_) {
+            prefix_remaining_ -= count;
+        }
+        // Keep the stream usable after a short read at EOF
+        stream_.clear(stream_.rdstate() & ~(std::ios::eofbit | std::ios::failbit));
+        return count;
+    }
+
+private:
+    std::ifstream stream_;
+    uint64_t prefix_remaining_ = 0;
+    uint64_t resume_offset_ = 0;
+    bool resume_pending_ = false;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+/**
+ * Minimal FlatBuffers builder for the Arrow IPC metadata messages
+ *
+ * Follows the reference builder's layout: the buffer grows downwards, objects are
+ * identified by their offset from the end, and tables get their vtable written in front of
+ * them. Only what Schema, Message and Footer need is supported (scalars, strings, vectors
+ * of scalars/structs/offsets, inline structs, nested tables); vtables are not deduplicated.
+ */
+class FlatBufferBuilder {
+public:
+    using Offset = uint32_t;  // Distance of an object from the end of the buffer
+
+    explicit FlatBufferBuilder(size_t initial_capacity = 1024)
+        : buffer_(initial_capacity)
+    {}
+
+    Offset CreateString(std::string_view str) {
+        Align(sizeof(uint32_t), str.size() + 1);
+        uint8_t* dest = Allocate(str.size() + 1);
+        std::memcpy(dest, str.data(), str.size());
+        dest[str.size()] = 0;
+        return PushScalar(static_cast<uint32_t>(str.size()));
+    }
+
+    template <typename T>
+    Offset CreateVector(const std::vector<T>& values) {
+        Align(sizeof(uint32_t), values.size() * sizeof(T));
+        Align(sizeof(T), values.size() * sizeof(T));
+        if (!values.empty()) {
+            std::memcpy(Allocate(values.size() * sizeof(T)), values.data(), values.size() * sizeof(T));
+        }
+        return PushScalar(static_cast<uint32_t>(values.size()));
+    }
+
+    // Vector of structs laid out as raw bytes (struct_size each, aligned to struct_align)
+    Offset CreateStructVector(const std::vector<uint8_t>& bytes, size_t count, size_t struct_align) {
+        Align(sizeof(uint32_t), bytes.size());
+        Align(struct_align, bytes.size());
+        if (!bytes.empty()) {
+            std::memcpy(Allocate(bytes.size()), bytes.data(), bytes.size());
+        }
+        return PushScalar(static_cast<uint32_t>(count));
+    }
+
+    Offset CreateOffsetVector(const std::vector<Offset>& offsets) {
+        Align(sizeof(uint32_t), offsets.size() * sizeof(uint32_t));
+        for (auto it = offsets.rbegin(); it != offsets.rend(); ++it) {
+            PushScalar(ReferTo(*it));
+        }
+        return PushScalar(static_cast<uint32_t>(offsets.size()));
+    }
+
+    void StartTable() {
+        fields_.clear();
+        table_start_ = Size();
+    }
+
+    template <typename T>
+    void AddScalar(uint16_t slot, T value) {
+        fields_.emplace_back(PushScalar(value), slot);
+    }
+
+    void AddOffset(uint16_t slot, Offset offset) {
+        fields_.emplace_back(PushScalar(ReferTo(offset)), slot);
+    }
+
+    // Inline struct field given as raw little-endian bytes
+    void AddStruct(uint16_t slot, const void* data, size_t size, size_t align) {
+        Align(align, size);
+        std::memcpy(Allocate(size), data, size);
+        fields_.emplace_back(Size(), slot);
+    }
+
+    Offset EndTable() {
+        const Offset table = PushScalar<int32_t>(0);  // Patched with the vtable distance below
+        uint16_t slots = 0;
+        for (const auto& field : fields_) {
+            slots = std::max<uint16_t>(slots, static_cast<uint16_t>(field.second + 1));
+        }
+        std::vector<uint16_t> vtable(2 + slots, 0);
+        vtable[0] = static_cast<uint16_t>(vtable.size() * sizeof(uint16_t));
+        vtable[1] = static_cast<uint16_t>(table - table_start_);
+        for (const auto& field : fields_) {
+            vtable[2 + field.second] = static_cast<uint16_t>(table - field.first);
+        }
+        for (auto it = vtable.rbegin(); it != vtable.rend(); ++it) {
+            PushScalar(*it);
+        }
+        const int32_t vtable_distance = static_cast<int32_t>(Size() - table);
+        std::memcpy(At(table), &vtable_distance, sizeof(vtable_distance));
+        fields_.clear();
+        return table;
+    }
+
+    /**
+     * Write the root offset; the finished buffer is Data()[0, Size())
+     */
+    void Finish(Offset root) {
+        Align(std::max<size_t>(min_align_, sizeof(uint32_t)), sizeof(uint32_t));
+        PushScalar(ReferTo(root));
+    }
+
+    const uint8_t* Data() const { return buffer_.data() + buffer_.size() - size_; }
+    size_t Size() const { return size_; }
+
+private:
+    uint8_t* At(Offset offset) { return buffer_.data() + buffer_.size() - offset; }
+
+    uint8_t* Allocate(size_t length) {
+        if (size_ + length > buffer_.size()) {
+            std::vector<uint8_t> grown(std::max(buffer_.size() * 2, size_ + length));
+            std::memcpy(grown.data() + grown.size() - size_, Data(), size_);
+            buffer_.swap(grown);
+        }
+        size_ += length;
+        return At(static_cast<Offset>(size_));
+    }
+
+    // Pad so that an element of `align` bytes is aligned once `additional` bytes follow it
+    void Align(size_t align, size_t additional = 0) {
+        min_align_ = std::max(min_align_, align);
+        const size_t padding = (~(size_ + additional) + 1) & (align - 1);
+        if (padding > 0) {
+            std::memset(Allocate(padding), 0, padding);
+        }
+    }
+
+    template <typename T>
+    Offset PushScalar(T value) {
+        Align(sizeof(T));
+        std::memcpy(Allocate(sizeof(T)), &value, sizeof(T));
+        return static_cast<Offset>(size_);
+    }
+
+    // uoffset value for a field about to be pushed that points at offset
+    uint32_t ReferTo(Offset offset) {
+        Align(sizeof(uint32_t));
+        return static_cast<uint32_t>(size_ + sizeof(uint32_t) - offset);
+    }
+
+    std::vector<uint8_t> buffer_;
+    size_t size_ = 0;
+    size_t min_align_ = 1;
+    Offset table_start_ = 0;
+    std::vector<std::pair<Offset, uint16_t>> fields_;  // (field location, slot) of the open table
+};
+
+}  // namespace databento_native
@@ -22,7 +22,10 @@ enum class HandleType : uint32_t {
     SymbologyResolution = 8,
     UnitPrices = 9,
     BatchJob = 10,
-    LiveBlocking = 11  // Pull-based LiveBlocking client
+    LiveBlocking = 11,  // Pull-based LiveBlocking client
+    DbnMergeReader = 12,
+    ArrowBuilder = 13,
+    DbnRollingWriter = 14
 };
 
 /**
@@ -1,19 +1,35 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
 #include "handle_validation.hpp"
+#include "spsc_record_ring.hpp"
+#include "metadata_cache.hpp"
+#include "symbology_cache.hpp"
 #include <databento/historical.hpp>
 #include <databento/record.hpp>
 #include <databento/enums.hpp>
 #include <databento/timeseries.hpp>
 #include <databento/datetime.hpp>
 #include <databento/symbology.hpp>
+#include <databento/dbn_file_store.hpp>
+#include <databento/dbn_encoder.hpp>
+#include <databento/file_stream.hpp>
+#include <databento/detail/zstd_stream.hpp>
 #include <nlohmann/json.hpp>
 #include <memory>
 #include <string>
 #include <vector>
 #include <cstring>
 #include <chrono>
+#include <exception>
 #include <sstream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
 
 namespace db = databento;
 using json = nlohmann::json;
@@ -23,6 +39,7 @@ using databento_native::NsToUnixNanos;
 using databento_native::ValidateNonEmptyString;
 using databento_native::ValidateSymbolArray;
 using databento_native::ValidateTimeRange;
+using databento_native::MetadataCache;
 
 // ============================================================================
 // Internal Wrapper Class
@@ -54,6 +71,78 @@ struct MetadataWrapper {
 // Helper Functions (now in common_helpers.hpp)
 // ============================================================================
 
+// ============================================================================
+// Pipelined Record Delivery
+// ============================================================================
+
+// The ring only absorbs bursts between the receive and consume stages, so a few MiB keep
+// both busy; chunked downloads run one ring per worker, so it is kept well below 16 MiB
+static constexpr size_t kPipelineRingCapacity = 2 * 1024 * 1024;
+// Upper bound of one record as buffered in the ring (largest DBN record, padded)
+static constexpr size_t kPipelineRecordBound = 512;
+
+/**
+ * Ring size for a request: just enough for a small `limit`, otherwise kPipelineRingCapacity
+ */
+static size_t PipelineRingCapacity(uint64_t limit)
+{
+    if (limit == 0 || limit >= kPipelineRingCapacity / kPipelineRecordBound) {
+        return kPipelineRingCapacity;
+    }
+    return std::max(static_cast<size_t>(limit) * kPipelineRecordBound,
+                    databento_native::SpscRecordRing::kMinCapacity);
+}
+
+/**
+ * Run a streaming timeseries request with receive and consume stages overlapped
+ *
+ * `fetch` is invoked on a dedicated receive thread with a record handler to pass to
+ * TimeseriesGetRange; socket reads, zstd decompression and DBN decoding all happen there
+ * (databento-cpp performs them inline and exposes no raw-byte hook). Each decoded record
+ * is copied into a bounded SPSC ring and delivered to on_record on the calling thread,
+ * so a slow consumer no longer stalls the socket and vice versa. Backpressure is applied
+ * when the ring is full. Errors from the receive thread are rethrown on the caller.
+ */
+template <typename Fetch>
+static void RunPipelinedRange(Fetch&& fetch, size_t ring_capacity, RecordCallback on_record, void* user_data)
+{
+    databento_native::SpscRecordRing ring(ring_capacity);
+    std::exception_ptr receive_error;
+
+    std::thread receiver([&ring, &receive_error, &fetch]() {
+        try {
+            fetch([&ring](const db::Record& record) {
+                // Copy required: the record reference is only valid during this callback
+                return ring.Push(&record.Header(), record.Size())
+                    ? db::KeepGoing::Continue
+                    : db::KeepGoing::Stop;
+            });
+        }
+        catch (...) {
+            receive_error = std::current_exception();
+        }
+        ring.Close();
+    });
+
+    try {
+        while (ring.ConsumeBatch([on_record, user_data](const uint8_t* data, size_t length) {
+            const auto* header = reinterpret_cast<const db::RecordHeader*>(data);
+            on_record(data, length, static_cast<uint8_t>(header->rtype), user_data);
+        })) {
+        }
+    }
+    catch (...) {
+        ring.Cancel();
+        receiver.join();
+        throw;
+    }
+
+    receiver.join();
+    if (receive_error) {
+        std::rethrow_exception(receive_error);
+    }
+}
+
 // ============================================================================
 // C API Implementation
 // ============================================================================
@@ -126,31 +215,17 @@ DATABENTO_API int dbento_historical_get_range(
         auto end_unix = NsToUnixNanos(end_time_ns);
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
-        // Call timeseries API
-        wrapper->client->TimeseriesGetRange(
-            dataset,
-            datetime_range,
-            symbol_vec,
-            schema_enum,
-            [on_record, user_data](const db::Record& record) {
-                // CRITICAL FIX: Copy record data as required by databento-cpp API
-                // databento-cpp documentation: "The reference passed to record_callback is only valid
-                // during the callback. Copy the record or particular fields to persist data between calls."
-                size_t length = record.Size();
-                uint8_t type = static_cast<uint8_t>(record.RType());
-
-                // Use thread-local buffer pool to avoid repeated allocations
-                thread_local std::vector<uint8_t> buffer;
-                if (buffer.size() < length) {
-                    buffer.resize(length * 2);  // Over-allocate to reduce future resizes
-                }
-                std::memcpy(buffer.data(), &record.Header(), length);
-
-                // Pass the copied data to .NET callback
-                on_record(buffer.data(), length, type, user_data);
-                return db::KeepGoing::Continue;
-            }
-        );
+        // Call timeseries API; receive/decode and the .NET callback run on separate threads
+        db::Historical* client = wrapper->client.get();
+        RunPipelinedRange([&](const db::RecordCallback& handle_record) {
+            client->TimeseriesGetRange(
+                dataset,
+                datetime_range,
+                symbol_vec,
+                schema_enum,
+                handle_record
+            );
+        }, PipelineRingCapacity(0), on_record, user_data);
 
         return 0;
     }
@@ -292,38 +367,24 @@ DATABENTO_API int dbento_historical_get_range_with_symbology(
         auto end_unix = NsToUnixNanos(end_time_ns);
         db::DateTimeRange<db::UnixNanos> datetime_range{start_unix, end_unix};
 
-        // Call extended timeseries API with stype parameters
-        wrapper->client->TimeseriesGetRange(
-            dataset,
-            datetime_range,
-            symbol_vec,
-            schema_enum,
-            stype_in_enum,
-            stype_out_enum,
-            limit,
-            [](const db::Metadata&) {
-                // Metadata callback - currently unused
-                return db::KeepGoing::Continue;
-            },
-            [on_record, user_data](const db::Record& record) {
-                // CRITICAL FIX: Copy record data as required by databento-cpp API
-                // databento-cpp documentation: "The reference passed to record_callback is only valid
-                // during the callback. Copy the record or particular fields to persist data between calls."
-                size_t length = record.Size();
-                uint8_t type = static_cast<uint8_t>(record.RType());
-
-                // Use thread-local buffer pool to avoid repeated allocations
-                thread_local std::vector<uint8_t> buffer;
-                if (buffer.size() < length) {
-                    buffer.resize(length * 2);  // Over-allocate to reduce future resizes
-                }
-                std::memcpy(buffer.data(), &record.Header(), length);
-
-                // Pass the copied data to .NET callback
-                on_record(buffer.data(), length, type, user_data);
-                return db::KeepGoing::Continue;
-            }
-        );
+        // Call extended timeseries API with stype parameters (pipelined, see RunPipelinedRange)
+        db::Historical* client = wrapper->client.get();
+        RunPipelinedRange([&](const db::RecordCallback& handle_record) {
+            client->TimeseriesGetRange(
+                dataset,
+                datetime_range,
+                symbol_vec,
+                schema_enum,
+                stype_in_enum,
+                stype_out_enum,
+                limit,
+                [](const db::Metadata&) {
+                    // Metadata callback - currently unused
+                    return db::KeepGoing::Continue;
+                },
+                handle_record
+            );
+        }, PipelineRingCapacity(limit), on_record, user_data);
 
         return 0;
     }
@@ -404,6 +465,407 @@ DATABENTO_API int dbento_historical_get_range_to_file_with_symbology(
     }
 }
 
+// ============================================================================
+// Chunked (Resumable, Parallel) Range-to-File Download
+// ============================================================================
+
+namespace {
+
+constexpr int64_t kDefaultChunkDurationNs = 86400LL * 1000000000LL;        // 1 day
+constexpr int64_t kMinChunkDurationNs = 60LL * 1000000000LL;               // 1 minute
+constexpr int64_t kMaxChunkDurationNs = 366LL * 86400LL * 1000000000LL;    // 1 year
+constexpr size_t kMaxChunkCount = 100000;
+constexpr int kDefaultChunkParallelism = 4;
+constexpr int kMaxChunkParallelism = 32;
+constexpr int kChunkManifestVersion = 1;
+
+struct ChunkEntry {
+    int64_t start_ns;
+    int64_t end_ns;
+    std::string file_name;
+    bool complete;
+};
+
+/**
+ * Split [start_ns, end_ns) into chunks whose boundaries are multiples of chunk_ns
+ * since the Unix epoch, so daily chunks line up with UTC midnight and a re-run
+ * of the same request always produces the same chunk list
+ */
+std::vector<ChunkEntry> PlanChunks(int64_t start_ns, int64_t end_ns, int64_t chunk_ns) {
+    std::vector<ChunkEntry> chunks;
+    int64_t cursor = start_ns;
+    while (cursor < end_ns) {
+        if (chunks.size() >= kMaxChunkCount) {
+            throw std::invalid_argument("Chunked download exceeds maximum of " +
+                std::to_string(kMaxChunkCount) + " chunks; use a larger chunk duration");
+        }
+        int64_t chunk_end = std::min((cursor / chunk_ns + 1) * chunk_ns, end_ns);
+        char name[32];
+        std::snprintf(name, sizeof(name), "chunk-%05zu.dbn.zst", chunks.size());
+        chunks.push_back(ChunkEntry{cursor, chunk_end, name, false});
+        cursor = chunk_end;
+    }
+    return chunks;
+}
+
+/**
+ * Manifest recording which chunks of a download have completed.
+ * Persisted as JSON next to the chunk files and rewritten atomically
+ * (write to temp file, then rename) after every completed chunk.
+ */
+class ChunkManifest {
+public:
+    ChunkManifest(std::filesystem::path path, json request, std::vector<ChunkEntry> chunks)
+        : path_(std::move(path)), request_(std::move(request)), chunks_(std::move(chunks)) {}
+
+    /**
+     * Load completion state from an existing manifest, if any
+     * @throws std::runtime_error if the manifest belongs to a different request
+     */
+    void LoadExisting(const std::filesystem::path& chunk_dir) {
+        if (!std::filesystem::exists(path_)) {
+            return;
+        }
+
+        std::ifstream in(path_);
+        json j = json::parse(in);
+        if (j.value("version", 0) != kChunkManifestVersion || j["request"] != request_) {
+            throw std::runtime_error("Existing chunk manifest " + path_.string() +
+                " was created for a different request; delete it or choose another output path");
+        }
+
+        std::set<std::string> completed;
+        for (const auto& chunk : j["chunks"]) {
+            if (chunk["complete"].get<bool>()) {
+                completed.insert(chunk["file"].get<std::string>());
+            }
+        }
+
+        // Only trust completion flags whose chunk file actually survived
+        for (auto& chunk : chunks_) {
+            chunk.complete = completed.count(chunk.file_name) > 0 &&
+                std::filesystem::exists(chunk_dir / chunk.file_name);
+        }
+    }
+
+    void MarkComplete(size_t index) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        chunks_[index].complete = true;
+        SaveLocked();
+    }
+
+    void Save() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        SaveLocked();
+    }
+
+    const std::vector<ChunkEntry>& Chunks() const { return chunks_; }
+
+private:
+    void SaveLocked() {
+        json j;
+        j["version"] = kChunkManifestVersion;
+        j["request"] = request_;
+        json chunks_array = json::array();
+        for (const auto& chunk : chunks_) {
+            chunks_array.push_back({
+                {"start", chunk.start_ns},
+                {"end", chunk.end_ns},
+                {"file", chunk.file_name},
+                {"complete", chunk.complete}
+            });
+        }
+        j["chunks"] = chunks_array;
+
+        auto tmp_path = path_;
+        tmp_path += ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::trunc);
+            out << j.dump(2);
+            if (!out) {
+                throw std::runtime_error("Failed to write chunk manifest: " + tmp_path.string());
+            }
+        }
+        std::filesystem::rename(tmp_path, path_);
+    }
+
+    std::filesystem::path path_;
+    json request_;
+    std::vector<ChunkEntry> chunks_;
+    std::mutex mutex_;
+};
+
+/**
+ * Merge per-chunk metadata into metadata describing the whole range.
+ * Mapping intervals are appended in chunk order and coalesced where a symbol
+ * continues across a chunk boundary; a symbol is only not_found overall if no
+ * chunk resolved it.
+ */
+db::Metadata MergeChunkMetadata(const std::vector<db::Metadata>& parts,
+                                int64_t start_ns, int64_t end_ns) {
+    db::Metadata merged = parts.front();
+    merged.start = NsToUnixNanos(start_ns);
+    merged.end = NsToUnixNanos(end_ns);
+    merged.limit = 0;
+
+    std::vector<std::string> mapping_order;
+    std::map<std::string, std::vector<db::MappingInterval>> intervals_by_symbol;
+    std::map<std::string, size_t> not_found_counts;
+    std::set<std::string> partial;
+
+    for (const auto& part : parts) {
+        for (const auto& mapping : part.mappings) {
+            auto [it, inserted] = intervals_by_symbol.try_emplace(mapping.raw_symbol);
+            if (inserted) {
+                mapping_order.push_back(mapping.raw_symbol);
+            }
+            auto& intervals = it->second;
+            for (const auto& interval : mapping.intervals) {
+                if (!intervals.empty() && intervals.back().symbol == interval.symbol &&
+                    intervals.back().end_date == interval.start_date) {
+                    intervals.back().end_date = interval.end_date;
+                } else {
+                    intervals.push_back(interval);
+                }
+            }
+        }
+        for (const auto& symbol : part.not_found) {
+            ++not_found_counts[symbol];
+        }
+        partial.insert(part.partial.begin(), part.partial.end());
+    }
+
+    merged.mappings.clear();
+    for (const auto& raw_symbol : mapping_order) {
+        db::SymbolMapping mapping;
+        mapping.raw_symbol = raw_symbol;
+        mapping.intervals = std::move(intervals_by_symbol[raw_symbol]);
+        merged.mappings.push_back(std::move(mapping));
+    }
+
+    merged.not_found.clear();
+    for (const auto& [symbol, count] : not_found_counts) {
+        if (count == parts.size()) {
+            merged.not_found.push_back(symbol);
+        } else {
+            partial.insert(symbol);
+        }
+    }
+    merged.partial.assign(partial.begin(), partial.end());
+
+    return merged;
+}
+
+/**
+ * Decode all chunk files in order and re-encode them as a single zstd-compressed
+ * DBN file. Writes to a temporary path and renames on success so a failed
+ * concatenation never leaves a truncated output file behind.
+ */
+void ConcatenateChunks(db::ILogReceiver* log_receiver,
+                       const std::vector<std::filesystem::path>& chunk_paths,
+                       const std::filesystem::path& output_path,
+                       int64_t start_ns, int64_t end_ns) {
+    std::vector<db::Metadata> parts;
+    parts.reserve(chunk_paths.size());
+    for (const auto& chunk_path : chunk_paths) {
+        db::DbnFileStore store{log_receiver, chunk_path, db::VersionUpgradePolicy::AsIs};
+        parts.push_back(store.GetMetadata());
+    }
+
+    auto tmp_path = output_path;
+    tmp_path += ".tmp";
+    {
+        db::OutFileStream out_stream{tmp_path};
+        db::detail::ZstdCompressStream zstd_stream{&out_stream};
+        db::DbnEncoder encoder{MergeChunkMetadata(parts, start_ns, end_ns), &zstd_stream};
+
+        for (const auto& chunk_path : chunk_paths) {
+            db::DbnFileStore store{log_receiver, chunk_path, db::VersionUpgradePolicy::AsIs};
+            while (const db::Record* record = store.NextRecord()) {
+                encoder.EncodeRecord(*record);
+            }
+        }
+    }
+    std::filesystem::rename(tmp_path, output_path);
+}
+
+}  // namespace
+
+DATABENTO_API int dbento_historical_get_range_to_file_chunked(
+    DbentoHistoricalClientHandle handle,
+    const char* file_path,
+    const char* dataset,
+    const char* schema,
+    const char** symbols,
+    size_t symbol_count,
+    int64_t start_time_ns,
+    int64_t end_time_ns,
+    const char* stype_in,
+    const char* stype_out,
+    int64_t chunk_duration_ns,
+    int max_parallel,
+    int concatenate,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
+            handle, databento_native::HandleType::HistoricalClient, &validation_error);
+        if (!wrapper || !wrapper->client) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!file_path || !dataset || !schema) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        ValidateSymbolArray(symbols, symbol_count);
+        ValidateTimeRange(start_time_ns, end_time_ns);
+
+        if (chunk_duration_ns <= 0) {
+            chunk_duration_ns = kDefaultChunkDurationNs;
+        }
+        if (chunk_duration_ns < kMinChunkDurationNs || chunk_duration_ns > kMaxChunkDurationNs) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Chunk duration must be between 1 minute and 366 days");
+            return -2;
+        }
+        if (max_parallel <= 0) {
+            max_parallel = kDefaultChunkParallelism;
+        }
+        max_parallel = std::min(max_parallel, kMaxChunkParallelism);
+
+        // Convert symbols to vector
+        std::vector<std::string> symbol_vec;
+        for (size_t i = 0; i < symbol_count; ++i) {
+            symbol_vec.emplace_back(symbols[i]);
+        }
+
+        db::Schema schema_enum = ParseSchema(schema);
+        std::string stype_in_str = stype_in ? stype_in : "raw_symbol";
+        std::string stype_out_str = stype_out ? stype_out : "instrument_id";
+        db::SType stype_in_enum = ParseSType(stype_in_str);
+        db::SType stype_out_enum = ParseSType(stype_out_str);
+
+        // Validates both bounds before any chunk is planned
+        NsToUnixNanos(start_time_ns);
+        NsToUnixNanos(end_time_ns);
+
+        std::filesystem::path output_path{file_path};
+        std::filesystem::path chunk_dir = output_path;
+        chunk_dir += ".chunks";
+        std::filesystem::create_directories(chunk_dir);
+
+        // The request fingerprint ties the manifest to exactly this download
+        json request = {
+            {"dataset", dataset},
+            {"schema", schema},
+            {"symbols", symbol_vec},
+            {"stype_in", stype_in_str},
+            {"stype_out", stype_out_str},
+            {"start", start_time_ns},
+            {"end", end_time_ns},
+            {"chunk_duration_ns", chunk_duration_ns}
+        };
+        ChunkManifest manifest{chunk_dir / "manifest.json", request,
+            PlanChunks(start_time_ns, end_time_ns, chunk_duration_ns)};
+        manifest.LoadExisting(chunk_dir);
+        manifest.Save();
+
+        std::vector<size_t> pending;
+        for (size_t i = 0; i < manifest.Chunks().size(); ++i) {
+            if (!manifest.Chunks()[i].complete) {
+                pending.push_back(i);
+            }
+        }
+
+        std::atomic<size_t> next_pending{0};
+        std::mutex error_mutex;
+        std::string first_error;
+
+        // Each worker owns its own Historical client: the underlying HTTP client
+        // is not safe for concurrent requests
+        auto worker = [&]() {
+            std::unique_ptr<db::Historical> client;
+            try {
+                client = std::make_unique<db::Historical>(
+                    wrapper->log_receiver.get(), wrapper->api_key, db::HistoricalGateway::Bo1);
+            }
+            catch (const std::exception& e) {
+                std::lock_guard<std::mutex> lock(error_mutex);
+                if (first_error.empty()) first_error = e.what();
+                return;
+            }
+
+            for (size_t i = next_pending.fetch_add(1); i < pending.size(); i = next_pending.fetch_add(1)) {
+                const ChunkEntry chunk = manifest.Chunks()[pending[i]];
+                std::filesystem::path part_path = chunk_dir / (chunk.file_name + ".part");
+                try {
+                    db::DateTimeRange<db::UnixNanos> chunk_range{
+                        NsToUnixNanos(chunk.start_ns), NsToUnixNanos(chunk.end_ns)};
+                    client->TimeseriesGetRangeToFile(
+                        dataset, chunk_range, symbol_vec, schema_enum,
+                        stype_in_enum, stype_out_enum, 0, part_path);
+                    std::filesystem::rename(part_path, chunk_dir / chunk.file_name);
+                    manifest.MarkComplete(pending[i]);
+                }
+                catch (const std::exception& e) {
+                    std::error_code ec;
+                    std::filesystem::remove(part_path, ec);
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    if (first_error.empty()) first_error = e.what();
+                }
+            }
+        };
+
+        size_t thread_count = std::min(pending.size(), static_cast<size_t>(max_parallel));
+        std::vector<std::thread> threads;
+        threads.reserve(thread_count);
+        for (size_t t = 0; t < thread_count; ++t) {
+            threads.emplace_back(worker);
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        size_t incomplete = 0;
+        for (const auto& chunk : manifest.Chunks()) {
+            if (!chunk.complete) ++incomplete;
+        }
+        if (incomplete > 0) {
+            std::string message = std::to_string(incomplete) + " of " +
+                std::to_string(manifest.Chunks().size()) +
+                " chunks failed to download; re-run the same request to resume";
+            if (!first_error.empty()) {
+                message += ". First error: " + first_error;
+            }
+            SafeStrCopy(error_buffer, error_buffer_size, message.c_str());
+            return -1;
+        }
+
+        if (concatenate && !manifest.Chunks().empty()) {
+            std::vector<std::filesystem::path> chunk_paths;
+            for (const auto& chunk : manifest.Chunks()) {
+                chunk_paths.push_back(chunk_dir / chunk.file_name);
+            }
+            ConcatenateChunks(wrapper->log_receiver.get(), chunk_paths, output_path, start_time_ns, end_time_ns);
+
+            // Chunks are redundant once the combined file exists
+            std::error_code ec;
+            std::filesystem::remove_all(chunk_dir, ec);
+        }
+
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
 DATABENTO_API DbentoMetadataHandle dbento_historical_get_metadata(
     DbentoHistoricalClientHandle handle,
     const char* dataset,
@@ -549,6 +1011,8 @@ DATABENTO_API void dbento_metadata_destroy(DbentoMetadataHandle handle)
 
 struct SymbologyResolutionWrapper {
     db::SymbologyResolution resolution;
+    std::vector<uint8_t> exported;  // Lazily built by dbento_symbology_resolution_export
+    std::mutex export_mutex;
 
     explicit SymbologyResolutionWrapper(db::SymbologyResolution&& res)
         : resolution(std::move(res)) {}
@@ -617,6 +1081,142 @@ DATABENTO_API DbentoSymbologyResolutionHandle dbento_historical_symbology_resolv
     }
 }
 
+// Symbols per request when filling cache gaps (symbology.resolve accepts up to 2000)
+static constexpr size_t kMaxSymbolsPerResolve = 2000;
+
+// Serializes access to the on-disk symbology cache within this process (not held while
+// fetching from the API)
+static std::mutex g_symbology_cache_mutex;
+
+DATABENTO_API DbentoSymbologyResolutionHandle dbento_historical_symbology_resolve_cached(
+    DbentoHistoricalClientHandle handle,
+    const char* dataset,
+    const char** symbols,
+    size_t symbol_count,
+    const char* stype_in,
+    const char* stype_out,
+    const char* start_date,
+    const char* end_date,
+    const char* cache_dir,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<HistoricalClientWrapper>(
+            handle, databento_native::HandleType::HistoricalClient, &validation_error);
+        if (!wrapper || !wrapper->client) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return nullptr;
+        }
+
+        if (!dataset || !stype_in || !stype_out || !start_date || !end_date || !cache_dir) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return nullptr;
+        }
+
+        ValidateNonEmptyString("dataset", dataset);
+        ValidateNonEmptyString("cache_dir", cache_dir);
+        ValidateSymbolArray(symbols, symbol_count);
+
+        db::SType stype_in_enum = ParseSType(stype_in);
+        db::SType stype_out_enum = ParseSType(stype_out);
+
+        databento_native::DayNumber start_day = databento_native::ParseIsoDate(start_date);
+        databento_native::DayNumber end_day = databento_native::ParseIsoDate(end_date);
+        if (end_day <= start_day) {
+            SafeStrCopy(error_buffer, error_buffer_size, "end_date must be after start_date");
+            return nullptr;
+        }
+
+        // De-duplicate while keeping the caller's order
+        std::vector<std::string> symbol_vec;
+        std::set<std::string> seen;
+        for (size_t i = 0; i < symbol_count; ++i) {
+            if (seen.insert(symbols[i]).second) {
+                symbol_vec.emplace_back(symbols[i]);
+            }
+        }
+
+        // ALL_SYMBOLS expands server-side, so there is no per-symbol entry to cache
+        if (seen.count("ALL_SYMBOLS")) {
+            auto resolution = wrapper->client->SymbologyResolve(
+                dataset, symbol_vec, stype_in_enum, stype_out_enum, db::DateRange{start_date, end_date});
+            auto* res_wrapper = new SymbologyResolutionWrapper(std::move(resolution));
+            return reinterpret_cast<DbentoSymbologyResolutionHandle>(
+                databento_native::CreateValidatedHandle(databento_native::HandleType::SymbologyResolution, res_wrapper));
+        }
+
+        databento_native::SymbologyCacheFile cache(
+            cache_dir, databento_native::MetadataCache::Fingerprint(wrapper->api_key),
+            dataset, stype_in, stype_out);
+
+        // Group symbols by the date gap they are missing so each gap is one request
+        std::map<std::pair<databento_native::DayNumber, databento_native::DayNumber>,
+                 std::vector<std::string>> gaps;
+        {
+            std::lock_guard<std::mutex> lock(g_symbology_cache_mutex);
+            cache.Load();
+            for (const auto& symbol : symbol_vec) {
+                for (const auto& gap : cache.MissingRanges(symbol, start_day, end_day)) {
+                    gaps[gap].push_back(symbol);
+                }
+            }
+        }
+
+        struct Fetched {
+            std::pair<databento_native::DayNumber, databento_native::DayNumber> gap;
+            std::vector<std::string> symbols;
+            db::SymbologyResolution resolution;
+        };
+        std::vector<Fetched> fetched;
+        for (const auto& [gap, gap_symbols] : gaps) {
+            db::DateRange gap_range{
+                databento_native::FormatIsoDate(gap.first),
+                databento_native::FormatIsoDate(gap.second)};
+            for (size_t offset = 0; offset < gap_symbols.size(); offset += kMaxSymbolsPerResolve) {
+                size_t count = std::min(kMaxSymbolsPerResolve, gap_symbols.size() - offset);
+                std::vector<std::string> batch(
+                    gap_symbols.begin() + static_cast<std::ptrdiff_t>(offset),
+                    gap_symbols.begin() + static_cast<std::ptrdiff_t>(offset + count));
+
+                auto resolution = wrapper->client->SymbologyResolve(
+                    dataset, batch, stype_in_enum, stype_out_enum, gap_range);
+                fetched.push_back(Fetched{gap, std::move(batch), std::move(resolution)});
+            }
+        }
+
+        if (!fetched.empty()) {
+            // Reload to keep what other requests saved meanwhile, then merge and save
+            std::lock_guard<std::mutex> lock(g_symbology_cache_mutex);
+            cache.Load();
+            const databento_native::DayNumber complete_end = databento_native::CurrentUtcDay();
+            for (const auto& part : fetched) {
+                for (const auto& symbol : part.symbols) {
+                    cache.AddResolution(symbol, part.resolution, part.gap.first, part.gap.second, complete_end);
+                }
+            }
+            cache.Save();
+        }
+
+        db::SymbologyResolution result{};
+        result.stype_in = stype_in_enum;
+        result.stype_out = stype_out_enum;
+        for (const auto& symbol : symbol_vec) {
+            cache.Compose(symbol, start_day, end_day, result);
+        }
+
+        auto* res_wrapper = new SymbologyResolutionWrapper(std::move(result));
+        return reinterpret_cast<DbentoSymbologyResolutionHandle>(
+            databento_native::CreateValidatedHandle(databento_native::HandleType::SymbologyResolution, res_wrapper));
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return nullptr;
+    }
+}
+
 DATABENTO_API size_t dbento_symbology_resolution_mappings_count(
     DbentoSymbologyResolutionHandle handle)
 {
@@ -835,6 +1435,138 @@ DATABENTO_API int dbento_symbology_resolution_get_stype_out(
     }
 }
 
+namespace {
+
+// The managed reader decodes these layouts by fixed offsets
+static_assert(sizeof(DbentoStringRef) == 8, "DbentoStringRef layout changed");
+static_assert(sizeof(DbentoSymbologyMappingEntry) == 16, "DbentoSymbologyMappingEntry layout changed");
+static_assert(sizeof(DbentoSymbologyIntervalEntry) == 16, "DbentoSymbologyIntervalEntry layout changed");
+static_assert(sizeof(DbentoSymbologyExportHeader) == 52, "DbentoSymbologyExportHeader layout changed");
+
+int32_t ToYyyymmdd(const date::year_month_day& ymd) {
+    return static_cast<int32_t>(ymd.year()) * 10000 +
+           static_cast<int32_t>(static_cast<unsigned>(ymd.month())) * 100 +
+           static_cast<int32_t>(static_cast<unsigned>(ymd.day()));
+}
+
+/**
+ * Serialize a resolution into the DbentoSymbologyExportHeader layout
+ */
+std::vector<uint8_t> BuildSymbologyExport(const db::SymbologyResolution& resolution) {
+    std::string strings;
+    auto add_string = [&strings](const std::string& value) {
+        DbentoStringRef ref{static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(value.size())};
+        strings.append(value);
+        return ref;
+    };
+
+    std::vector<DbentoSymbologyMappingEntry> mappings;
+    std::vector<DbentoSymbologyIntervalEntry> intervals;
+    mappings.reserve(resolution.mappings.size());
+    for (const auto& [key, key_intervals] : resolution.mappings) {
+        DbentoSymbologyMappingEntry entry{};
+        entry.key = add_string(key);
+        entry.first_interval = static_cast<uint32_t>(intervals.size());
+        entry.interval_count = static_cast<uint32_t>(key_intervals.size());
+        for (const auto& interval : key_intervals) {
+            DbentoSymbologyIntervalEntry out{};
+            out.start_date = ToYyyymmdd(interval.start_date);
+            out.end_date = ToYyyymmdd(interval.end_date);
+            out.symbol = add_string(interval.symbol);
+            intervals.push_back(out);
+        }
+        mappings.push_back(entry);
+    }
+
+    std::vector<DbentoStringRef> partial;
+    partial.reserve(resolution.partial.size());
+    for (const auto& symbol : resolution.partial) {
+        partial.push_back(add_string(symbol));
+    }
+    std::vector<DbentoStringRef> not_found;
+    not_found.reserve(resolution.not_found.size());
+    for (const auto& symbol : resolution.not_found) {
+        not_found.push_back(add_string(symbol));
+    }
+
+    auto align4 = [](size_t n) { return (n + 3) & ~static_cast<size_t>(3); };
+    DbentoSymbologyExportHeader header{};
+    size_t offset = sizeof(header);
+    header.mappings_offset = static_cast<uint32_t>(offset);
+    offset += mappings.size() * sizeof(DbentoSymbologyMappingEntry);
+    header.intervals_offset = static_cast<uint32_t>(offset);
+    offset += intervals.size() * sizeof(DbentoSymbologyIntervalEntry);
+    header.partial_offset = static_cast<uint32_t>(offset);
+    offset += partial.size() * sizeof(DbentoStringRef);
+    header.not_found_offset = static_cast<uint32_t>(offset);
+    offset += not_found.size() * sizeof(DbentoStringRef);
+    header.strings_offset = static_cast<uint32_t>(offset);
+    offset = align4(offset + strings.size());
+
+    if (offset > UINT32_MAX) {
+        throw std::length_error("Symbology resolution too large to export");
+    }
+
+    header.total_size = static_cast<uint32_t>(offset);
+    header.stype_in = static_cast<int32_t>(resolution.stype_in);
+    header.stype_out = static_cast<int32_t>(resolution.stype_out);
+    header.mapping_count = static_cast<uint32_t>(mappings.size());
+    header.interval_count = static_cast<uint32_t>(intervals.size());
+    header.partial_count = static_cast<uint32_t>(partial.size());
+    header.not_found_count = static_cast<uint32_t>(not_found.size());
+    header.strings_size = static_cast<uint32_t>(strings.size());
+
+    std::vector<uint8_t> out(offset, 0);
+    auto copy_at = [&out](size_t at, const void* src, size_t len) {
+        if (len > 0) {
+            std::memcpy(out.data() + at, src, len);
+        }
+    };
+    copy_at(0, &header, sizeof(header));
+    copy_at(header.mappings_offset, mappings.data(), mappings.size() * sizeof(DbentoSymbologyMappingEntry));
+    copy_at(header.intervals_offset, intervals.data(), intervals.size() * sizeof(DbentoSymbologyIntervalEntry));
+    copy_at(header.partial_offset, partial.data(), partial.size() * sizeof(DbentoStringRef));
+    copy_at(header.not_found_offset, not_found.data(), not_found.size() * sizeof(DbentoStringRef));
+    copy_at(header.strings_offset, strings.data(), strings.size());
+    return out;
+}
+
+}  // namespace
+
+DATABENTO_API int dbento_symbology_resolution_export(
+    DbentoSymbologyResolutionHandle handle,
+    uint8_t* buffer,
+    size_t buffer_size,
+    size_t* out_required_size)
+{
+    try {
+        auto* wrapper = databento_native::ValidateAndCast<SymbologyResolutionWrapper>(
+            handle, databento_native::HandleType::SymbologyResolution, nullptr);
+        if (!wrapper || !out_required_size) {
+            return -1;
+        }
+
+        std::lock_guard<std::mutex> lock(wrapper->export_mutex);
+        if (wrapper->exported.empty()) {
+            wrapper->exported = BuildSymbologyExport(wrapper->resolution);
+        }
+
+        *out_required_size = wrapper->exported.size();
+        if (!buffer) {
+            return 0;
+        }
+        if (buffer_size < wrapper->exported.size()) {
+            return -3;
+        }
+
+        std::memcpy(buffer, wrapper->exported.data(), wrapper->exported.size());
+        return 0;
+    }
+    catch (...) {
+        return -1;
+    }
+}
+
 DATABENTO_API void dbento_symbology_resolution_destroy(
     DbentoSymbologyResolutionHandle handle)
 {
@@ -1027,6 +1759,12 @@ DATABENTO_API const char* dbento_metadata_list_datasets(
             return nullptr;
         }
 
+        auto& cache = MetadataCache::Instance();
+        const std::string cache_key = MetadataCache::MakeKey(wrapper->api_key, {"list_datasets"});
+        if (auto cached = cache.Get(cache_key)) {
+            return AllocateString(*cached);
+        }
+
         // Call databento-cpp method
         // Note: The databento-cpp MetadataListDatasets() method returns all datasets
         // The venue parameter is currently not supported by the underlying C++ API
@@ -1040,6 +1778,7 @@ DATABENTO_API const char* dbento_metadata_list_datasets(
         }
 
         std::string json_str = j.dump();
+        cache.Put(cache_key, json_str);
         return AllocateString(json_str);
     }
     catch (const std::exception& e) {
@@ -1063,6 +1802,12 @@ DATABENTO_API const char* dbento_metadata_list_publishers(
             return nullptr;
         }
 
+        auto& cache = MetadataCache::Instance();
+        const std::string cache_key = MetadataCache::MakeKey(wrapper->api_key, {"list_publishers"});
+        if (auto cached = cache.Get(cache_key)) {
+            return AllocateString(*cached);
+        }
+
         // Call databento-cpp method
         auto publishers = wrapper->client->MetadataListPublishers();
 
@@ -1078,6 +1823,7 @@ DATABENTO_API const char* dbento_metadata_list_publishers(
         }
 
         std::string json_str = j.dump();
+        cache.Put(cache_key, json_str);
         return AllocateString(json_str);
     }
     catch (const std::exception& e) {
@@ -1107,6 +1853,12 @@ DATABENTO_API const char* dbento_metadata_list_schemas(
             return nullptr;
         }
 
+        auto& cache = MetadataCache::Instance();
+        const std::string cache_key = MetadataCache::MakeKey(wrapper->api_key, {"list_schemas", dataset});
+        if (auto cached = cache.Get(cache_key)) {
+            return AllocateString(*cached);
+        }
+
         // Call databento-cpp method
         auto schemas = wrapper->client->MetadataListSchemas(dataset);
 
@@ -1117,6 +1869,7 @@ DATABENTO_API const char* dbento_metadata_list_schemas(
         }
 
         std::string json_str = j.dump();
+        cache.Put(cache_key, json_str);
         return AllocateString(json_str);
     }
     catch (const std::exception& e) {
@@ -1173,6 +1926,12 @@ DATABENTO_API const char* dbento_metadata_list_fields(
             return nullptr;
         }
 
+        auto& cache = MetadataCache::Instance();
+        const std::string cache_key = MetadataCache::MakeKey(wrapper->api_key, {"list_fields", encoding, schema});
+        if (auto cached = cache.Get(cache_key)) {
+            return AllocateString(*cached);
+        }
+
         // Call databento-cpp method
         auto fields = wrapper->client->MetadataListFields(enc, parsed_schema);
 
@@ -1187,6 +1946,7 @@ DATABENTO_API const char* dbento_metadata_list_fields(
         }
 
         std::string json_str = j.dump();
+        cache.Put(cache_key, json_str);
         return AllocateString(json_str);
     }
     catch (const std::exception& e) {
@@ -1213,6 +1973,12 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition(
 
         ValidateNonEmptyString("dataset", dataset);
 
+        auto& cache = MetadataCache::Instance();
+        const std::string cache_key = MetadataCache::MakeKey(wrapper->api_key, {"get_dataset_condition", dataset});
+        if (auto cached = cache.Get(cache_key)) {
+            return AllocateString(*cached);
+        }
+
         std::vector<db::DatasetConditionDetail> conditions =
             wrapper->client->MetadataGetDatasetCondition(dataset);
 
@@ -1237,6 +2003,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition(
         }
 
         std::string json_str = j.dump();
+        cache.Put(cache_key, json_str);
         return AllocateString(json_str);
     }
     catch (const std::exception& e) {
@@ -1266,6 +2033,12 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition_with_date_range(
         ValidateNonEmptyString("dataset", dataset);
         ValidateNonEmptyString("start_date", start_date);
 
+        auto& cache = MetadataCache::Instance();
+        const std::string cache_key = MetadataCache::MakeKey(wrapper->api_key, {"get_dataset_condition", dataset, start_date, end_date ? end_date : ""});
+        if (auto cached = cache.Get(cache_key)) {
+            return AllocateString(*cached);
+        }
+
         // Create DateRange - if end_date is nullptr or empty, create with just start
         // Call databento-cpp method with date range
         std::vector<db::DatasetConditionDetail> conditions;
@@ -1297,6 +2070,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_condition_with_date_range(
         }
 
         std::string json_str = j.dump();
+        cache.Put(cache_key, json_str);
         return AllocateString(json_str);
     }
     catch (const std::exception& e) {
@@ -1323,6 +2097,12 @@ DATABENTO_API const char* dbento_metadata_get_dataset_range(
 
         ValidateNonEmptyString("dataset", dataset);
 
+        auto& cache = MetadataCache::Instance();
+        const std::string cache_key = MetadataCache::MakeKey(wrapper->api_key, {"get_dataset_range", dataset});
+        if (auto cached = cache.Get(cache_key)) {
+            return AllocateString(*cached);
+        }
+
         db::DatasetRange range = wrapper->client->MetadataGetDatasetRange(dataset);
 
         // Convert to JSON - match C# DatasetRange properties
@@ -1348,6 +2128,7 @@ DATABENTO_API const char* dbento_metadata_get_dataset_range(
         }
 
         std::string json_str = j.dump();
+        cache.Put(cache_key, json_str);
         return AllocateString(json_str);
     }
     catch (const std::exception& e) {
@@ -1588,3 +2369,42 @@ DATABENTO_API const char* dbento_metadata_get_billing_info(
         return nullptr;
     }
 }
+
+// ============================================================================
+// Metadata Response Cache
+// ============================================================================
+
+DATABENTO_API int dbento_metadata_cache_configure(
+    int64_t ttl_seconds,
+    const char* snapshot_path,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        if (ttl_seconds < 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "TTL cannot be negative");
+            return -2;
+        }
+
+        MetadataCache::Instance().Configure(
+            std::chrono::seconds(ttl_seconds),
+            (snapshot_path && snapshot_path[0] != '\0')
+                ? std::filesystem::path(snapshot_path)
+                : std::filesystem::path());
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
+DATABENTO_API void dbento_metadata_cache_clear(void)
+{
+    try {
+        MetadataCache::Instance().Clear();
+    }
+    catch (...) {
+        // Ignore errors in clear
+    }
+}
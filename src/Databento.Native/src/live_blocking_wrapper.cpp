@@ -2,6 +2,7 @@
 #include "databento_native.h"
 #include "common_helpers.hpp"
 #include "handle_validation.hpp"
+#include "arrow_c_data.hpp"
 #include <databento/live_blocking.hpp>
 #include <databento/live.hpp>
 #include <databento/record.hpp>
@@ -435,6 +436,57 @@ DATABENTO_API int dbento_live_blocking_next_record(
     }
 }
 
+DATABENTO_API int dbento_live_blocking_next_arrow(
+    DbentoLiveClientHandle handle,
+    DbentoArrowBuilderHandle builder,
+    size_t max_rows,
+    int timeout_ms,
+    size_t* rows_added,
+    char* error_buffer,
+    size_t error_buffer_size)
+{
+    try {
+        databento_native::ValidationError validation_error;
+        auto* wrapper = databento_native::ValidateAndCast<LiveBlockingWrapper>(
+            handle, databento_native::HandleType::LiveBlocking, &validation_error);
+        if (!wrapper || !wrapper->client) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                wrapper ? "Client not initialized" : databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+        auto* arrow_builder = databento_native::ValidateAndCast<databento_native::ArrowBatchBuilder>(
+            builder, databento_native::HandleType::ArrowBuilder, &validation_error);
+        if (!arrow_builder) {
+            SafeStrCopy(error_buffer, error_buffer_size,
+                databento_native::GetValidationErrorMessage(validation_error));
+            return -1;
+        }
+
+        if (!rows_added || max_rows == 0) {
+            SafeStrCopy(error_buffer, error_buffer_size, "Invalid parameters");
+            return -2;
+        }
+
+        // Records go from the client's buffer straight into the columns
+        *rows_added = 0;
+        while (*rows_added < max_rows) {
+            const db::Record* record = timeout_ms < 0
+                ? &wrapper->client->NextRecord()
+                : wrapper->client->NextRecord(std::chrono::milliseconds(timeout_ms));
+            if (!record) {
+                return *rows_added > 0 ? 0 : 1;  // Timeout: 1 only if nothing was added
+            }
+            *rows_added += arrow_builder->Append(
+                reinterpret_cast<const uint8_t*>(&record->Header()), record->Size());
+        }
+        return 0;
+    }
+    catch (const std::exception& e) {
+        SafeStrCopy(error_buffer, error_buffer_size, e.what());
+        return -1;
+    }
+}
+
 DATABENTO_API int dbento_live_blocking_reconnect(
     DbentoLiveClientHandle handle,
     char* error_buffer,
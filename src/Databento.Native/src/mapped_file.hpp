@@ -0,0 +1,226 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+    #ifndef WIN32_LEAN_AND_MEAN
+        #define WIN32_LEAN_AND_MEAN
+    #endif
+    #ifndef NOMINMAX
+        #define NOMINMAX
+    #endif
+    #include <windows.h>
+#else
+    #include <cerrno>
+    #include <cstring>
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace databento_native {
+
+/**
+ * Read-only memory mapping of a whole file
+ *
+ * Used by the zero-copy DBN reader: records are read in place from the mapping instead of
+ * through buffered stream reads. Sequential() hints the kernel to read ahead aggressively
+ * and drop pages behind the cursor (madvise on POSIX; on Windows the file is opened with
+ * FILE_FLAG_SEQUENTIAL_SCAN instead).
+ *
+ * The same interface also covers a file the caller opened (FromDescriptor) and memory the
+ * caller already holds (View), so in-place readers work over either.
+ */
+class MappedFile {
+public:
+    explicit MappedFile(const std::filesystem::path& path) {
+#ifdef _WIN32
+        file_ = ::CreateFileW(path.wstring().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (file_ == INVALID_HANDLE_VALUE) {
+            throw std::runtime_error("Failed to open file for mapping: " + path.string());
+        }
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file_, &file_size)) {
+            Close();
+            throw std::runtime_error("Failed to get file size: " + path.string());
+        }
+        size_ = static_cast<size_t>(file_size.QuadPart);
+        if (size_ > 0) {
+            mapping_ = ::CreateFileMappingW(file_, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapping_) {
+                Close();
+                throw std::runtime_error("Failed to create file mapping: " + path.string());
+            }
+            data_ = static_cast<const uint8_t*>(::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, 0));
+            if (!data_) {
+                Close();
+                throw std::runtime_error("Failed to map file: " + path.string());
+            }
+        }
+#else
+        fd_ = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd_ < 0) {
+            throw std::runtime_error("Failed to open file for mapping: " + path.string() +
+                                     " (" + std::strerror(errno) + ")");
+        }
+        struct stat st;
+        if (::fstat(fd_, &st) != 0) {
+            Close();
+            throw std::runtime_error("Failed to stat file: " + path.string());
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+            if (addr == MAP_FAILED) {
+                Close();
+                throw std::runtime_error("Failed to map file: " + path.string() +
+                                         " (" + std::strerror(errno) + ")");
+            }
+            data_ = static_cast<const uint8_t*>(addr);
+        }
+#endif
+    }
+
+    /**
+     * Map a regular file the caller already opened, by POSIX file descriptor or Windows file
+     * HANDLE. The descriptor stays owned by the caller and is not retained.
+     */
+    static std::unique_ptr<MappedFile> FromDescriptor(intptr_t descriptor) {
+        std::unique_ptr<MappedFile> mapped{new MappedFile()};
+#ifdef _WIN32
+        HANDLE file = reinterpret_cast<HANDLE>(descriptor);
+        LARGE_INTEGER file_size;
+        if (!::GetFileSizeEx(file, &file_size)) {
+            throw std::runtime_error("Failed to get file size of descriptor");
+        }
+        mapped->size_ = static_cast<size_t>(file_size.QuadPart);
+        if (mapped->size_ > 0) {
+            mapped->mapping_ = ::CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (!mapped->mapping_) {
+                throw std::runtime_error("Failed to create file mapping of descriptor");
+            }
+            mapped->data_ = static_cast<const uint8_t*>(::MapViewOfFile(mapped->mapping_, FILE_MAP_READ, 0, 0, 0));
+            if (!mapped->data_) {
+                throw std::runtime_error("Failed to map descriptor");
+            }
+        }
+#else
+        const int fd = static_cast<int>(descriptor);
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            throw std::runtime_error(std::string("Failed to stat descriptor (") + std::strerror(errno) + ")");
+        }
+        mapped->size_ = static_cast<size_t>(st.st_size);
+        if (mapped->size_ > 0) {
+            void* addr = ::mmap(nullptr, mapped->size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                throw std::runtime_error(std::string("Failed to map descriptor (") + std::strerror(errno) + ")");
+            }
+            mapped->data_ = static_cast<const uint8_t*>(addr);
+        }
+#endif
+        return mapped;
+    }
+
+    /**
+     * View of memory owned elsewhere: nothing is mapped, hinted or released, and the
+     * memory must outlive the view
+     */
+    static std::unique_ptr<MappedFile> View(const uint8_t* data, size_t size) {
+        std::unique_ptr<MappedFile> view{new MappedFile()};
+        view->data_ = data;
+        view->size_ = size;
+        view->borrowed_ = true;
+        return view;
+    }
+
+    ~MappedFile() {
+        Close();
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const uint8_t* Data() const { return data_; }
+    size_t Size() const { return size_; }
+
+    /**
+     * Hint sequential access over the whole mapping (best-effort)
+     */
+    void Sequential() const {
+#ifndef _WIN32
+        if (data_ && !borrowed_) {
+            ::madvise(const_cast<uint8_t*>(data_), size_, MADV_SEQUENTIAL);
+        }
+#endif
+    }
+
+    /**
+     * Hint that [offset, offset + length) will be needed soon (best-effort)
+     */
+    void WillNeed(size_t offset, size_t length) const {
+#ifndef _WIN32
+        if (!data_ || borrowed_ || offset >= size_) {
+            return;
+        }
+        static const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        size_t aligned = offset - (offset % page_size);
+        size_t end = offset + length < size_ ? offset + length : size_;
+        ::madvise(const_cast<uint8_t*>(data_) + aligned, end - aligned, MADV_WILLNEED);
+#else
+        (void)offset;
+        (void)length;
+#endif
+    }
+
+private:
+    MappedFile() = default;
+
+    void Close() {
+        if (borrowed_) {
+            return;
+        }
+#ifdef _WIN32
+        if (data_) {
+            ::UnmapViewOfFile(data_);
+            data_ = nullptr;
+        }
+        if (mapping_) {
+            ::CloseHandle(mapping_);
+            mapping_ = nullptr;
+        }
+        if (file_ != INVALID_HANDLE_VALUE) {
+            ::CloseHandle(file_);
+            file_ = INVALID_HANDLE_VALUE;
+        }
+#else
+        if (data_) {
+            ::munmap(const_cast<uint8_t*>(data_), size_);
+            data_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ::close(fd_);
+            fd_ = -1;
+        }
+#endif
+    }
+
+#ifdef _WIN32
+    HANDLE file_ = INVALID_HANDLE_VALUE;
+    HANDLE mapping_ = nullptr;
+#else
+    int fd_ = -1;
+#endif
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    bool borrowed_ = false;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstring>
+#include <stdexcept>
+#include <databento/ireadable.hpp>
+
+namespace databento_native {
+
+/**
+ * IReadable over a caller-owned, contiguous byte range
+ *
+ * Lets databento-cpp's DbnDecoder parse DBN data that is already in memory (for example
+ * a memory-mapped file) without copying it into a stream first. The range must outlive
+ * the readable.
+ */
+class MemoryReadable : public databento::IReadable {
+public:
+    MemoryReadable(const void* data, size_t size)
+        : data_(static_cast<const std::byte*>(data))
+        , size_(size)
+    {}
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        if (length > size_ - offset_) {
+            throw std::runtime_error("Unexpected end of DBN data");
+        }
+        std::memcpy(buffer, data_ + offset_, length);
+        offset_ += length;
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        size_t count = max_length < size_ - offset_ ? max_length : size_ - offset_;
+        std::memcpy(buffer, data_ + offset_, count);
+        offset_ += count;
+        return count;
+    }
+
+    size_t Offset() const { return offset_; }
+
+private:
+    const std::byte* data_;
+    size_t size_;
+    size_t offset_ = 0;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <initializer_list>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <unordered_map>
+#include <nlohmann/json.hpp>
+
+namespace databento_native {
+
+/**
+ * Process-wide TTL cache for metadata/reference responses
+ *
+ * Values are the final JSON strings handed back across the C ABI, so a hit skips both
+ * the HTTP round trip and nlohmann serialization. Entries are keyed by a fingerprint of
+ * the API key (entitlements differ per account) plus the call name and its arguments.
+ *
+ * When a snapshot path is configured, the cache is loaded from it on Configure() and
+ * rewritten (temp file + rename) so a restarted process starts warm. Inserts only mark the
+ * cache dirty; the inserting thread writes a copy of the entries outside the cache lock, at
+ * most once per kSnapshotInterval, and any remainder is written at process exit. Lookups
+ * never wait on the filesystem. The snapshot is best-effort: a missing, stale or corrupt
+ * file just means a cold start, and a crash loses at most the last interval of inserts.
+ * Disabled (TTL 0) by default, in which case Get() always misses and Put() is a no-op.
+ */
+class MetadataCache {
+public:
+    static constexpr int kSnapshotVersion = 1;
+    static constexpr std::chrono::seconds kSnapshotInterval{2};
+
+    static MetadataCache& Instance() {
+        static MetadataCache instance;
+        return instance;
+    }
+
+    /**
+     * Set TTL and snapshot location; ttl <= 0 disables caching and drops all entries
+     * @throws std::runtime_error if the snapshot directory cannot be created
+     */
+    void Configure(std::chrono::seconds ttl, const std::filesystem::path& snapshot_path) {
+        std::lock_guard<std::mutex> save_lock(save_mutex_);
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++epoch_;
+        ttl_ = ttl;
+        snapshot_path_ = snapshot_path;
+        entries_.clear();
+        dirty_ = false;
+
+        if (ttl_.count() <= 0 || snapshot_path_.empty()) {
+            return;
+        }
+
+        if (snapshot_path_.has_parent_path()) {
+            std::error_code ec;
+            std::filesystem::create_directories(snapshot_path_.parent_path(), ec);
+            if (ec) {
+                throw std::runtime_error("Failed to create metadata cache directory: " + ec.message());
+            }
+        }
+        LoadSnapshotLocked();
+    }
+
+    /**
+     * Drop all entries from memory and from the snapshot file (configuration is kept)
+     */
+    void Clear() {
+        std::lock_guard<std::mutex> save_lock(save_mutex_);
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++epoch_;
+        entries_.clear();
+        dirty_ = false;
+        if (!snapshot_path_.empty()) {
+            std::error_code ec;
+            std::filesystem::remove(snapshot_path_, ec);
+        }
+    }
+
+    std::optional<std::string> Get(const std::string& key) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (ttl_.count() <= 0) {
+            return std::nullopt;
+        }
+        auto it = entries_.find(key);
+        if (it == entries_.end()) {
+            return std::nullopt;
+        }
+        if (NowSeconds() - it->second.stored_at >= ttl_.count()) {
+            entries_.erase(it);
+            return std::nullopt;
+        }
+        return it->second.value;
+    }
+
+    void Put(const std::string& key, const std::string& value) {
+        Snapshot snapshot;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (ttl_.count() <= 0) {
+                return;
+            }
+            const int64_t now = NowSeconds();
+            entries_[key] = Entry{value, now};
+            if (snapshot_path_.empty()) {
+                return;
+            }
+            dirty_ = true;
+            if (saving_ || now - last_save_ < kSnapshotInterval.count()) {
+                return;  // Left dirty: written by a later insert or at exit
+            }
+            saving_ = true;
+            last_save_ = now;
+            snapshot = TakeSnapshotLocked();
+        }
+        WriteSnapshot(snapshot);
+        std::lock_guard<std::mutex> lock(mutex_);
+        saving_ = false;
+    }
+
+    /**
+     * Hex fingerprint of an API key (FNV-1a 64): the raw key never appears in cache keys
+     * or on disk
+     */
+    static std::string Fingerprint(const std::string& api_key) {
+        uint64_t hash = 14695981039346656037ULL;
+        for (unsigned char c : api_key) {
+            hash ^= c;
+            hash *= 1099511628211ULL;
+        }
+        char fingerprint[17];
+        std::snprintf(fingerprint, sizeof(fingerprint), "%016llx",
+                      static_cast<unsigned long long>(hash));
+        return fingerprint;
+    }
+
+    /**
+     * Build a cache key from the API key fingerprint, the call name and its arguments
+     */
+    static std::string MakeKey(const std::string& api_key,
+                               std::initializer_list<std::string_view> parts) {
+        std::string key = Fingerprint(api_key);
+        for (std::string_view part : parts) {
+            key.push_back('\x1f');
+            key.append(part.data(), part.size());
+        }
+        return key;
+    }
+
+private:
+    struct Entry {
+        std::string value;
+        int64_t stored_at;  // Unix seconds (wall clock, so it survives restarts)
+    };
+
+    // Entries copied for a write outside the cache lock
+    struct Snapshot {
+        std::filesystem::path path;
+        uint64_t epoch = 0;
+        int64_t ttl = 0;
+        std::unordered_map<std::string, Entry> entries;
+    };
+
+    MetadataCache() = default;
+
+    ~MetadataCache() {
+        // Persist inserts the debounce held back
+        try {
+            Snapshot snapshot;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!dirty_ || snapshot_path_.empty()) {
+                    return;
+                }
+                snapshot = TakeSnapshotLocked();
+            }
+            WriteSnapshot(snapshot);
+        }
+        catch (...) {
+            // Best-effort
+        }
+    }
+
+    static int64_t NowSeconds() {
+        return std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    void LoadSnapshotLocked() {
+        std::ifstream in(snapshot_path_);
+        if (!in) {
+            return;
+        }
+        try {
+            nlohmann::json j = nlohmann::json::parse(in);
+            if (j.value("version", 0) != kSnapshotVersion) {
+                return;
+            }
+            const int64_t now = NowSeconds();
+            for (const auto& item : j.at("entries")) {
+                int64_t stored_at = item.at("stored_at").get<int64_t>();
+                if (now - stored_at >= ttl_.count()) {
+                    continue;
+                }
+                entries_[item.at("key").get<std::string>()] =
+                    Entry{item.at("value").get<std::string>(), stored_at};
+            }
+        }
+        catch (const std::exception&) {
+            // Corrupt snapshot: start cold, it is rewritten on the next insert
+            entries_.clear();
+        }
+    }
+
+    Snapshot TakeSnapshotLocked() {
+        dirty_ = false;
+        return Snapshot{snapshot_path_, epoch_, ttl_.count(), entries_};
+    }
+
+    /**
+     * Serialize and write a snapshot; skipped if Clear() or Configure() ran since it was taken
+     */
+    void WriteSnapshot(const Snapshot& snapshot) {
+        nlohmann::json entries = nlohmann::json::array();
+        const int64_t now = NowSeconds();
+        for (const auto& [key, entry] : snapshot.entries) {
+            if (now - entry.stored_at >= snapshot.ttl) {
+                continue;
+            }
+            entries.push_back({{"key", key}, {"value", entry.value}, {"stored_at", entry.stored_at}});
+        }
+        nlohmann::json j = {{"version", kSnapshotVersion}, {"entries", std::move(entries)}};
+        const std::string text = j.dump();
+
+        // Serializes writers with Clear()/Configure(); never taken while holding mutex_
+        std::lock_guard<std::mutex> save_lock(save_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (snapshot.epoch != epoch_) {
+                return;
+            }
+        }
+        std::filesystem::path tmp_path = snapshot.path;
+        tmp_path += ".tmp";
+        {
+            std::ofstream out(tmp_path, std::ios::trunc);
+            if (!out) {
+                return;
+            }
+            out << text;
+            if (!out) {
+                return;
+            }
+        }
+        std::error_code ec;
+        std::filesystem::rename(tmp_path, snapshot.path, ec);
+    }
+
+    std::mutex save_mutex_;  // Held while a snapshot file is written; taken before mutex_
+    std::mutex mutex_;
+    std::chrono::seconds ttl_{0};
+    std::filesystem::path snapshot_path_;
+    std::unordered_map<std::string, Entry> entries_;
+    uint64_t epoch_ = 0;      // Bumped by Clear()/Configure() to discard snapshots taken before
+    bool dirty_ = false;      // Inserts not yet in a snapshot
+    bool saving_ = false;     // A thread is writing a snapshot
+    int64_t last_save_ = 0;   // Unix seconds of the last snapshot taken by Put()
+};
+
+}  // namespace databento_native
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <databento/datetime.hpp>
+#include <databento/dbn.hpp>
+#include <databento/enums.hpp>
+#include <date/date.h>
+#include <nlohmann/json.hpp>
+
+namespace databento_native {
+
+/**
+ * Build databento::Metadata from the JSON form of DbnMetadata used by the .NET client
+ */
+inline databento::Metadata ParseMetadataFromJson(const std::string& json_str) {
+    nlohmann::json j = nlohmann::json::parse(json_str);
+
+    databento::Metadata metadata;
+    metadata.version = j["version"].get<std::uint8_t>();
+    metadata.dataset = j["dataset"].get<std::string>();
+
+    // Parse optional schema
+    if (!j["schema"].is_null()) {
+        metadata.schema = static_cast<databento::Schema>(j["schema"].get<int>());
+    }
+
+    // Parse start/end timestamps (nanoseconds)
+    auto start_ns = j["start"].get<int64_t>();
+    auto end_ns = j["end"].get<int64_t>();
+    metadata.start = databento::UnixNanos{std::chrono::duration<uint64_t, std::nano>{static_cast<uint64_t>(start_ns)}};
+    metadata.end = databento::UnixNanos{std::chrono::duration<uint64_t, std::nano>{static_cast<uint64_t>(end_ns)}};
+
+    metadata.limit = j["limit"].get<std::uint64_t>();
+
+    // Parse optional stype_in
+    if (!j["stype_in"].is_null()) {
+        metadata.stype_in = static_cast<databento::SType>(j["stype_in"].get<int>());
+    }
+
+    metadata.stype_out = static_cast<databento::SType>(j["stype_out"].get<int>());
+    metadata.ts_out = j["ts_out"].get<bool>();
+    metadata.symbol_cstr_len = j["symbol_cstr_len"].get<std::size_t>();
+
+    // Parse symbol arrays
+    metadata.symbols = j["symbols"].get<std::vector<std::string>>();
+    metadata.partial = j["partial"].get<std::vector<std::string>>();
+    metadata.not_found = j["not_found"].get<std::vector<std::string>>();
+
+    // Parse mappings
+    if (j.contains("mappings") && j["mappings"].is_array()) {
+        for (const auto& mapping_json : j["mappings"]) {
+            databento::SymbolMapping mapping;
+            mapping.raw_symbol = mapping_json["raw_symbol"].get<std::string>();
+
+            for (const auto& interval_json : mapping_json["intervals"]) {
+                databento::MappingInterval interval;
+
+                // Parse ISO 8601 date strings
+                std::string start_date_str = interval_json["start_date"].get<std::string>();
+                std::string end_date_str = interval_json["end_date"].get<std::string>();
+
+                std::istringstream ss_start(start_date_str);
+                std::istringstream ss_end(end_date_str);
+
+                ss_start >> date::parse("%Y-%m-%d", interval.start_date);
+                ss_end >> date::parse("%Y-%m-%d", interval.end_date);
+
+                interval.symbol = interval_json["symbol"].get<std::string>();
+                mapping.intervals.push_back(interval);
+            }
+
+            metadata.mappings.push_back(mapping);
+        }
+    }
+
+    return metadata;
+}
+
+}  // namespace databento_native
@@ -0,0 +1,415 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "columnar_export.hpp"
+
+namespace databento_native {
+
+/**
+ * Thrift compact protocol encoder, enough for Parquet page headers and file metadata
+ */
+class ThriftCompactWriter {
+public:
+    enum Type : uint8_t {
+        kBoolTrue = 1,
+        kBoolFalse = 2,
+        kByte = 3,
+        kI32 = 5,
+        kI64 = 6,
+        kBinary = 8,
+        kList = 9,
+        kStruct = 12
+    };
+
+    std::vector<uint8_t>& Bytes() { return out_; }
+
+    void FieldI32(int16_t id, int32_t value) {
+        FieldHeader(id, kI32);
+        Varint(ZigZag(value));
+    }
+
+    void FieldI64(int16_t id, int64_t value) {
+        FieldHeader(id, kI64);
+        Varint(ZigZag(value));
+    }
+
+    void FieldByte(int16_t id, int8_t value) {
+        FieldHeader(id, kByte);
+        out_.push_back(static_cast<uint8_t>(value));
+    }
+
+    void FieldBool(int16_t id, bool value) {
+        FieldHeader(id, value ? kBoolTrue : kBoolFalse);
+    }
+
+    void FieldString(int16_t id, std::string_view value) {
+        FieldHeader(id, kBinary);
+        String(value);
+    }
+
+    void FieldListBegin(int16_t id, Type element_type, size_t size) {
+        FieldHeader(id, kList);
+        ListBegin(element_type, size);
+    }
+
+    void FieldStructBegin(int16_t id) {
+        FieldHeader(id, kStruct);
+        StructBegin();
+    }
+
+    // A struct that is a list element (no field header)
+    void StructBegin() {
+        last_ids_.push_back(last_id_);
+        last_id_ = 0;
+    }
+
+    void StructEnd() {
+        out_.push_back(0);  // Stop
+        last_id_ = last_ids_.back();
+        last_ids_.pop_back();
+    }
+
+    void ListBegin(Type element_type, size_t size) {
+        if (size < 15) {
+            out_.push_back(static_cast<uint8_t>((size << 4) | element_type));
+        } else {
+            out_.push_back(static_cast<uint8_t>(0xF0 | element_type));
+            Varint(size);
+        }
+    }
+
+    void I32(int32_t value) { Varint(ZigZag(value)); }
+
+    void String(std::string_view value) {
+        Varint(value.size());
+        out_.insert(out_.end(), value.begin(), value.end());
+    }
+
+private:
+    static uint64_t ZigZag(int64_t value) {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    void Varint(uint64_t value) {
+        while (value >= 0x80) {
+            out_.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out_.push_back(static_cast<uint8_t>(value));
+    }
+
+    void FieldHeader(int16_t id, uint8_t type) {
+        const int delta = id - last_id_;
+        if (delta > 0 && delta <= 15) {
+            out_.push_back(static_cast<uint8_t>((delta << 4) | type));
+        } else {
+            out_.push_back(type);
+            Varint(ZigZag(id));
+        }
+        last_id_ = id;
+    }
+
+    std::vector<uint8_t> out_;
+    int16_t last_id_ = 0;
+    std::vector<int16_t> last_ids_;
+};
+
+/**
+ * Parquet writer for projected DBN columns
+ *
+ * Writes the format directly: every column is REQUIRED and PLAIN-encoded, with one column
+ * chunk per row group split into data pages of about 1 MiB. Narrow unsigned fields are
+ * stored as INT32 with an unsigned INTEGER logical type, ts_* fields as INT64 TIMESTAMP
+ * (UTC, nanoseconds) and character fields as UTF-8 BYTE_ARRAY. Encode() (value encoding
+ * and compression) is safe to call from several threads; Write() and Close() append to
+ * the file in order.
+ */
+class ParquetFileWriter {
+public:
+    struct EncodedChunk {
+        std::vector<uint8_t> bytes;  // Page headers and (compressed) pages
+        uint64_t uncompressed_size = 0;
+    };
+
+    struct EncodedRowGroup {
+        size_t rows = 0;
+        std::vector<EncodedChunk> chunks;
+    };
+
+    ParquetFileWriter(const std::filesystem::path& path, std::vector<ColumnSpec> columns,
+                      ExportCompression compression, int level)
+        : out_(path, std::ios::binary | std::ios::trunc)
+        , columns_(std::move(columns))
+        , compression_(compression)
+        , level_(level)
+    {
+        if (!out_) {
+            throw std::runtime_error("Failed to create file: " + path.string());
+        }
+        WriteBytes("PAR1", 4);
+    }
+
+    ParquetFileWriter(const ParquetFileWriter&) = delete;
+    ParquetFileWriter& operator=(const ParquetFileWriter&) = delete;
+
+    EncodedRowGroup Encode(const ColumnBatch& batch) const {
+        EncodedRowGroup encoded;
+        encoded.rows = batch.rows;
+        std::vector<uint8_t> plain;
+        for (size_t c = 0; c < columns_.size(); ++c) {
+            EncodedChunk chunk;
+            const size_t width = FieldWidth(columns_[c].type);
+            const size_t rows_per_page = std::max<size_t>(kPageSize / PlainWidth(columns_[c].type), 1);
+            for (size_t first = 0; first < batch.rows; first += rows_per_page) {
+                const size_t rows = std::min(rows_per_page, batch.rows - first);
+                EncodePlain(columns_[c].type, batch.columns[c].data() + first * width, rows, plain);
+                AppendPage(chunk, plain, rows);
+            }
+            encoded.chunks.push_back(std::move(chunk));
+        }
+        return encoded;
+    }
+
+    void Write(const EncodedRowGroup& row_group) {
+        RowGroupInfo info;
+        info.rows = row_group.rows;
+        for (const auto& chunk : row_group.chunks) {
+            info.chunks.push_back(ChunkInfo{position_, chunk.bytes.size(), chunk.uncompressed_size});
+            WriteBytes(chunk.bytes.data(), chunk.bytes.size());
+        }
+        total_rows_ += row_group.rows;
+        row_groups_.push_back(std::move(info));
+    }
+
+    /**
+     * Write the file metadata and trailer, then close the file
+     */
+    void Close() {
+        ThriftCompactWriter meta;
+        meta.FieldI32(1, 1);  // version
+        meta.FieldListBegin(2, ThriftCompactWriter::kStruct, columns_.size() + 1);
+        meta.StructBegin();  // Root of the schema tree
+        meta.FieldString(4, "schema");
+        meta.FieldI32(5, static_cast<int32_t>(columns_.size()));
+        meta.StructEnd();
+        for (const auto& column : columns_) {
+            WriteSchemaElement(meta, column);
+        }
+        meta.FieldI64(3, static_cast<int64_t>(total_rows_));
+        meta.FieldListBegin(4, ThriftCompactWriter::kStruct, row_groups_.size());
+        for (const auto& row_group : row_groups_) {
+            WriteRowGroup(meta, row_group);
+        }
+        meta.FieldString(6, "databento-dotnet native exporter");
+        meta.Bytes().push_back(0);  // Stop
+
+        const auto& bytes = meta.Bytes();
+        WriteBytes(bytes.data(), bytes.size());
+        std::vector<uint8_t> trailer;
+        AppendLe32(trailer, static_cast<uint32_t>(bytes.size()));
+        trailer.insert(trailer.end(), {'P', 'A', 'R', '1'});
+        WriteBytes(trailer.data(), trailer.size());
+        out_.close();
+        if (!out_) {
+            throw std::runtime_error("Failed to write Parquet footer");
+        }
+    }
+
+private:
+    // Parquet format constants (parquet.thrift)
+    static constexpr int32_t kTypeInt32 = 1;
+    static constexpr int32_t kTypeInt64 = 2;
+    static constexpr int32_t kTypeByteArray = 6;
+    static constexpr int32_t kRequired = 0;
+    static constexpr int32_t kEncodingPlain = 0;
+    static constexpr int32_t kEncodingRle = 3;
+    static constexpr int32_t kCodecUncompressed = 0;
+    static constexpr int32_t kCodecZstd = 6;
+    static constexpr int32_t kConvertedUtf8 = 0;
+    static constexpr size_t kPageSize = 1 << 20;
+
+    struct ChunkInfo {
+        uint64_t offset;
+        uint64_t compressed_size;
+        uint64_t uncompressed_size;
+    };
+
+    struct RowGroupInfo {
+        size_t rows = 0;
+        std::vector<ChunkInfo> chunks;
+    };
+
+    static size_t PlainWidth(FieldType type) {
+        switch (type) {
+            case FieldType::Char:
+                return 5;  // Length prefix and one byte
+            case FieldType::UInt64:
+            case FieldType::Int64:
+                return 8;
+            default:
+                return 4;
+        }
+    }
+
+    static int32_t PhysicalType(FieldType type) {
+        switch (type) {
+            case FieldType::Char:
+                return kTypeByteArray;
+            case FieldType::UInt64:
+            case FieldType::Int64:
+                return kTypeInt64;
+            default:
+                return kTypeInt32;
+        }
+    }
+
+    static void EncodePlain(FieldType type, const uint8_t* values, size_t rows, std::vector<uint8_t>& out) {
+        out.clear();
+        switch (type) {
+            case FieldType::UInt8:
+                for (size_t i = 0; i < rows; ++i) {
+                    AppendLe32(out, values[i]);
+                }
+                break;
+            case FieldType::UInt16:
+                for (size_t i = 0; i < rows; ++i) {
+                    uint16_t value;
+                    std::memcpy(&value, values + i * 2, 2);
+                    AppendLe32(out, value);
+                }
+                break;
+            case FieldType::Char:
+                for (size_t i = 0; i < rows; ++i) {
+                    AppendLe32(out, 1);
+                    out.push_back(values[i]);
+                }
+                break;
+            default:
+                out.assign(values, values + rows * FieldWidth(type));
+                break;
+        }
+    }
+
+    void AppendPage(EncodedChunk& chunk, const std::vector<uint8_t>& plain, size_t rows) const {
+        std::vector<uint8_t> compressed;
+        const std::vector<uint8_t>* page = &plain;
+        if (compression_ == ExportCompression::Zstd) {
+            AppendZstdFrame(compressed, plain.data(), plain.size(), level_);
+            page = &compressed;
+        }
+
+        ThriftCompactWriter header;
+        header.FieldI32(1, 0);  // DATA_PAGE
+        header.FieldI32(2, static_cast<int32_t>(plain.size()));
+        header.FieldI32(3, static_cast<int32_t>(page->size()));
+        header.FieldStructBegin(5);
+        header.FieldI32(1, static_cast<int32_t>(rows));
+        header.FieldI32(2, kEncodingPlain);
+        header.FieldI32(3, kEncodingRle);
+        header.FieldI32(4, kEncodingRle);
+        header.StructEnd();
+        header.Bytes().push_back(0);  // Stop
+
+        const auto& header_bytes = header.Bytes();
+        chunk.bytes.insert(chunk.bytes.end(), header_bytes.begin(), header_bytes.end());
+        chunk.bytes.insert(chunk.bytes.end(), page->begin(), page->end());
+        chunk.uncompressed_size += header_bytes.size() + plain.size();
+    }
+
+    static void WriteSchemaElement(ThriftCompactWriter& meta, const ColumnSpec& column) {
+        meta.StructBegin();
+        meta.FieldI32(1, PhysicalType(column.type));
+        meta.FieldI32(3, kRequired);
+        meta.FieldString(4, column.name);
+        const bool is_signed = column.type == FieldType::Int32 || column.type == FieldType::Int64;
+        if (column.type == FieldType::Char) {
+            meta.FieldI32(6, kConvertedUtf8);
+            meta.FieldStructBegin(10);
+            meta.FieldStructBegin(1);  // STRING
+            meta.StructEnd();
+            meta.StructEnd();
+        } else if (column.timestamp) {
+            meta.FieldStructBegin(10);
+            meta.FieldStructBegin(8);  // TIMESTAMP
+            meta.FieldBool(1, true);  // isAdjustedToUTC
+            meta.FieldStructBegin(2);
+            meta.FieldStructBegin(3);  // NANOS
+            meta.StructEnd();
+            meta.StructEnd();
+            meta.StructEnd();
+            meta.StructEnd();
+        } else if (!is_signed) {
+            const int bits = static_cast<int>(FieldWidth(column.type) * 8);
+            meta.FieldI32(6, 11 + (bits == 8 ? 0 : bits == 16 ? 1 : bits == 32 ? 2 : 3));  // UINT_8..UINT_64
+            meta.FieldStructBegin(10);
+            meta.FieldStructBegin(10);  // INTEGER
+            meta.FieldByte(1, static_cast<int8_t>(bits));
+            meta.FieldBool(2, false);
+            meta.StructEnd();
+            meta.StructEnd();
+        }
+        meta.StructEnd();
+    }
+
+    void WriteRowGroup(ThriftCompactWriter& meta, const RowGroupInfo& row_group) const {
+        uint64_t total_uncompressed = 0;
+        uint64_t total_compressed = 0;
+        meta.StructBegin();
+        meta.FieldListBegin(1, ThriftCompactWriter::kStruct, row_group.chunks.size());
+        for (size_t c = 0; c < row_group.chunks.size(); ++c) {
+            const ChunkInfo& chunk = row_group.chunks[c];
+            total_uncompressed += chunk.uncompressed_size;
+            total_compressed += chunk.compressed_size;
+            meta.StructBegin();
+            meta.FieldI64(2, static_cast<int64_t>(chunk.offset));  // file_offset
+            meta.FieldStructBegin(3);
+            meta.FieldI32(1, PhysicalType(columns_[c].type));
+            meta.FieldListBegin(2, ThriftCompactWriter::kI32, 2);
+            meta.I32(kEncodingPlain);
+            meta.I32(kEncodingRle);
+            meta.FieldListBegin(3, ThriftCompactWriter::kBinary, 1);
+            meta.String(columns_[c].name);
+            meta.FieldI32(4, compression_ == ExportCompression::Zstd ? kCodecZstd : kCodecUncompressed);
+            meta.FieldI64(5, static_cast<int64_t>(row_group.rows));
+            meta.FieldI64(6, static_cast<int64_t>(chunk.uncompressed_size));
+            meta.FieldI64(7, static_cast<int64_t>(chunk.compressed_size));
+            meta.FieldI64(9, static_cast<int64_t>(chunk.offset));  // data_page_offset
+            meta.StructEnd();
+            meta.StructEnd();
+        }
+        meta.FieldI64(2, static_cast<int64_t>(total_uncompressed));
+        meta.FieldI64(3, static_cast<int64_t>(row_group.rows));
+        if (!row_group.chunks.empty()) {
+            meta.FieldI64(5, static_cast<int64_t>(row_group.chunks.front().offset));
+        }
+        meta.FieldI64(6, static_cast<int64_t>(total_compressed));
+        meta.StructEnd();
+    }
+
+    void WriteBytes(const void* data, size_t size) {
+        out_.write(static_cast<const char*>(data), static_cast<std::streamsize>(size));
+        if (!out_) {
+            throw std::runtime_error("Failed to write Parquet file");
+        }
+        position_ += size;
+    }
+
+    std::ofstream out_;
+    std::vector<ColumnSpec> columns_;
+    ExportCompression compression_;
+    int level_;
+    uint64_t position_ = 0;
+    uint64_t total_rows_ = 0;
+    std::vector<RowGroupInfo> row_groups_;
+};
+
+}  // namespace databento_native
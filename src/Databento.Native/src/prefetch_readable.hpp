@@ -0,0 +1,273 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+#include <zstd.h>
+#include <databento/ireadable.hpp>
+
+namespace databento_native {
+
+/**
+ * Read-ahead settings for the buffered DBN reader
+ */
+struct PrefetchOptions {
+    static constexpr size_t kDefaultBlockSize = 1 << 20;
+    static constexpr size_t kDefaultBlockCount = 3;
+
+    size_t block_size = kDefaultBlockSize;
+    size_t block_count = kDefaultBlockCount;  // Blocks in flight, including the one being consumed
+};
+
+/**
+ * IReadable that reads (and for zstd files, decompresses) ahead on a background thread
+ *
+ * A producer thread fills a ring of block_count blocks while the decoder consumes the
+ * current one, so storage latency and zstd decompression overlap with record processing.
+ * With decompress set the consumer sees the plain DBN stream. Like FileReadable, it can
+ * serve the first prefix_length bytes (DBN prefix and metadata) and then continue at
+ * resume_offset of an uncompressed file.
+ */
+class PrefetchReadable : public databento::IReadable {
+public:
+    PrefetchReadable(const std::filesystem::path& path,
+                     bool decompress,
+                     const PrefetchOptions& options,
+                     uint64_t prefix_length = 0,
+                     uint64_t resume_offset = 0)
+        : stream_(path, std::ios::binary)
+        , decompress_(decompress)
+        , block_size_(std::max<size_t>(options.block_size, 4096))
+        , prefix_remaining_(prefix_length)
+        , resume_offset_(resume_offset)
+        , resume_pending_(prefix_length > 0 && resume_offset != prefix_length)
+    {
+        if (!stream_) {
+            throw std::runtime_error("Failed to open file: " + path.string());
+        }
+        if (decompress_) {
+            dctx_ = ZSTD_createDStream();
+            if (!dctx_) {
+                throw std::runtime_error("Failed to create zstd decompression stream");
+            }
+            ZSTD_initDStream(dctx_);
+            compressed_.resize(ZSTD_DStreamInSize());
+        }
+        const size_t block_count = std::max<size_t>(options.block_count, 2);
+        for (size_t i = 0; i < block_count; ++i) {
+            free_.push_back(std::make_unique<Block>());
+            free_.back()->data.resize(block_size_);
+        }
+        producer_ = std::thread([this] { Produce(); });
+    }
+
+    ~PrefetchReadable() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        cv_.notify_all();
+        producer_.join();
+        if (dctx_) {
+            ZSTD_freeDStream(dctx_);
+        }
+    }
+
+    PrefetchReadable(const PrefetchReadable&) = delete;
+    PrefetchReadable& operator=(const PrefetchReadable&) = delete;
+
+    void ReadExact(std::byte* buffer, std::size_t length) override {
+        size_t total = 0;
+        while (total < length) {
+            size_t count = ReadSome(buffer + total, length - total);
+            if (count == 0) {
+                throw std::runtime_error("Unexpected end of DBN file");
+            }
+            total += count;
+        }
+    }
+
+    std::size_t ReadSome(std::byte* buffer, std::size_t max_length) override {
+        if (max_length == 0) {
+            return 0;
+        }
+        if (!current_ || current_pos_ == current_->size) {
+            if (!NextBlock()) {
+                return 0;
+            }
+        }
+        const size_t count = std::min(max_length, current_->size - current_pos_);
+        std::memcpy(buffer, current_->data.data() + current_pos_, count);
+        current_pos_ += count;
+        return count;
+    }
+
+private:
+    struct Block {
+        std::vector<uint8_t> data;
+        size_t size = 0;
+    };
+
+    // Hand the consumed block back to the producer and wait for the next filled one
+    bool NextBlock() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (current_) {
+            free_.push_back(std::move(current_));
+            cv_.notify_all();
+        }
+        cv_.wait(lock, [this] { return !ready_.empty() || finished_; });
+        if (ready_.empty()) {
+            if (error_) {
+                std::rethrow_exception(error_);
+            }
+            return false;
+        }
+        current_ = std::move(ready_.front());
+        ready_.pop_front();
+        current_pos_ = 0;
+        return true;
+    }
+
+    void Produce() {
+        try {
+            for (;;) {
+                std::unique_ptr<Block> block;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    cv_.wait(lock, [this] { return stopping_ || !free_.empty(); });
+                    if (stopping_) {
+                        return;
+                    }
+                    block = std::move(free_.front());
+                    free_.pop_front();
+                }
+
+                block->size = decompress_ ? FillDecompressed(*block) : FillRaw(*block);
+                const bool eof = block->size == 0;
+
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (eof) {
+                    finished_ = true;
+                    cv_.notify_all();
+                    return;
+                }
+                ready_.push_back(std::move(block));
+                cv_.notify_all();
+            }
+        }
+        catch (...) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            error_ = std::current_exception();
+            finished_ = true;
+            cv_.notify_all();
+        }
+    }
+
+    // Read from the file, serving the prefix then jumping to the resume offset
+    size_t ReadFile(uint8_t* dest, size_t max_length) {
+        if (resume_pending_ && prefix_remaining_ == 0) {
+            stream_.seekg(static_cast<std::streamoff>(resume_offset_));
+            resume_pending_ = false;
+        }
+        if (resume_pending_) {
+            max_length = static_cast<size_t>(std::min<uint64_t>(max_length, prefix_remaining_));
+        }
+        stream_.read(reinterpret_cast<char*>(dest), static_cast<std::streamsize>(max_length));
+        const size_t count = static_cast<size_t>(stream_.gcount());
+        if (count == 0 && stream_.bad()) {
+            throw std::runtime_error("Failed to read DBN file");
+        }
+        if (resume_pending_) {
+            prefix_remaining_ -= count;
+        }
+        stream_.clear(stream_.rdstate() & ~(std::ios::eofbit | std::ios::failbit));
+        return count;
+    }
+
+    size_t FillRaw(Block& block) {
+        size_t filled = 0;
+        while (filled < block_size_) {
+            const size_t count = ReadFile(block.data.data() + filled, block_size_ - filled);
+            if (count == 0) {
+                break;
+            }
+            filled += count;
+        }
+        return filled;
+    }
+
+    size_t FillDecompressed(Block& block) {
+        ZSTD_outBuffer out{block.data.data(), block_size_, 0};
+        while (out.pos < out.size) {
+            // After filling a whole block the decoder may still hold output: drain it first
+            if (input_.pos == input_.size && !drain_) {
+                if (input_eof_) {
+                    break;
+                }
+                const size_t count = ReadFile(compressed_.data(), compressed_.size());
+                if (count == 0) {
+                    input_eof_ = true;
+                    if (frame_pending_) {
+                        throw std::runtime_error("Truncated zstd stream in DBN file");
+                    }
+                    break;
+                }
+                input_ = ZSTD_inBuffer{compressed_.data(), count, 0};
+            }
+            const size_t in_before = input_.pos;
+            const size_t out_before = out.pos;
+            const size_t result = ZSTD_decompressStream(dctx_, &out, &input_);
+            if (ZSTD_isError(result)) {
+                throw std::runtime_error(std::string{"zstd decompression failed: "} + ZSTD_getErrorName(result));
+            }
+            // A call without progress only reports that the next frame's header is expected
+            if (input_.pos != in_before || out.pos != out_before) {
+                frame_pending_ = result != 0;
+            }
+            drain_ = out.pos == out.size;
+        }
+        return out.pos;
+    }
+
+    std::ifstream stream_;
+    bool decompress_;
+    size_t block_size_;
+    uint64_t prefix_remaining_;
+    uint64_t resume_offset_;
+    bool resume_pending_;
+
+    // Producer-only state
+    ZSTD_DStream* dctx_ = nullptr;
+    std::vector<uint8_t> compressed_;
+    ZSTD_inBuffer input_{nullptr, 0, 0};
+    bool input_eof_ = false;
+    bool frame_pending_ = false;
+    bool drain_ = false;
+
+    // Consumer-only state
+    std::unique_ptr<Block> current_;
+    size_t current_pos_ = 0;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::unique_ptr<Block>> free_;
+    std::deque<std::unique_ptr<Block>> ready_;
+    bool finished_ = false;
+    bool stopping_ = false;
+    std::exception_ptr error_;
+    std::thread producer_;  // Started last in the constructor
+};
+
+}  // namespace databento_native
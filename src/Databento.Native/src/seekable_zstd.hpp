@@ -0,0 +1,599 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <zstd.h>
+#include <databento/iwritable.hpp>
+#include "buffered_file_writer.hpp"
+#include "mapped_file.hpp"
+#include "thread_pool.hpp"
+
+namespace databento_native {
+
+/**
+ * zstd seekable format support for DBN files
+ *
+ * A seekable `.dbn.zst` file is a sequence of independently decodable zstd frames followed
+ * by a seek table in a skippable frame (zstd contrib/seekable_format):
+ *
+ *   frames..., u32 0x184D2A5E, u32 table_size,
+ *   per frame: u32 compressed_size, u32 decompressed_size,
+ *   u32 frame_count, u8 descriptor (0), u32 0x8F92EAB1
+ *
+ * Any zstd decoder (including DbnFileStore and the zstd CLI) reads it as an ordinary stream
+ * because concatenated and skippable frames are part of the zstd format. The writer closes
+ * frames on record boundaries after the metadata and then every ~frame_size bytes, so each
+ * frame decodes to whole records; the reader still handles records that straddle frames, so
+ * seekable files produced by other tools work too.
+ */
+
+constexpr uint32_t kZstdFrameMagic = 0xFD2FB528;
+constexpr uint32_t kSeekTableSkippableMagic = 0x184D2A5E;
+constexpr uint32_t kSeekTableFooterMagic = 0x8F92EAB1;
+constexpr size_t kSeekTableFooterSize = 9;
+constexpr size_t kDefaultSeekableFrameSize = 1024 * 1024;
+constexpr size_t kMaxSeekableFrameSize = 512 * 1024 * 1024;
+
+struct SeekableFrame {
+    uint64_t compressed_offset;
+    uint64_t decompressed_offset;
+    uint32_t compressed_size;
+    uint32_t decompressed_size;
+};
+
+inline uint32_t ReadLe32(const uint8_t* p) {
+    return static_cast<uint32_t>(p[0]) | (static_cast<uint32_t>(p[1]) << 8) |
+           (static_cast<uint32_t>(p[2]) << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+inline void AppendLe32(std::string& out, uint32_t value) {
+    const char bytes[4] = {static_cast<char>(value), static_cast<char>(value >> 8),
+                           static_cast<char>(value >> 16), static_cast<char>(value >> 24)};
+    out.append(bytes, sizeof(bytes));
+}
+
+/**
+ * Append a seek table for frames of (compressed, decompressed) sizes
+ */
+inline void AppendSeekTable(std::string& out, const std::vector<std::pair<uint32_t, uint32_t>>& frames) {
+    AppendLe32(out, kSeekTableSkippableMagic);
+    AppendLe32(out, static_cast<uint32_t>(frames.size() * 8 + kSeekTableFooterSize));
+    for (const auto& [compressed, decompressed] : frames) {
+        AppendLe32(out, compressed);
+        AppendLe32(out, decompressed);
+    }
+    AppendLe32(out, static_cast<uint32_t>(frames.size()));
+    out.push_back('\0');
+    AppendLe32(out, kSeekTableFooterMagic);
+}
+
+// Offset of the data in a frame written by AppendStoredFrame (frame and first block header)
+constexpr size_t kStoredFrameDataOffset = 12;
+
+/**
+ * Append a zstd frame holding data in raw (stored) blocks, with no content checksum
+ *
+ * The bytes appear verbatim in the file, so they can be patched in place later.
+ */
+inline void AppendStoredFrame(std::string& out, const std::byte* data, size_t length) {
+    constexpr size_t kMaxRawBlock = 128 * 1024;
+    // Single-segment frame header with a 4-byte content size
+    AppendLe32(out, kZstdFrameMagic);
+    out.push_back(static_cast<char>(0xA0));
+    AppendLe32(out, static_cast<uint32_t>(length));
+    size_t offset = 0;
+    do {
+        const size_t block = std::min(length - offset, kMaxRawBlock);
+        const bool last = offset + block == length;
+        const uint32_t block_header = static_cast<uint32_t>(block << 3) | (last ? 1u : 0u);  // Raw block
+        out.push_back(static_cast<char>(block_header));
+        out.push_back(static_cast<char>(block_header >> 8));
+        out.push_back(static_cast<char>(block_header >> 16));
+        out.append(reinterpret_cast<const char*>(data) + offset, block);
+        offset += block;
+    } while (offset < length);
+}
+
+/**
+ * Compress data as one checksummed frame with the calling thread's compression context
+ */
+inline std::string CompressSeekableFrame(const char* data, size_t size, int level) {
+    thread_local std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx*)> cctx{ZSTD_createCCtx(), ZSTD_freeCCtx};
+    if (!cctx) {
+        throw std::runtime_error("Failed to create zstd compression context");
+    }
+    ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_compressionLevel, level);
+    ZSTD_CCtx_setParameter(cctx.get(), ZSTD_c_checksumFlag, 1);
+    std::string compressed(ZSTD_compressBound(size), '\0');
+    const size_t written = ZSTD_compress2(cctx.get(), compressed.data(), compressed.size(), data, size);
+    if (ZSTD_isError(written)) {
+        throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(written));
+    }
+    compressed.resize(written);
+    return compressed;
+}
+
+/**
+ * Parse the seek table at the end of a file
+ * @return The frames, or nullopt if the file is not in the seekable format
+ */
+inline std::optional<std::vector<SeekableFrame>> ParseSeekTable(const uint8_t* data, size_t size) {
+    if (size < kSeekTableFooterSize + 8 || ReadLe32(data) != kZstdFrameMagic ||
+        ReadLe32(data + size - 4) != kSeekTableFooterMagic) {
+        return std::nullopt;
+    }
+    const uint64_t frame_count = ReadLe32(data + size - kSeekTableFooterSize);
+    const uint8_t descriptor = data[size - 5];
+    if ((descriptor & 0x7C) != 0) {
+        return std::nullopt;  // Reserved bits set
+    }
+    const uint64_t entry_size = (descriptor & 0x80) ? 12 : 8;
+    const uint64_t table_size = frame_count * entry_size + kSeekTableFooterSize;
+    if (table_size + 8 > size) {
+        return std::nullopt;
+    }
+    const uint8_t* table = data + size - table_size;
+    if (ReadLe32(table - 8) != kSeekTableSkippableMagic || ReadLe32(table - 4) != table_size) {
+        return std::nullopt;
+    }
+
+    std::vector<SeekableFrame> frames;
+    frames.reserve(static_cast<size_t>(frame_count));
+    uint64_t compressed = 0;
+    uint64_t decompressed = 0;
+    const uint64_t data_end = size - table_size - 8;
+    for (uint64_t i = 0; i < frame_count; ++i) {
+        const uint8_t* entry = table + i * entry_size;
+        SeekableFrame frame{compressed, decompressed, ReadLe32(entry), ReadLe32(entry + 4)};
+        compressed += frame.compressed_size;
+        decompressed += frame.decompressed_size;
+        if (compressed > data_end) {
+            return std::nullopt;
+        }
+        frames.push_back(frame);
+    }
+    return frames;
+}
+
+/**
+ * Decompress the first `length` bytes of a zstd stream (seekable or not)
+ * @throws std::runtime_error if the stream is corrupt or shorter than length
+ */
+inline std::vector<uint8_t> DecompressPrefix(const uint8_t* data, size_t size, size_t length) {
+    std::unique_ptr<ZSTD_DStream, size_t (*)(ZSTD_DStream*)> stream{ZSTD_createDStream(), ZSTD_freeDStream};
+    std::vector<uint8_t> out(length);
+    ZSTD_inBuffer in{data, size, 0};
+    ZSTD_outBuffer dst{out.data(), out.size(), 0};
+    while (dst.pos < dst.size) {
+        const size_t in_before = in.pos;
+        const size_t out_before = dst.pos;
+        const size_t ret = ZSTD_decompressStream(stream.get(), &dst, &in);
+        if (ZSTD_isError(ret)) {
+            throw std::runtime_error(std::string("zstd decompression failed: ") + ZSTD_getErrorName(ret));
+        }
+        if (in.pos == in_before && dst.pos == out_before) {
+            throw std::runtime_error("Unexpected end of zstd stream");
+        }
+    }
+    return out;
+}
+
+/**
+ * Seekable zstd sink for DbnEncoder
+ *
+ * Buffers encoded bytes and compresses them as one frame whenever the owner marks a record
+ * boundary past the frame size. Finish() writes the final frame and the seek table.
+ *
+ * With worker threads, full frames are compressed on a pool while the owner keeps encoding;
+ * compressed frames are written in order as they complete, with at most two frames per
+ * worker in flight so a slow disk or level bounds memory rather than growing it.
+ */
+class SeekableZstdWriter : public databento::IWritable {
+public:
+    /**
+     * @param worker_threads Threads compressing frames in the background (0 = compress on
+     *                       the calling thread when a frame closes)
+     */
+    SeekableZstdWriter(const std::filesystem::path& path, int level, size_t frame_size,
+                       size_t worker_threads = 0)
+        : out_(path, std::ios::binary | std::ios::trunc)
+        , path_(path)
+        , level_(level)
+        , frame_size_(std::clamp<size_t>(frame_size == 0 ? kDefaultSeekableFrameSize : frame_size,
+                                         4096, kMaxSeekableFrameSize))
+        , cctx_(ZSTD_createCCtx(), ZSTD_freeCCtx)
+    {
+        if (!out_) {
+            throw std::runtime_error("Failed to create file: " + path.string());
+        }
+        if (!cctx_) {
+            throw std::runtime_error("Failed to create zstd compression context");
+        }
+        ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_compressionLevel, level_);
+        ZSTD_CCtx_setParameter(cctx_.get(), ZSTD_c_checksumFlag, 1);
+        if (worker_threads > 0) {
+            pool_ = std::make_unique<ThreadPool>(worker_threads);
+        }
+    }
+
+    ~SeekableZstdWriter() override {
+        try {
+            Finish();
+        }
+        catch (...) {
+            // Destructors must not throw; call Finish() explicitly to observe errors
+        }
+        // Let running compressions finish before the pool is torn down
+        for (auto& frame : in_flight_) {
+            frame.wait();
+        }
+    }
+
+    SeekableZstdWriter(const SeekableZstdWriter&) = delete;
+    SeekableZstdWriter& operator=(const SeekableZstdWriter&) = delete;
+
+    void WriteAll(const std::byte* buffer, std::size_t length) override {
+        if (finished_) {
+            throw std::runtime_error("Writer is closed");
+        }
+        pending_.append(reinterpret_cast<const char*>(buffer), length);
+    }
+
+    /**
+     * Called after each whole record (or the metadata): closes the frame once it is full
+     */
+    void RecordBoundary(bool force = false) {
+        if (!pending_.empty() && (force || pending_.size() >= frame_size_)) {
+            EndFrame();
+        }
+    }
+
+    /**
+     * Write bytes as a frame of raw (stored) blocks with no content checksum
+     *
+     * The bytes appear verbatim in the file, so they can be patched in place after Finish(),
+     * e.g. DBN metadata whose end timestamp is only known once the last record is written.
+     * Closes the open frame first.
+     * @return File offset of the first byte of data
+     */
+    uint64_t WriteStoredFrame(const std::byte* data, size_t length) {
+        if (finished_) {
+            throw std::runtime_error("Writer is closed");
+        }
+        RecordBoundary(true);
+        DrainFrames(0);
+
+        std::string frame;
+        AppendStoredFrame(frame, data, length);
+        const uint64_t data_offset = position_ + kStoredFrameDataOffset;
+        WriteFrame(frame.data(), frame.size(), length);
+        return data_offset;
+    }
+
+    /**
+     * Close the open frame and write every frame compressed so far
+     */
+    void Flush() {
+        RecordBoundary(true);
+        DrainFrames(0);
+        out_.flush();
+        if (!out_) {
+            throw std::runtime_error("Failed to flush compressed frames");
+        }
+    }
+
+    // Bytes of whole frames written to the file so far
+    uint64_t Position() const { return position_; }
+
+    /**
+     * Flush and wait until the frames are on the device
+     */
+    void Sync() {
+        Flush();
+        SyncFileToDisk(path_);
+    }
+
+    /**
+     * Write the last frame and the seek table, then close the file (idempotent)
+     */
+    void Finish() {
+        if (finished_) {
+            return;
+        }
+        finished_ = true;
+        if (!pending_.empty()) {
+            EndFrame();
+        }
+        DrainFrames(0);
+
+        std::string table;
+        AppendSeekTable(table, entries_);
+        out_.write(table.data(), static_cast<std::streamsize>(table.size()));
+        out_.close();
+        if (!out_) {
+            throw std::runtime_error("Failed to write zstd seek table");
+        }
+    }
+
+private:
+    // A compressed frame and its uncompressed size
+    using Frame = std::pair<std::string, size_t>;
+
+    static size_t Compress(ZSTD_CCtx* cctx, const std::string& src, std::string& dst) {
+        dst.resize(ZSTD_compressBound(src.size()));
+        const size_t size = ZSTD_compress2(cctx, dst.data(), dst.size(), src.data(), src.size());
+        if (ZSTD_isError(size)) {
+            throw std::runtime_error(std::string("zstd compression failed: ") + ZSTD_getErrorName(size));
+        }
+        return size;
+    }
+
+    // Runs on a pool worker, each with a compression context of its own
+    static Frame CompressOnWorker(const std::string& src, int level) {
+        return {CompressSeekableFrame(src.data(), src.size(), level), src.size()};
+    }
+
+    void EndFrame() {
+        if (pool_) {
+            in_flight_.push_back(pool_->Submit([frame = std::move(pending_), level = level_] {
+                return CompressOnWorker(frame, level);
+            }));
+            pending_ = std::string{};
+            pending_.reserve(frame_size_);
+            DrainFrames(pool_->Size() * 2);
+            return;
+        }
+        const size_t size = Compress(cctx_.get(), pending_, compressed_);
+        WriteFrame(compressed_.data(), size, pending_.size());
+        pending_.clear();
+    }
+
+    // Write completed frames in order, waiting while more than limit are in flight
+    void DrainFrames(size_t limit) {
+        while (!in_flight_.empty() &&
+               (in_flight_.size() > limit ||
+                in_flight_.front().wait_for(std::chrono::seconds(0)) == std::future_status::ready)) {
+            std::future<Frame> next = std::move(in_flight_.front());
+            in_flight_.pop_front();
+            const Frame frame = next.get();
+            WriteFrame(frame.first.data(), frame.first.size(), frame.second);
+        }
+    }
+
+    void WriteFrame(const char* data, size_t size, size_t decompressed_size) {
+        out_.write(data, static_cast<std::streamsize>(size));
+        if (!out_) {
+            throw std::runtime_error("Failed to write compressed frame");
+        }
+        entries_.emplace_back(static_cast<uint32_t>(size), static_cast<uint32_t>(decompressed_size));
+        position_ += size;
+    }
+
+    std::ofstream out_;
+    std::filesystem::path path_;
+    int level_;
+    size_t frame_size_;
+    std::unique_ptr<ZSTD_CCtx, size_t (*)(ZSTD_CCtx*)> cctx_;
+    std::string pending_;
+    std::string compressed_;
+    std::vector<std::pair<uint32_t, uint32_t>> entries_;
+    uint64_t position_ = 0;
+    bool finished_ = false;
+    std::unique_ptr<ThreadPool> pool_;
+    std::deque<std::future<Frame>> in_flight_;
+};
+
+/**
+ * Record iterator over a memory-mapped seekable zstd file
+ *
+ * Frames are decompressed on a thread pool, a bounded window ahead of the consumer, and
+ * records are handed out in file order. Start() repositions at any decompressed offset
+ * that is a record boundary, decoding from the frame containing it.
+ *
+ * The pool is the reader's own, or one shared by many readers (a merge of many files),
+ * in which case each reader keeps only kSharedPoolWindow frames in flight.
+ */
+class SeekableZstdReader {
+public:
+    static constexpr size_t kSharedPoolWindow = 2;
+
+    SeekableZstdReader(std::unique_ptr<MappedFile> mapping, std::vector<SeekableFrame> frames,
+                       size_t threads = ThreadPool::DefaultThreadCount())
+        : SeekableZstdReader(std::move(mapping), std::move(frames), std::max<size_t>(threads, 1) * 2,
+                             std::make_shared<ThreadPool>(threads)) {}
+
+    SeekableZstdReader(std::unique_ptr<MappedFile> mapping, std::vector<SeekableFrame> frames,
+                       std::shared_ptr<ThreadPool> shared_pool)
+        : SeekableZstdReader(std::move(mapping), std::move(frames), kSharedPoolWindow, std::move(shared_pool)) {}
+
+    ~SeekableZstdReader() {
+        // A shared pool outlives this reader: wait out every task that still references it
+        ++generation_;
+        for (auto& pending : abandoned_) {
+            pending.wait();
+        }
+        for (auto& pending : inflight_) {
+            pending.wait();
+        }
+    }
+
+    SeekableZstdReader(const SeekableZstdReader&) = delete;
+    SeekableZstdReader& operator=(const SeekableZstdReader&) = delete;
+
+    uint64_t DecompressedSize() const { return decompressed_size_; }
+
+    /**
+     * Decompressed offset of the next record
+     */
+    uint64_t Offset() const { return offset_; }
+
+    /**
+     * Copy [0, length) of the decompressed stream (used for the DBN metadata header)
+     */
+    std::vector<uint8_t> ReadPrefix(size_t length) const {
+        if (length > decompressed_size_) {
+            throw std::runtime_error("Unexpected end of zstd stream");
+        }
+        std::vector<uint8_t> out;
+        out.reserve(length);
+        for (size_t i = 0; i < frames_.size() && out.size() < length; ++i) {
+            std::vector<uint8_t> frame = DecodeFrame(i);
+            const size_t take = std::min(frame.size(), length - out.size());
+            out.insert(out.end(), frame.begin(), frame.begin() + take);
+        }
+        return out;
+    }
+
+    /**
+     * Position at a decompressed offset, which must be a record boundary
+     */
+    void Start(uint64_t offset) {
+        if (offset > decompressed_size_) {
+            throw std::runtime_error("Seek offset is past the end of the zstd stream");
+        }
+        // Abandon the previous window: its queued decodes see the new generation and skip
+        ++generation_;
+        abandoned_.erase(std::remove_if(abandoned_.begin(), abandoned_.end(), [](const auto& pending) {
+            return pending.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }), abandoned_.end());
+        for (auto& pending : inflight_) {
+            abandoned_.push_back(std::move(pending));
+        }
+        inflight_.clear();
+        current_.clear();
+        pos_ = 0;
+        offset_ = offset;
+
+        auto it = std::upper_bound(frames_.begin(), frames_.end(), offset,
+            [](uint64_t value, const SeekableFrame& f) { return value < f.decompressed_offset; });
+        next_submit_ = it == frames_.begin() ? 0 : static_cast<size_t>(std::prev(it) - frames_.begin());
+        if (next_submit_ >= frames_.size() || offset == decompressed_size_) {
+            next_submit_ = frames_.size();
+            return;
+        }
+        const uint64_t skip = offset - frames_[next_submit_].decompressed_offset;
+        Schedule();
+        if (LoadNextFrame()) {
+            pos_ = static_cast<size_t>(skip);
+        }
+    }
+
+    /**
+     * Next record, or nullptr at end of stream. The pointer is valid until the next call.
+     * @throws std::runtime_error on corrupt or truncated data
+     */
+    const uint8_t* NextRecord() {
+        while (pos_ >= current_.size()) {
+            if (!LoadNextFrame()) {
+                return nullptr;
+            }
+        }
+        const uint8_t* record = current_.data() + pos_;
+        const size_t length = static_cast<size_t>(record[0]) * 4;
+        if (length < 16) {
+            throw std::runtime_error("Corrupt DBN record at decompressed offset " + std::to_string(offset_));
+        }
+        if (length <= current_.size() - pos_) {
+            pos_ += length;
+            offset_ += length;
+            return record;
+        }
+
+        // Record continues in the next frame(s): assemble it
+        carry_.assign(record, static_cast<const uint8_t*>(current_.data() + current_.size()));
+        while (carry_.size() < length) {
+            if (!LoadNextFrame()) {
+                throw std::runtime_error("Truncated DBN record at decompressed offset " + std::to_string(offset_));
+            }
+            const size_t take = std::min(current_.size(), length - carry_.size());
+            carry_.insert(carry_.end(), current_.begin(), current_.begin() + take);
+            pos_ = take;
+        }
+        offset_ += length;
+        return carry_.data();
+    }
+
+private:
+    std::vector<uint8_t> DecodeFrame(size_t index) const {
+        thread_local std::unique_ptr<ZSTD_DCtx, size_t (*)(ZSTD_DCtx*)> dctx{ZSTD_createDCtx(), ZSTD_freeDCtx};
+        const SeekableFrame& frame = frames_[index];
+        std::vector<uint8_t> out(frame.decompressed_size);
+        const size_t size = ZSTD_decompressDCtx(dctx.get(), out.data(), out.size(),
+            mapping_->Data() + frame.compressed_offset, frame.compressed_size);
+        if (ZSTD_isError(size)) {
+            throw std::runtime_error(std::string("zstd frame ") + std::to_string(index) +
+                                     " is corrupt: " + ZSTD_getErrorName(size));
+        }
+        if (size != frame.decompressed_size) {
+            throw std::runtime_error("zstd frame " + std::to_string(index) +
+                                     " size does not match the seek table");
+        }
+        return out;
+    }
+
+    SeekableZstdReader(std::unique_ptr<MappedFile> mapping, std::vector<SeekableFrame> frames,
+                       size_t window, std::shared_ptr<ThreadPool> pool)
+        : mapping_(std::move(mapping))
+        , frames_(std::move(frames))
+        , window_(window)
+        , pool_(std::move(pool))
+    {
+        if (!frames_.empty()) {
+            decompressed_size_ = frames_.back().decompressed_offset + frames_.back().decompressed_size;
+        }
+    }
+
+    void Schedule() {
+        while (inflight_.size() < window_ && next_submit_ < frames_.size()) {
+            const size_t index = next_submit_++;
+            inflight_.push_back(pool_->Submit([this, index, generation = generation_.load()] {
+                if (generation != generation_.load(std::memory_order_relaxed)) {
+                    return std::vector<uint8_t>{};  // Superseded by a later Start()
+                }
+                return DecodeFrame(index);
+            }));
+        }
+    }
+
+    bool LoadNextFrame() {
+        if (inflight_.empty()) {
+            current_.clear();
+            pos_ = 0;
+            return false;
+        }
+        current_ = inflight_.front().get();
+        inflight_.pop_front();
+        pos_ = 0;
+        Schedule();
+        return true;
+    }
+
+    std::unique_ptr<MappedFile> mapping_;
+    std::vector<SeekableFrame> frames_;
+    uint64_t decompressed_size_ = 0;
+    size_t window_;
+    std::atomic<uint64_t> generation_{0};  // Bumped by Start(); queued decodes of older windows skip
+    std::shared_ptr<ThreadPool> pool_;
+    std::deque<std::future<std::vector<uint8_t>>> inflight_;
+    std::vector<std::future<std::vector<uint8_t>>> abandoned_;  // Windows dropped by Start(), maybe still queued
+    size_t next_submit_ = 0;
+    std::vector<uint8_t> current_;
+    std::vector<uint8_t> carry_;
+    size_t pos_ = 0;
+    uint64_t offset_ = 0;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,259 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define DBENTO_KERNELS_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#define DBENTO_TARGET_AVX2
+#else
+#define DBENTO_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace databento_native {
+
+/**
+ * Analytics kernels over projected DBN columns
+ *
+ * Every kernel has a portable scalar version and, on x86-64, an AVX2 version compiled with a
+ * function-level target attribute, so the library still loads on CPUs without AVX2. The
+ * AVX2 path is picked once at runtime from CPUID. Prices are the DBN int64 fixed-point
+ * values (1e-9 units); UNDEF_PRICE (INT64_MAX) entries are skipped or mapped to NaN.
+ */
+namespace kernels {
+
+constexpr int64_t kUndefPrice = std::numeric_limits<int64_t>::max();
+constexpr double kPriceScale = 1e9;
+
+enum class SimdLevel : int {
+    Scalar = 0,
+    Avx2 = 1
+};
+
+/**
+ * Totals of a price/size range (min/max are UNDEF_PRICE / INT64_MIN when count is 0)
+ */
+struct RangeStats {
+    uint64_t count = 0;
+    int64_t min_price = kUndefPrice;
+    int64_t max_price = std::numeric_limits<int64_t>::min();
+    uint64_t volume = 0;
+    double notional = 0.0;  // Sum of price * size in price units (not fixed-point)
+
+    void Merge(const RangeStats& other) {
+        count += other.count;
+        min_price = std::min(min_price, other.min_price);
+        max_price = std::max(max_price, other.max_price);
+        volume += other.volume;
+        notional += other.notional;
+    }
+};
+
+namespace scalar {
+
+inline void PricesToDouble(const int64_t* prices, size_t count, double* out) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = prices[i] == kUndefPrice ? std::numeric_limits<double>::quiet_NaN()
+                                          : static_cast<double>(prices[i]) / kPriceScale;
+    }
+}
+
+inline RangeStats Stats(const int64_t* prices, const uint32_t* sizes, size_t count) {
+    RangeStats stats;
+    double notional = 0.0;
+    for (size_t i = 0; i < count; ++i) {
+        const int64_t price = prices[i];
+        if (price == kUndefPrice) {
+            continue;
+        }
+        ++stats.count;
+        stats.min_price = std::min(stats.min_price, price);
+        stats.max_price = std::max(stats.max_price, price);
+        stats.volume += sizes[i];
+        notional += static_cast<double>(price) * static_cast<double>(sizes[i]);
+    }
+    stats.notional = notional / kPriceScale;
+    return stats;
+}
+
+// out[i] = values[i] / values[i - 1] for i >= 1
+inline void Ratios(const double* values, size_t count, double* out) {
+    for (size_t i = 1; i < count; ++i) {
+        out[i] = values[i] / values[i - 1];
+    }
+}
+
+}  // namespace scalar
+
+#ifdef DBENTO_KERNELS_X86
+namespace avx2 {
+
+// Exact int64 -> double for the full int64 range (AVX2 has no packed conversion)
+DBENTO_TARGET_AVX2 inline __m256d Int64ToDouble(__m256i x) {
+    __m256i high = _mm256_srai_epi32(x, 16);
+    high = _mm256_blend_epi16(high, _mm256_setzero_si256(), 0x33);
+    high = _mm256_add_epi64(high, _mm256_castpd_si256(_mm256_set1_pd(442721857769029238784.0)));  // 3 * 2^67
+    __m256i low = _mm256_blend_epi16(x, _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0)), 0x88);  // 2^52
+    __m256d f = _mm256_sub_pd(_mm256_castsi256_pd(high), _mm256_set1_pd(442726361368656609280.0));  // 3 * 2^67 + 2^52
+    return _mm256_add_pd(f, _mm256_castsi256_pd(low));
+}
+
+// uint32 (zero-extended to 64 bits) -> double
+DBENTO_TARGET_AVX2 inline __m256d SmallUInt64ToDouble(__m256i x) {
+    const __m256d magic = _mm256_set1_pd(4503599627370496.0);  // 2^52
+    return _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(x, _mm256_castpd_si256(magic))), magic);
+}
+
+DBENTO_TARGET_AVX2 inline void PricesToDouble(const int64_t* prices, size_t count, double* out) {
+    const __m256i undef = _mm256_set1_epi64x(kUndefPrice);
+    const __m256d scale = _mm256_set1_pd(kPriceScale);
+    const __m256d nan = _mm256_set1_pd(std::numeric_limits<double>::quiet_NaN());
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prices + i));
+        const __m256d value = _mm256_div_pd(Int64ToDouble(p), scale);
+        const __m256d is_undef = _mm256_castsi256_pd(_mm256_cmpeq_epi64(p, undef));
+        _mm256_storeu_pd(out + i, _mm256_blendv_pd(value, nan, is_undef));
+    }
+    scalar::PricesToDouble(prices + i, count - i, out + i);
+}
+
+DBENTO_TARGET_AVX2 inline RangeStats Stats(const int64_t* prices, const uint32_t* sizes, size_t count) {
+    const __m256i undef = _mm256_set1_epi64x(kUndefPrice);
+    __m256i min = undef;  // UNDEF_PRICE is INT64_MAX, so it is neutral for min as is
+    __m256i max = _mm256_set1_epi64x(std::numeric_limits<int64_t>::min());
+    __m256i volume = _mm256_setzero_si256();
+    __m256i undef_count = _mm256_setzero_si256();
+    __m256d notional = _mm256_setzero_pd();
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const __m256i p = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prices + i));
+        const __m256i s = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(sizes + i)));
+        const __m256i is_undef = _mm256_cmpeq_epi64(p, undef);
+
+        min = _mm256_blendv_epi8(min, p, _mm256_cmpgt_epi64(min, p));
+        const __m256i p_for_max = _mm256_blendv_epi8(p, _mm256_set1_epi64x(std::numeric_limits<int64_t>::min()), is_undef);
+        max = _mm256_blendv_epi8(max, p_for_max, _mm256_cmpgt_epi64(p_for_max, max));
+
+        const __m256i s_defined = _mm256_andnot_si256(is_undef, s);
+        volume = _mm256_add_epi64(volume, s_defined);
+        const __m256d product = _mm256_mul_pd(Int64ToDouble(p), SmallUInt64ToDouble(s_defined));
+        notional = _mm256_add_pd(notional, _mm256_andnot_pd(_mm256_castsi256_pd(is_undef), product));
+        undef_count = _mm256_sub_epi64(undef_count, is_undef);  // is_undef lanes are -1
+    }
+
+    alignas(32) int64_t min_lanes[4], max_lanes[4], undef_lanes[4];
+    alignas(32) uint64_t volume_lanes[4];
+    alignas(32) double notional_lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(min_lanes), min);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(max_lanes), max);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(undef_lanes), undef_count);
+    _mm256_store_si256(reinterpret_cast<__m256i*>(volume_lanes), volume);
+    _mm256_store_pd(notional_lanes, notional);
+
+    RangeStats stats;
+    double notional_sum = 0.0;
+    for (int lane = 0; lane < 4; ++lane) {
+        stats.min_price = std::min(stats.min_price, min_lanes[lane]);
+        stats.max_price = std::max(stats.max_price, max_lanes[lane]);
+        stats.volume += volume_lanes[lane];
+        notional_sum += notional_lanes[lane];
+        stats.count += i / 4 - static_cast<uint64_t>(undef_lanes[lane]);
+    }
+    stats.notional = notional_sum / kPriceScale;
+    stats.Merge(scalar::Stats(prices + i, sizes + i, count - i));
+    return stats;
+}
+
+DBENTO_TARGET_AVX2 inline void Ratios(const double* values, size_t count, double* out) {
+    size_t i = 1;
+    for (; i + 4 <= count; i += 4) {
+        const __m256d current = _mm256_loadu_pd(values + i);
+        const __m256d previous = _mm256_loadu_pd(values + i - 1);
+        _mm256_storeu_pd(out + i, _mm256_div_pd(current, previous));
+    }
+    for (; i < count; ++i) {
+        out[i] = values[i] / values[i - 1];
+    }
+}
+
+}  // namespace avx2
+#endif
+
+inline SimdLevel DetectSimdLevel() {
+#ifdef DBENTO_KERNELS_X86
+#if defined(_MSC_VER) && !defined(__clang__)
+    int info[4];
+    __cpuid(info, 0);
+    if (info[0] >= 7) {
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (osxsave && avx && (_xgetbv(0) & 0x6) == 0x6) {
+            __cpuidex(info, 7, 0);
+            if (info[1] & (1 << 5)) {
+                return SimdLevel::Avx2;
+            }
+        }
+    }
+#else
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::Avx2;
+    }
+#endif
+#endif
+    return SimdLevel::Scalar;
+}
+
+inline SimdLevel ActiveSimdLevel() {
+    static const SimdLevel level = DetectSimdLevel();
+    return level;
+}
+
+/**
+ * Fixed-point prices to doubles (UNDEF_PRICE becomes NaN)
+ */
+inline void PricesToDouble(const int64_t* prices, size_t count, double* out) {
+#ifdef DBENTO_KERNELS_X86
+    if (ActiveSimdLevel() == SimdLevel::Avx2) {
+        avx2::PricesToDouble(prices, count, out);
+        return;
+    }
+#endif
+    scalar::PricesToDouble(prices, count, out);
+}
+
+/**
+ * Count, min/max price, volume and notional of a range (rows with UNDEF_PRICE are skipped)
+ */
+inline RangeStats Stats(const int64_t* prices, const uint32_t* sizes, size_t count) {
+#ifdef DBENTO_KERNELS_X86
+    if (ActiveSimdLevel() == SimdLevel::Avx2) {
+        return avx2::Stats(prices, sizes, count);
+    }
+#endif
+    return scalar::Stats(prices, sizes, count);
+}
+
+/**
+ * out[i] = values[i] / values[i - 1] for 1 <= i < count (out[0] is left untouched)
+ */
+inline void Ratios(const double* values, size_t count, double* out) {
+#ifdef DBENTO_KERNELS_X86
+    if (ActiveSimdLevel() == SimdLevel::Avx2) {
+        avx2::Ratios(values, count, out);
+        return;
+    }
+#endif
+    scalar::Ratios(values, count, out);
+}
+
+}  // namespace kernels
+}  // namespace databento_native
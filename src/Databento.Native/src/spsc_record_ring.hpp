@@ -0,0 +1,193 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+namespace databento_native {
+
+/**
+ * Spin-then-sleep wait strategy shared by the lock-free ring buffers
+ *
+ * Spins briefly (cheap when the other side is about to publish), then yields, then
+ * sleeps in short slices so an idle producer or consumer does not burn a full core.
+ */
+class RingBackoff {
+public:
+    void Pause() {
+        if (spins_ < kSpinLimit) {
+            ++spins_;
+        } else if (spins_ < kYieldLimit) {
+            ++spins_;
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+    }
+
+private:
+    static constexpr uint32_t kSpinLimit = 64;
+    static constexpr uint32_t kYieldLimit = 128;
+    uint32_t spins_ = 0;
+};
+
+/**
+ * Bounded single-producer / single-consumer ring of DBN records
+ *
+ * Records are stored back-to-back (8-byte aligned) in one contiguous buffer, so a push is
+ * a single memcpy and the consumer can walk every published record in place without
+ * copying or allocating. The first byte of a DBN record is its length in 32-bit words and
+ * is never zero, so a zero byte marks "wrapped to the start of the buffer".
+ *
+ * The only shared state is head_ (written by the producer) and tail_ (written by the
+ * consumer), both monotonically increasing byte counters kept on separate cache lines.
+ * The consumer publishes tail_ in slices rather than per record to limit cache-line traffic.
+ */
+class SpscRecordRing {
+public:
+    static constexpr size_t kMinCapacity = 64 * 1024;
+    static constexpr size_t kDefaultCapacity = 16 * 1024 * 1024;
+
+    explicit SpscRecordRing(size_t capacity = kDefaultCapacity)
+        : capacity_(RoundUpPowerOfTwo(capacity < kMinCapacity ? kMinCapacity : capacity))
+        , mask_(capacity_ - 1)
+        , release_slice_(capacity_ / 8)
+        , buffer_(new uint8_t[capacity_])
+    {}
+
+    SpscRecordRing(const SpscRecordRing&) = delete;
+    SpscRecordRing& operator=(const SpscRecordRing&) = delete;
+
+    /**
+     * Copy one record into the ring, blocking while the ring is full (producer only)
+     * @return false if the consumer cancelled; the record was not enqueued
+     */
+    bool Push(const void* record, size_t length) {
+        const auto* bytes = static_cast<const uint8_t*>(record);
+        if (length == 0 || static_cast<size_t>(bytes[0]) * 4 != length) {
+            throw std::invalid_argument("Record length does not match its header");
+        }
+        const size_t padded = Align8(length);
+
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        size_t offset = static_cast<size_t>(head & mask_);
+        const size_t contiguous = capacity_ - offset;
+        const size_t needed = padded <= contiguous ? padded : contiguous + padded;
+
+        RingBackoff backoff;
+        while (capacity_ - (head - cached_tail_) < needed) {
+            if (cancelled_.load(std::memory_order_acquire)) {
+                return false;
+            }
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (capacity_ - (head - cached_tail_) >= needed) {
+                break;
+            }
+            backoff.Pause();
+        }
+
+        if (padded > contiguous) {
+            buffer_[offset] = 0;  // Wrap marker
+            head += contiguous;
+            offset = 0;
+        }
+        std::memcpy(buffer_.get() + offset, bytes, length);
+        head_.store(head + padded, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Signal that no further records will be pushed (producer only)
+     */
+    void Close() {
+        closed_.store(true, std::memory_order_release);
+    }
+
+    /**
+     * Invoke fn(const uint8_t* data, size_t length) for every record currently available,
+     * blocking until at least one is available (consumer only). Record pointers are only
+     * valid for the duration of the call.
+     * @return false once the producer has closed the ring and it is fully drained
+     */
+    template <typename Fn>
+    bool ConsumeBatch(Fn&& fn) {
+        uint64_t tail = tail_.load(std::memory_order_relaxed);
+        uint64_t head = head_.load(std::memory_order_acquire);
+
+        RingBackoff backoff;
+        while (head == tail) {
+            if (closed_.load(std::memory_order_acquire)) {
+                // Re-read head: the final push may have landed just before Close()
+                head = head_.load(std::memory_order_acquire);
+                if (head == tail) {
+                    return false;
+                }
+                break;
+            }
+            backoff.Pause();
+            head = head_.load(std::memory_order_acquire);
+        }
+
+        uint64_t released = tail;
+        while (tail != head) {
+            const size_t offset = static_cast<size_t>(tail & mask_);
+            const uint8_t words = buffer_[offset];
+            if (words == 0) {
+                tail += capacity_ - offset;
+                continue;
+            }
+            const size_t length = static_cast<size_t>(words) * 4;
+            fn(static_cast<const uint8_t*>(buffer_.get() + offset), length);
+            tail += Align8(length);
+
+            if (tail - released >= release_slice_) {
+                tail_.store(tail, std::memory_order_release);
+                released = tail;
+            }
+        }
+        tail_.store(tail, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Ask the producer to stop; any blocked or subsequent Push returns false (consumer only)
+     */
+    void Cancel() {
+        cancelled_.store(true, std::memory_order_release);
+    }
+
+    bool IsCancelled() const {
+        return cancelled_.load(std::memory_order_acquire);
+    }
+
+    size_t Capacity() const { return capacity_; }
+
+private:
+    static size_t Align8(size_t n) { return (n + 7) & ~static_cast<size_t>(7); }
+
+    static size_t RoundUpPowerOfTwo(size_t n) {
+        size_t p = 1;
+        while (p < n) {
+            p <<= 1;
+        }
+        return p;
+    }
+
+    const size_t capacity_;
+    const size_t mask_;
+    const size_t release_slice_;
+    std::unique_ptr<uint8_t[]> buffer_;
+
+    alignas(64) std::atomic<uint64_t> head_{0};
+    uint64_t cached_tail_ = 0;  // Producer-local snapshot of tail_
+    alignas(64) std::atomic<uint64_t> tail_{0};
+    alignas(64) std::atomic<bool> closed_{false};
+    std::atomic<bool> cancelled_{false};
+};
+
+}  // namespace databento_native
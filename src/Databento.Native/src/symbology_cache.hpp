@@ -0,0 +1,443 @@
+#pragma once
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <date/date.h>
+#include <databento/symbology.hpp>
+
+namespace databento_native {
+
+/**
+ * Persistent symbology resolution cache
+ *
+ * One compact binary file per (API key fingerprint, dataset, stype_in, stype_out), since
+ * entitlements differ per account. For every input symbol the
+ * file holds the date segments that have already been resolved, each with the status the
+ * API reported (resolved / partial / not found) and the mapping intervals it returned.
+ * A request for [start, end) is answered from the cached segments and only the uncovered
+ * gaps are sent to the API, so a daily job that extends the end date by one day fetches
+ * one day, and a job that adds symbols fetches only the new symbols.
+ *
+ * Only days before the current UTC day are saved: answers for today or later (not found
+ * yet, or intervals cut off at today) can still change, so they are used for the request
+ * that fetched them and fetched again next time.
+ *
+ * File layout (host byte order, little-endian on all supported platforms):
+ *   "DBSYMC" u16 version, string key fingerprint, string dataset, string stype_in,
+ *   string stype_out, u32 symbols,
+ *   per symbol: string symbol, u32 segments,
+ *     per segment: i32 start_day, i32 end_day, u8 status, u32 intervals,
+ *       per interval: i32 start_day, i32 end_day, string symbol
+ *   where string = u32 length + bytes and days count from 1970-01-01 (end exclusive).
+ */
+
+using DayNumber = int32_t;
+
+inline DayNumber ToDayNumber(const date::year_month_day& ymd) {
+    return static_cast<DayNumber>(date::sys_days{ymd}.time_since_epoch().count());
+}
+
+inline date::year_month_day FromDayNumber(DayNumber day) {
+    return date::year_month_day{date::sys_days{date::days{day}}};
+}
+
+/**
+ * Current UTC day: every day before it is complete
+ */
+inline DayNumber CurrentUtcDay() {
+    const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    return static_cast<DayNumber>(seconds / 86400);
+}
+
+/**
+ * Parse a YYYY-MM-DD date
+ * @throws std::invalid_argument on malformed or invalid dates
+ */
+inline DayNumber ParseIsoDate(const char* str) {
+    int y = 0;
+    unsigned m = 0, d = 0;
+    char trailing = 0;
+    if (!str || std::sscanf(str, "%4d-%2u-%2u%c", &y, &m, &d, &trailing) != 3) {
+        throw std::invalid_argument(std::string("Invalid date (expected YYYY-MM-DD): ") + (str ? str : "null"));
+    }
+    date::year_month_day ymd = date::year{y} / date::month{m} / date::day{d};
+    if (!ymd.ok()) {
+        throw std::invalid_argument(std::string("Invalid date: ") + str);
+    }
+    return ToDayNumber(ymd);
+}
+
+inline std::string FormatIsoDate(DayNumber day) {
+    std::ostringstream ss;
+    ss << date::format("%Y-%m-%d", FromDayNumber(day));
+    return ss.str();
+}
+
+enum class CachedSymbolStatus : uint8_t {
+    Resolved = 0,
+    Partial = 1,
+    NotFound = 2
+};
+
+struct CachedInterval {
+    DayNumber start;
+    DayNumber end;
+    std::string symbol;
+};
+
+struct CachedSegment {
+    DayNumber start;
+    DayNumber end;
+    CachedSymbolStatus status;
+    std::vector<CachedInterval> intervals;
+    bool transient = false;  // Reaches today or later: not saved
+};
+
+class SymbologyCacheFile {
+public:
+    static constexpr char kMagic[6] = {'D', 'B', 'S', 'Y', 'M', 'C'};
+    static constexpr uint16_t kVersion = 2;
+
+    /**
+     * @param key_fingerprint API key fingerprint (MetadataCache::Fingerprint)
+     */
+    SymbologyCacheFile(const std::filesystem::path& cache_dir, std::string key_fingerprint,
+                       std::string dataset, std::string stype_in, std::string stype_out)
+        : key_fingerprint_(std::move(key_fingerprint))
+        , dataset_(std::move(dataset))
+        , stype_in_(std::move(stype_in))
+        , stype_out_(std::move(stype_out))
+    {
+        std::string name = key_fingerprint_ + "_" + dataset_ + "_" + stype_in_ + "_" + stype_out_;
+        for (char& c : name) {
+            if (!std::isalnum(static_cast<unsigned char>(c)) && c != '.' && c != '-' && c != '_') {
+                c = '_';
+            }
+        }
+        path_ = cache_dir / (name + ".symc");
+    }
+
+    const std::filesystem::path& Path() const { return path_; }
+
+    /**
+     * Load the cache file; a missing, mismatched or corrupt file leaves the cache empty
+     */
+    void Load() {
+        symbols_.clear();
+        std::ifstream in(path_, std::ios::binary);
+        if (!in) {
+            return;
+        }
+        std::vector<char> data{std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+        try {
+            Reader reader{data.data(), data.size(), 0};
+            char magic[sizeof(kMagic)];
+            reader.Bytes(magic, sizeof(magic));
+            if (std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 || reader.Pod<uint16_t>() != kVersion) {
+                return;
+            }
+            if (reader.String() != key_fingerprint_ || reader.String() != dataset_ ||
+                reader.String() != stype_in_ || reader.String() != stype_out_) {
+                return;
+            }
+            uint32_t symbol_count = reader.Pod<uint32_t>();
+            for (uint32_t i = 0; i < symbol_count; ++i) {
+                std::string symbol = reader.String();
+                auto& segments = symbols_[symbol];
+                uint32_t segment_count = reader.Pod<uint32_t>();
+                for (uint32_t s = 0; s < segment_count; ++s) {
+                    CachedSegment segment;
+                    segment.start = reader.Pod<int32_t>();
+                    segment.end = reader.Pod<int32_t>();
+                    segment.status = static_cast<CachedSymbolStatus>(reader.Pod<uint8_t>());
+                    uint32_t interval_count = reader.Pod<uint32_t>();
+                    for (uint32_t k = 0; k < interval_count; ++k) {
+                        CachedInterval interval;
+                        interval.start = reader.Pod<int32_t>();
+                        interval.end = reader.Pod<int32_t>();
+                        interval.symbol = reader.String();
+                        segment.intervals.push_back(std::move(interval));
+                    }
+                    segments.push_back(std::move(segment));
+                }
+            }
+        }
+        catch (const std::exception&) {
+            symbols_.clear();
+        }
+    }
+
+    /**
+     * Write the cache file atomically (temp file + rename), leaving out transient segments
+     * @throws std::runtime_error on I/O failure
+     */
+    void Save() const {
+        auto persistent = [](const std::vector<CachedSegment>& segments) {
+            return static_cast<uint32_t>(std::count_if(segments.begin(), segments.end(),
+                [](const CachedSegment& segment) { return !segment.transient; }));
+        };
+        uint32_t symbol_count = 0;
+        for (const auto& [symbol, segments] : symbols_) {
+            symbol_count += persistent(segments) > 0 ? 1 : 0;
+        }
+
+        std::string out;
+        out.append(kMagic, sizeof(kMagic));
+        AppendPod(out, kVersion);
+        AppendString(out, key_fingerprint_);
+        AppendString(out, dataset_);
+        AppendString(out, stype_in_);
+        AppendString(out, stype_out_);
+        AppendPod(out, symbol_count);
+        for (const auto& [symbol, segments] : symbols_) {
+            const uint32_t segment_count = persistent(segments);
+            if (segment_count == 0) {
+                continue;
+            }
+            AppendString(out, symbol);
+            AppendPod(out, segment_count);
+            for (const auto& segment : segments) {
+                if (segment.transient) {
+                    continue;
+                }
+                AppendPod(out, static_cast<int32_t>(segment.start));
+                AppendPod(out, static_cast<int32_t>(segment.end));
+                AppendPod(out, static_cast<uint8_t>(segment.status));
+                AppendPod(out, static_cast<uint32_t>(segment.intervals.size()));
+                for (const auto& interval : segment.intervals) {
+                    AppendPod(out, static_cast<int32_t>(interval.start));
+                    AppendPod(out, static_cast<int32_t>(interval.end));
+                    AppendString(out, interval.symbol);
+                }
+            }
+        }
+
+        std::error_code ec;
+        std::filesystem::create_directories(path_.parent_path(), ec);
+        std::filesystem::path tmp_path = path_;
+        tmp_path += ".tmp";
+        {
+            std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+            if (!file || !file.write(out.data(), static_cast<std::streamsize>(out.size()))) {
+                throw std::runtime_error("Failed to write symbology cache: " + tmp_path.string());
+            }
+        }
+        std::filesystem::rename(tmp_path, path_, ec);
+        if (ec) {
+            throw std::runtime_error("Failed to replace symbology cache: " + ec.message());
+        }
+    }
+
+    /**
+     * Sub-ranges of [start, end) not yet cached for symbol, in ascending order
+     */
+    std::vector<std::pair<DayNumber, DayNumber>> MissingRanges(
+        const std::string& symbol, DayNumber start, DayNumber end) const
+    {
+        std::vector<std::pair<DayNumber, DayNumber>> gaps;
+        DayNumber cursor = start;
+        auto it = symbols_.find(symbol);
+        if (it != symbols_.end()) {
+            for (const auto& segment : it->second) {
+                if (segment.end <= cursor) {
+                    continue;
+                }
+                if (segment.start >= end) {
+                    break;
+                }
+                if (segment.start > cursor) {
+                    gaps.emplace_back(cursor, segment.start);
+                }
+                cursor = std::max(cursor, segment.end);
+                if (cursor >= end) {
+                    break;
+                }
+            }
+        }
+        if (cursor < end) {
+            gaps.emplace_back(cursor, end);
+        }
+        return gaps;
+    }
+
+    /**
+     * Record the API result for symbol over [start, end), filling only the parts still
+     * missing (another request may have cached some since the gap was computed). Days from
+     * complete_end on are kept as transient segments.
+     */
+    void AddResolution(const std::string& symbol, const databento::SymbologyResolution& resolution,
+                       DayNumber start, DayNumber end, DayNumber complete_end)
+    {
+        for (const auto& [gap_start, gap_end] : MissingRanges(symbol, start, end)) {
+            if (gap_start < complete_end) {
+                AddSegment(symbol, resolution, gap_start, std::min(gap_end, complete_end), false);
+            }
+            if (gap_end > complete_end) {
+                AddSegment(symbol, resolution, std::max(gap_start, complete_end), gap_end, true);
+            }
+        }
+    }
+
+    /**
+     * Append the cached answer for symbol over [start, end) to out. Intervals are clipped
+     * to the range and coalesced across segment boundaries.
+     */
+    void Compose(const std::string& symbol, DayNumber start, DayNumber end,
+                 databento::SymbologyResolution& out) const
+    {
+        auto it = symbols_.find(symbol);
+        if (it == symbols_.end()) {
+            out.not_found.push_back(symbol);
+            return;
+        }
+
+        bool any_found = false;
+        bool all_resolved = true;
+        std::vector<CachedInterval> intervals;
+        for (const auto& segment : it->second) {
+            if (segment.end <= start || segment.start >= end) {
+                continue;
+            }
+            if (segment.status != CachedSymbolStatus::Resolved) {
+                all_resolved = false;
+            }
+            if (segment.status == CachedSymbolStatus::NotFound) {
+                continue;
+            }
+            any_found = true;
+            for (const auto& interval : segment.intervals) {
+                DayNumber clipped_start = std::max(interval.start, start);
+                DayNumber clipped_end = std::min(interval.end, end);
+                if (clipped_start >= clipped_end) {
+                    continue;
+                }
+                if (!intervals.empty() && intervals.back().end == clipped_start &&
+                    intervals.back().symbol == interval.symbol) {
+                    intervals.back().end = clipped_end;
+                } else {
+                    intervals.push_back(CachedInterval{clipped_start, clipped_end, interval.symbol});
+                }
+            }
+        }
+
+        if (!any_found) {
+            out.not_found.push_back(symbol);
+            return;
+        }
+        if (!all_resolved) {
+            out.partial.push_back(symbol);
+        }
+        auto& mapped = out.mappings[symbol];
+        for (const auto& interval : intervals) {
+            mapped.push_back(databento::StrMappingInterval{
+                FromDayNumber(interval.start), FromDayNumber(interval.end), interval.symbol});
+        }
+    }
+
+private:
+    /**
+     * Insert the part of an API result that falls in [start, end), a missing range inside
+     * the resolved range. A partial result is re-classified from the intervals it keeps.
+     */
+    void AddSegment(const std::string& symbol, const databento::SymbologyResolution& resolution,
+                    DayNumber start, DayNumber end, bool transient)
+    {
+        CachedSegment segment{start, end, CachedSymbolStatus::NotFound, {}, transient};
+        auto mapping = resolution.mappings.find(symbol);
+        if (mapping != resolution.mappings.end()) {
+            DayNumber covered_to = start;
+            bool contiguous = true;
+            for (const auto& interval : mapping->second) {
+                DayNumber clipped_start = std::max(ToDayNumber(interval.start_date), start);
+                DayNumber clipped_end = std::min(ToDayNumber(interval.end_date), end);
+                if (clipped_start >= clipped_end) {
+                    continue;
+                }
+                contiguous = contiguous && clipped_start <= covered_to;
+                covered_to = std::max(covered_to, clipped_end);
+                segment.intervals.push_back(CachedInterval{clipped_start, clipped_end, interval.symbol});
+            }
+            if (!Contains(resolution.partial, symbol)) {
+                segment.status = CachedSymbolStatus::Resolved;
+            } else if (!segment.intervals.empty()) {
+                segment.status = contiguous && covered_to >= end
+                    ? CachedSymbolStatus::Resolved
+                    : CachedSymbolStatus::Partial;
+            }
+        }
+
+        auto& segments = symbols_[symbol];
+        auto pos = std::lower_bound(segments.begin(), segments.end(), start,
+            [](const CachedSegment& s, DayNumber value) { return s.start < value; });
+        segments.insert(pos, std::move(segment));
+    }
+
+    struct Reader {
+        const char* data;
+        size_t size;
+        size_t offset;
+
+        void Bytes(void* dest, size_t count) {
+            if (count > size - offset) {
+                throw std::runtime_error("Truncated symbology cache");
+            }
+            std::memcpy(dest, data + offset, count);
+            offset += count;
+        }
+
+        template <typename T>
+        T Pod() {
+            T value;
+            Bytes(&value, sizeof(T));
+            return value;
+        }
+
+        std::string String() {
+            uint32_t length = Pod<uint32_t>();
+            if (length > size - offset) {
+                throw std::runtime_error("Truncated symbology cache");  // Before allocating
+            }
+            std::string value(data + offset, length);
+            offset += length;
+            return value;
+        }
+    };
+
+    template <typename T>
+    static void AppendPod(std::string& out, T value) {
+        out.append(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    static void AppendString(std::string& out, const std::string& value) {
+        AppendPod(out, static_cast<uint32_t>(value.size()));
+        out.append(value);
+    }
+
+    static bool Contains(const std::vector<std::string>& values, const std::string& value) {
+        return std::find(values.begin(), values.end(), value) != values.end();
+    }
+
+    std::string key_fingerprint_;
+    std::string dataset_;
+    std::string stype_in_;
+    std::string stype_out_;
+    std::filesystem::path path_;
+    std::unordered_map<std::string, std::vector<CachedSegment>> symbols_;
+};
+
+}  // namespace databento_native
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace databento_native {
+
+/**
+ * Fixed-size worker pool for CPU-bound file work (frame decode/encode, scans)
+ *
+ * Submit() returns a std::future for the task's result. Destroying the pool drops tasks
+ * that have not started (their futures report broken_promise) and joins the workers, so
+ * anything the tasks reference only has to outlive the pool.
+ */
+class ThreadPool {
+public:
+    explicit ThreadPool(size_t threads) {
+        threads = std::max<size_t>(threads, 1);
+        workers_.reserve(threads);
+        for (size_t i = 0; i < threads; ++i) {
+            workers_.emplace_back([this] { WorkerLoop(); });
+        }
+    }
+
+    ~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+            queue_.clear();
+        }
+        cv_.notify_all();
+        for (auto& worker : workers_) {
+            worker.join();
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /**
+     * Default worker count: hardware threads, capped so one reader cannot take the machine
+     */
+    static size_t DefaultThreadCount(size_t cap = 8) {
+        size_t hw = std::thread::hardware_concurrency();
+        return std::clamp<size_t>(hw == 0 ? 2 : hw, 1, cap);
+    }
+
+    size_t Size() const { return workers_.size(); }
+
+    template <typename Fn>
+    std::future<std::invoke_result_t<Fn>> Submit(Fn&& fn) {
+        using Result = std::invoke_result_t<Fn>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<Fn>(fn));
+        std::future<Result> future = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.emplace_back([task] { (*task)(); });
+        }
+        cv_.notify_one();
+        return future;
+    }
+
+private:
+    void WorkerLoop() {
+        for (;;) {
+            std::function<void()> job;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                cv_.wait(lock, [this] { return stopping_ || !queue_.empty(); });
+                if (stopping_) {
+                    return;
+                }
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            job();
+        }
+    }
+
+    std::vector<std::thread> workers_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::function<void()>> queue_;
+    bool stopping_ = false;
+};
+
+}  // namespace databento_native